@@ -0,0 +1,127 @@
+//
+//  yas_audio_executor.cpp
+//
+
+#include "yas_audio_executor.h"
+
+#include <cpp_utils/yas_thread.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::executor_utils {
+static std::mutex control_mutex;
+static executor_ptr control_executor = nullptr;
+}  // namespace yas::audio::executor_utils
+
+#pragma mark - main_executor
+
+void main_executor::perform(std::function<void(void)> &&handler) {
+    thread::perform_async_on_main(std::move(handler));
+}
+
+main_executor_ptr main_executor::make_shared() {
+    return main_executor_ptr{new main_executor{}};
+}
+
+#pragma mark - thread_pool_executor
+
+// shared with the threads not to be destroyed under a thread that released the executor in a handler.
+struct thread_pool_executor::queue {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::function<void(void)>> handlers;
+    bool is_terminated = false;
+};
+
+thread_pool_executor::thread_pool_executor(uint32_t const thread_count) : _queue(std::make_shared<queue>()) {
+    if (thread_count == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : thread_count is zero.");
+    }
+
+    this->_threads.reserve(thread_count);
+
+    for (uint32_t idx = 0; idx < thread_count; ++idx) {
+        this->_threads.emplace_back([queue = this->_queue] { _run(queue); });
+    }
+}
+
+thread_pool_executor::~thread_pool_executor() {
+    {
+        std::lock_guard<std::mutex> lock(this->_queue->mutex);
+        this->_queue->is_terminated = true;
+    }
+
+    this->_queue->condition.notify_all();
+
+    auto const current_id = std::this_thread::get_id();
+
+    for (auto &thread : this->_threads) {
+        if (thread.get_id() == current_id) {
+            // released in a handler. the thread drains the rest and ends after the handler returns.
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+}
+
+uint32_t thread_pool_executor::thread_count() const {
+    return static_cast<uint32_t>(this->_threads.size());
+}
+
+void thread_pool_executor::perform(std::function<void(void)> &&handler) {
+    {
+        std::lock_guard<std::mutex> lock(this->_queue->mutex);
+        this->_queue->handlers.push_back(std::move(handler));
+    }
+
+    this->_queue->condition.notify_one();
+}
+
+void thread_pool_executor::_run(std::shared_ptr<queue> const &queue) {
+    while (true) {
+        std::function<void(void)> handler;
+
+        {
+            std::unique_lock<std::mutex> lock(queue->mutex);
+
+            queue->condition.wait(lock, [&queue] { return queue->is_terminated || !queue->handlers.empty(); });
+
+            // the performed handlers are drained before terminating.
+            if (queue->handlers.empty()) {
+                return;
+            }
+
+            handler = std::move(queue->handlers.front());
+            queue->handlers.pop_front();
+        }
+
+        handler();
+    }
+}
+
+thread_pool_executor_ptr thread_pool_executor::make_shared(uint32_t const thread_count) {
+    return thread_pool_executor_ptr{new thread_pool_executor{thread_count}};
+}
+
+#pragma mark - control executor
+
+executor_ptr yas::audio::control_executor() {
+    std::lock_guard<std::mutex> lock(executor_utils::control_mutex);
+
+    if (!executor_utils::control_executor) {
+        executor_utils::control_executor = main_executor::make_shared();
+    }
+
+    return executor_utils::control_executor;
+}
+
+void yas::audio::set_control_executor(executor_ptr const &executor) {
+    std::lock_guard<std::mutex> lock(executor_utils::control_mutex);
+    executor_utils::control_executor = executor;
+}
@@ -0,0 +1,62 @@
+//
+//  yas_audio_executor.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_ptr.h>
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace yas::audio {
+// performs the callbacks of the control plane like the completions and the device updates.
+struct executor {
+    virtual ~executor() = default;
+
+    virtual void perform(std::function<void(void)> &&) = 0;
+};
+
+struct main_executor final : executor {
+    void perform(std::function<void(void)> &&) override;
+
+    [[nodiscard]] static main_executor_ptr make_shared();
+
+   private:
+    main_executor() = default;
+};
+
+// performs on its own threads without a run loop. it is serial if it has one thread.
+// it may be released in a handler performed on it.
+struct thread_pool_executor final : executor {
+    ~thread_pool_executor();
+
+    [[nodiscard]] uint32_t thread_count() const;
+
+    void perform(std::function<void(void)> &&) override;
+
+    [[nodiscard]] static thread_pool_executor_ptr make_shared(uint32_t const thread_count = 1);
+
+   private:
+    struct queue;
+
+    std::shared_ptr<queue> const _queue;
+    std::vector<std::thread> _threads;
+
+    explicit thread_pool_executor(uint32_t const thread_count);
+
+    static void _run(std::shared_ptr<queue> const &);
+
+    thread_pool_executor(thread_pool_executor const &) = delete;
+    thread_pool_executor(thread_pool_executor &&) = delete;
+    thread_pool_executor &operator=(thread_pool_executor const &) = delete;
+    thread_pool_executor &operator=(thread_pool_executor &&) = delete;
+};
+
+// the executor for the callbacks of the system devices and the offline devices. it is main_executor by default.
+// it must be serial if the callbacks touch an io or a graph.
+// the mac devices are updated by the callbacks without locks. they must be used only on the thread of the executor.
+[[nodiscard]] executor_ptr control_executor();
+void set_control_executor(executor_ptr const &);
+}  // namespace yas::audio
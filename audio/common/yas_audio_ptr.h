@@ -8,8 +8,14 @@
 
 namespace yas::audio {
 class pcm_buffer;
+class pcm_ring_buffer;
 class time;
 class file;
+class native_file;
+class mapped_file;
+class file_stream;
+class file_stream_pool;
+class file_writer;
 class io_kernel;
 class io;
 class ios_device;
@@ -26,7 +32,21 @@ class avf_au;
 class avf_au_parameter;
 class avf_au_parameter_core;
 class offline_device;
+class offline_file_sink;
 class offline_io_core;
+class offline_scheduler;
+class offline_sink;
+class executor;
+class main_executor;
+class thread_pool_executor;
+class shared_memory_ring;
+class shared_memory_device;
+class shared_memory_io_core;
+class file_device;
+class file_io_core;
+class paced_io_core;
+class virtual_device;
+class simulated_device;
 class graph_connection;
 class graph_kernel;
 class graph;
@@ -37,6 +57,10 @@ class graph_input_tap;
 class graph_io;
 class graph_avf_au;
 class graph_avf_au_mixer;
+class graph_mixer;
+class graph_resampler;
+class graph_shared_memory_sink;
+class graph_file_player;
 
 class manageable_graph_au;
 class graph_node_removable;
@@ -49,8 +73,14 @@ class manageable_graph_avf_au;
 class renderable_graph_connection;
 
 using pcm_buffer_ptr = std::shared_ptr<pcm_buffer>;
+using pcm_ring_buffer_ptr = std::shared_ptr<pcm_ring_buffer>;
 using time_ptr = std::shared_ptr<time>;
 using file_ptr = std::shared_ptr<file>;
+using native_file_ptr = std::shared_ptr<native_file>;
+using mapped_file_ptr = std::shared_ptr<mapped_file>;
+using file_stream_ptr = std::shared_ptr<file_stream>;
+using file_stream_pool_ptr = std::shared_ptr<file_stream_pool>;
+using file_writer_ptr = std::shared_ptr<file_writer>;
 using io_kernel_ptr = std::shared_ptr<io_kernel>;
 using io_ptr = std::shared_ptr<io>;
 using ios_device_session_ptr = std::shared_ptr<ios_device_session>;
@@ -67,7 +97,21 @@ using avf_au_ptr = std::shared_ptr<avf_au>;
 using avf_au_parameter_ptr = std::shared_ptr<avf_au_parameter>;
 using avf_au_parameter_core_ptr = std::shared_ptr<avf_au_parameter_core>;
 using offline_device_ptr = std::shared_ptr<offline_device>;
+using offline_file_sink_ptr = std::shared_ptr<offline_file_sink>;
 using offline_io_core_ptr = std::shared_ptr<offline_io_core>;
+using offline_scheduler_ptr = std::shared_ptr<offline_scheduler>;
+using offline_sink_ptr = std::shared_ptr<offline_sink>;
+using executor_ptr = std::shared_ptr<executor>;
+using main_executor_ptr = std::shared_ptr<main_executor>;
+using thread_pool_executor_ptr = std::shared_ptr<thread_pool_executor>;
+using shared_memory_ring_ptr = std::shared_ptr<shared_memory_ring>;
+using shared_memory_device_ptr = std::shared_ptr<shared_memory_device>;
+using shared_memory_io_core_ptr = std::shared_ptr<shared_memory_io_core>;
+using file_device_ptr = std::shared_ptr<file_device>;
+using file_io_core_ptr = std::shared_ptr<file_io_core>;
+using paced_io_core_ptr = std::shared_ptr<paced_io_core>;
+using virtual_device_ptr = std::shared_ptr<virtual_device>;
+using simulated_device_ptr = std::shared_ptr<simulated_device>;
 using graph_connection_ptr = std::shared_ptr<graph_connection>;
 using graph_kernel_ptr = std::shared_ptr<graph_kernel>;
 using graph_ptr = std::shared_ptr<graph>;
@@ -79,6 +123,10 @@ using graph_input_tap_ptr = std::shared_ptr<graph_input_tap>;
 using graph_io_ptr = std::shared_ptr<graph_io>;
 using graph_avf_au_ptr = std::shared_ptr<graph_avf_au>;
 using graph_avf_au_mixer_ptr = std::shared_ptr<graph_avf_au_mixer>;
+using graph_mixer_ptr = std::shared_ptr<graph_mixer>;
+using graph_resampler_ptr = std::shared_ptr<graph_resampler>;
+using graph_shared_memory_sink_ptr = std::shared_ptr<graph_shared_memory_sink>;
+using graph_file_player_ptr = std::shared_ptr<graph_file_player>;
 
 using manageable_graph_au_ptr = std::shared_ptr<manageable_graph_au>;
 using graph_node_removable_ptr = std::shared_ptr<graph_node_removable>;
@@ -0,0 +1,99 @@
+//
+//  yas_audio_render_thread_policy.cpp
+//
+
+#include "yas_audio_render_thread_policy.h"
+
+#include <mach/mach.h>
+#include <sched.h>
+#include <unistd.h>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::render_thread_policy_utils {
+static std::size_t constexpr prefault_stack_size = 256 * 1024;
+
+static bool set_scheduling(pthread_t const thread, render_thread_policy::scheduling_t const scheduling,
+                           std::optional<int32_t> const &priority) {
+    int const policy = scheduling == render_thread_policy::scheduling_t::fifo ? SCHED_FIFO : SCHED_RR;
+
+    sched_param param{};
+    param.sched_priority = priority.value_or(sched_get_priority_max(policy));
+
+    return pthread_setschedparam(thread, policy, &param) == 0;
+}
+
+static bool set_affinity(pthread_t const thread, uint32_t const tag) {
+    thread_affinity_policy_data_t policy{.affinity_tag = static_cast<integer_t>(tag)};
+
+    return thread_policy_set(pthread_mach_thread_np(thread), THREAD_AFFINITY_POLICY,
+                             reinterpret_cast<thread_policy_t>(&policy), THREAD_AFFINITY_POLICY_COUNT) == KERN_SUCCESS;
+}
+}  // namespace yas::audio::render_thread_policy_utils
+
+std::vector<render_thread_policy::error_t> render_thread_policy::apply(pthread_t const thread) const {
+    std::vector<error_t> errors;
+
+    if (this->scheduling != scheduling_t::inherited &&
+        !render_thread_policy_utils::set_scheduling(thread, this->scheduling, this->priority)) {
+        errors.push_back(error_t::scheduling_failed);
+    }
+
+    if (this->affinity_tag.has_value() &&
+        !render_thread_policy_utils::set_affinity(thread, this->affinity_tag.value())) {
+        errors.push_back(error_t::affinity_failed);
+    }
+
+    return errors;
+}
+
+bool render_thread_policy::operator==(render_thread_policy const &rhs) const {
+    return this->scheduling == rhs.scheduling && this->priority == rhs.priority &&
+           this->affinity_tag == rhs.affinity_tag && this->prefaults_buffers == rhs.prefaults_buffers;
+}
+
+bool render_thread_policy::operator!=(render_thread_policy const &rhs) const {
+    return !(*this == rhs);
+}
+
+void yas::audio::prefault_thread_stack() {
+    auto const page_size = static_cast<std::size_t>(getpagesize());
+    uint8_t stack[render_thread_policy_utils::prefault_stack_size];
+    // written through a volatile pointer not to be optimized out.
+    auto *const data = static_cast<uint8_t volatile *>(stack);
+
+    for (std::size_t offset = 0; offset < sizeof(stack); offset += page_size) {
+        data[offset] = 0;
+    }
+}
+
+std::string yas::to_string(render_thread_policy::scheduling_t const &scheduling) {
+    switch (scheduling) {
+        case render_thread_policy::scheduling_t::inherited:
+            return "inherited";
+        case render_thread_policy::scheduling_t::fifo:
+            return "fifo";
+        case render_thread_policy::scheduling_t::round_robin:
+            return "round_robin";
+    }
+}
+
+std::string yas::to_string(render_thread_policy::error_t const &error) {
+    switch (error) {
+        case render_thread_policy::error_t::scheduling_failed:
+            return "scheduling_failed";
+        case render_thread_policy::error_t::affinity_failed:
+            return "affinity_failed";
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, yas::audio::render_thread_policy::scheduling_t const &value) {
+    os << to_string(value);
+    return os;
+}
+
+std::ostream &operator<<(std::ostream &os, yas::audio::render_thread_policy::error_t const &value) {
+    os << to_string(value);
+    return os;
+}
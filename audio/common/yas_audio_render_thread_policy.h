@@ -0,0 +1,51 @@
+//
+//  yas_audio_render_thread_policy.h
+//
+
+#pragma once
+
+#include <pthread.h>
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace yas::audio {
+struct render_thread_policy final {
+    enum class scheduling_t : uint32_t {
+        inherited,
+        fifo,
+        round_robin,
+    };
+
+    enum class error_t : uint32_t {
+        scheduling_failed,
+        affinity_failed,
+    };
+
+    scheduling_t scheduling = scheduling_t::inherited;
+    std::optional<int32_t> priority = std::nullopt;  // the maximum priority of the scheduling if null
+    std::optional<uint32_t> affinity_tag = std::nullopt;  // threads with the same tag share a cache
+    // touches the pages of the input and output buffers of the io_kernel and the stack of the render thread.
+    // the buffers of the graph nodes are not touched.
+    bool prefaults_buffers = false;
+
+    // applies the policy to the thread and returns the settings that were refused. it never throws.
+    [[nodiscard]] std::vector<error_t> apply(pthread_t const) const;
+
+    bool operator==(render_thread_policy const &) const;
+    bool operator!=(render_thread_policy const &) const;
+};
+
+// touches the pages of the stack of the current thread not to fault while rendering.
+void prefault_thread_stack();
+}  // namespace yas::audio
+
+namespace yas {
+std::string to_string(audio::render_thread_policy::scheduling_t const &);
+std::string to_string(audio::render_thread_policy::error_t const &);
+}  // namespace yas
+
+std::ostream &operator<<(std::ostream &, yas::audio::render_thread_policy::scheduling_t const &);
+std::ostream &operator<<(std::ostream &, yas::audio::render_thread_policy::error_t const &);
@@ -0,0 +1,101 @@
+//
+//  yas_audio_dsp_analysis.cpp
+//
+
+#include "yas_audio_dsp_analysis.h"
+
+#include <cmath>
+
+#include "yas_audio_simd.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+float dsp::peak(float const *const data, uint32_t const length) {
+    simd::float4 peak4 = simd::splat(0.0f);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        peak4 = simd::max(peak4, simd::abs(simd::load(&data[idx])));
+    }
+
+    float peak = simd::reduce_max(peak4);
+
+    for (; idx < length; ++idx) {
+        peak = std::fmax(peak, std::fabs(data[idx]));
+    }
+
+    return peak;
+}
+
+float dsp::sum(float const *const data, uint32_t const length) {
+    simd::float4 sum4 = simd::splat(0.0f);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        sum4 = simd::add(sum4, simd::load(&data[idx]));
+    }
+
+    float sum = simd::sum(sum4);
+
+    for (; idx < length; ++idx) {
+        sum += data[idx];
+    }
+
+    return sum;
+}
+
+float dsp::sum_of_squares(float const *const data, uint32_t const length) {
+    simd::float4 sum4 = simd::splat(0.0f);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::float4 const value = simd::load(&data[idx]);
+        sum4 = simd::madd(sum4, value, value);
+    }
+
+    float sum = simd::sum(sum4);
+
+    for (; idx < length; ++idx) {
+        sum += data[idx] * data[idx];
+    }
+
+    return sum;
+}
+
+bool dsp::is_finite(float const *const data, uint32_t const length) {
+    // multiplying by zero leaves zero for finite values and NaN for infinity or NaN, and NaN sticks in the sum.
+    simd::float4 const zero4 = simd::splat(0.0f);
+    simd::float4 sum4 = zero4;
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        sum4 = simd::madd(sum4, simd::load(&data[idx]), zero4);
+    }
+
+    float sum = simd::sum(sum4);
+
+    for (; idx < length; ++idx) {
+        sum += data[idx] * 0.0f;
+    }
+
+    return sum == 0.0f;
+}
+
+bool dsp::is_finite(double const *const data, uint32_t const length) {
+    double sum = 0.0;
+
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        sum += data[idx] * 0.0;
+    }
+
+    return sum == 0.0;
+}
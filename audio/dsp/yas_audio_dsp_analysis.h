@@ -0,0 +1,16 @@
+//
+//  yas_audio_dsp_analysis.h
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace yas::audio::dsp {
+// largest absolute value. NaN samples are not guaranteed to be reflected, check them with is_finite.
+float peak(float const *const data, uint32_t const length);
+float sum(float const *const data, uint32_t const length);
+float sum_of_squares(float const *const data, uint32_t const length);
+bool is_finite(float const *const data, uint32_t const length);
+bool is_finite(double const *const data, uint32_t const length);
+}  // namespace yas::audio::dsp
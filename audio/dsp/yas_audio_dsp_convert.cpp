@@ -0,0 +1,682 @@
+//
+//  yas_audio_dsp_convert.cpp
+//
+
+#include "yas_audio_dsp_convert.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "yas_audio_simd.h"
+
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#include <immintrin.h>
+#define YAS_AUDIO_CONVERT_AVX2 1
+#endif
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::dsp::convert_utils {
+static uint32_t constexpr chunk_length = 256;
+
+static float constexpr int16_scale = 32768.0f;
+static float constexpr int24_scale = 8388608.0f;
+static float constexpr int32_scale = 2147483648.0f;
+static float constexpr fixed824_scale = 16777216.0f;
+static float constexpr int32_min = -2147483648.0f;
+static float constexpr int32_max = 2147483520.0f;
+
+struct kernels {
+    void (*int16_to_float)(int16_t const *const, float *const, uint32_t const, float const);
+    void (*int32_to_float)(int32_t const *const, float *const, uint32_t const, float const);
+    void (*float64_to_float)(double const *const, float *const, uint32_t const);
+    void (*float_to_int16)(float const *const, int16_t *const, uint32_t const);
+    void (*float_to_int32)(float const *const, int32_t *const, uint32_t const, float const, float const, float const);
+    void (*float_to_float64)(float const *const, double *const, uint32_t const);
+};
+
+#pragma mark - simd
+
+static void int16_to_float(int16_t const *const src, float *const dst, uint32_t const length, float const scale) {
+    simd::float4 const scale4 = simd::splat(scale);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store(&dst[idx], simd::mul(simd::load_int16(&src[idx]), scale4));
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] = static_cast<float>(src[idx]) * scale;
+    }
+}
+
+static void int32_to_float(int32_t const *const src, float *const dst, uint32_t const length, float const scale) {
+    simd::float4 const scale4 = simd::splat(scale);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store(&dst[idx], simd::mul(simd::load_int32(&src[idx]), scale4));
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] = static_cast<float>(src[idx]) * scale;
+    }
+}
+
+static void float64_to_float(double const *const src, float *const dst, uint32_t const length) {
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store(&dst[idx], simd::load_float64(&src[idx]));
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] = static_cast<float>(src[idx]);
+    }
+}
+
+static void float_to_int16(float const *const src, int16_t *const dst, uint32_t const length) {
+    simd::float4 const scale4 = simd::splat(int16_scale);
+    simd::float4 const min4 = simd::splat(-int16_scale);
+    simd::float4 const max4 = simd::splat(int16_scale - 1.0f);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::float4 const value = simd::mul(simd::load(&src[idx]), scale4);
+        simd::store_int16(&dst[idx], simd::min(simd::max(value, min4), max4));
+    }
+
+    for (; idx < length; ++idx) {
+        float const value = std::clamp(src[idx] * int16_scale, -int16_scale, int16_scale - 1.0f);
+        dst[idx] = static_cast<int16_t>(std::lrint(value));
+    }
+}
+
+static void float_to_int32(float const *const src, int32_t *const dst, uint32_t const length, float const scale,
+                           float const min, float const max) {
+    simd::float4 const scale4 = simd::splat(scale);
+    simd::float4 const min4 = simd::splat(min);
+    simd::float4 const max4 = simd::splat(max);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::float4 const value = simd::mul(simd::load(&src[idx]), scale4);
+        simd::store_int32(&dst[idx], simd::min(simd::max(value, min4), max4));
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] = static_cast<int32_t>(std::lrint(std::clamp(src[idx] * scale, min, max)));
+    }
+}
+
+static void float_to_float64(float const *const src, double *const dst, uint32_t const length) {
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store_float64(&dst[idx], simd::load(&src[idx]));
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] = src[idx];
+    }
+}
+
+#pragma mark - avx2
+
+#if YAS_AUDIO_CONVERT_AVX2
+
+__attribute__((target("avx2"))) static void int16_to_float_avx2(int16_t const *const src, float *const dst,
+                                                                uint32_t const length, float const scale) {
+    __m256 const scale8 = _mm256_set1_ps(scale);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % 8;
+
+    for (; idx < simd_length; idx += 8) {
+        __m256i const value = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(&src[idx])));
+        _mm256_storeu_ps(&dst[idx], _mm256_mul_ps(_mm256_cvtepi32_ps(value), scale8));
+    }
+
+    int16_to_float(&src[idx], &dst[idx], length - idx, scale);
+}
+
+__attribute__((target("avx2"))) static void int32_to_float_avx2(int32_t const *const src, float *const dst,
+                                                                uint32_t const length, float const scale) {
+    __m256 const scale8 = _mm256_set1_ps(scale);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % 8;
+
+    for (; idx < simd_length; idx += 8) {
+        __m256i const value = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(&src[idx]));
+        _mm256_storeu_ps(&dst[idx], _mm256_mul_ps(_mm256_cvtepi32_ps(value), scale8));
+    }
+
+    int32_to_float(&src[idx], &dst[idx], length - idx, scale);
+}
+
+__attribute__((target("avx2"))) static void float64_to_float_avx2(double const *const src, float *const dst,
+                                                                  uint32_t const length) {
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % 8;
+
+    for (; idx < simd_length; idx += 8) {
+        _mm_storeu_ps(&dst[idx], _mm256_cvtpd_ps(_mm256_loadu_pd(&src[idx])));
+        _mm_storeu_ps(&dst[idx + 4], _mm256_cvtpd_ps(_mm256_loadu_pd(&src[idx + 4])));
+    }
+
+    float64_to_float(&src[idx], &dst[idx], length - idx);
+}
+
+__attribute__((target("avx2"))) static void float_to_int16_avx2(float const *const src, int16_t *const dst,
+                                                                uint32_t const length) {
+    __m256 const scale8 = _mm256_set1_ps(int16_scale);
+    __m256 const min8 = _mm256_set1_ps(-int16_scale);
+    __m256 const max8 = _mm256_set1_ps(int16_scale - 1.0f);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % 8;
+
+    for (; idx < simd_length; idx += 8) {
+        __m256 const value = _mm256_mul_ps(_mm256_loadu_ps(&src[idx]), scale8);
+        __m256i const rounded = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(value, min8), max8));
+        __m128i const packed =
+            _mm_packs_epi32(_mm256_castsi256_si128(rounded), _mm256_extracti128_si256(rounded, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dst[idx]), packed);
+    }
+
+    float_to_int16(&src[idx], &dst[idx], length - idx);
+}
+
+__attribute__((target("avx2"))) static void float_to_int32_avx2(float const *const src, int32_t *const dst,
+                                                                uint32_t const length, float const scale,
+                                                                float const min, float const max) {
+    __m256 const scale8 = _mm256_set1_ps(scale);
+    __m256 const min8 = _mm256_set1_ps(min);
+    __m256 const max8 = _mm256_set1_ps(max);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % 8;
+
+    for (; idx < simd_length; idx += 8) {
+        __m256 const value = _mm256_mul_ps(_mm256_loadu_ps(&src[idx]), scale8);
+        __m256i const rounded = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(value, min8), max8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dst[idx]), rounded);
+    }
+
+    float_to_int32(&src[idx], &dst[idx], length - idx, scale, min, max);
+}
+
+__attribute__((target("avx2"))) static void float_to_float64_avx2(float const *const src, double *const dst,
+                                                                  uint32_t const length) {
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % 8;
+
+    for (; idx < simd_length; idx += 8) {
+        _mm256_storeu_pd(&dst[idx], _mm256_cvtps_pd(_mm_loadu_ps(&src[idx])));
+        _mm256_storeu_pd(&dst[idx + 4], _mm256_cvtps_pd(_mm_loadu_ps(&src[idx + 4])));
+    }
+
+    float_to_float64(&src[idx], &dst[idx], length - idx);
+}
+
+#endif
+
+#pragma mark - dispatch
+
+static kernels make_kernels() {
+#if YAS_AUDIO_CONVERT_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        return kernels{.int16_to_float = int16_to_float_avx2,
+                       .int32_to_float = int32_to_float_avx2,
+                       .float64_to_float = float64_to_float_avx2,
+                       .float_to_int16 = float_to_int16_avx2,
+                       .float_to_int32 = float_to_int32_avx2,
+                       .float_to_float64 = float_to_float64_avx2};
+    }
+#endif
+    return kernels{.int16_to_float = int16_to_float,
+                   .int32_to_float = int32_to_float,
+                   .float64_to_float = float64_to_float,
+                   .float_to_int16 = float_to_int16,
+                   .float_to_int32 = float_to_int32,
+                   .float_to_float64 = float_to_float64};
+}
+
+static kernels const &selected_kernels() {
+    static kernels const selected = make_kernels();
+    return selected;
+}
+
+#pragma mark - contiguous
+
+// int24 is handled as sign extended int32 values here.
+static void to_float32_contiguous(void const *const src, sample_type const src_type, float *const dst,
+                                  uint32_t const length) {
+    auto const &selected = selected_kernels();
+
+    switch (src_type) {
+        case sample_type::float32:
+            std::memcpy(dst, src, length * sizeof(float));
+            break;
+        case sample_type::float64:
+            selected.float64_to_float(static_cast<double const *>(src), dst, length);
+            break;
+        case sample_type::int16:
+            selected.int16_to_float(static_cast<int16_t const *>(src), dst, length, 1.0f / int16_scale);
+            break;
+        case sample_type::int24:
+            selected.int32_to_float(static_cast<int32_t const *>(src), dst, length, 1.0f / int24_scale);
+            break;
+        case sample_type::int32:
+            selected.int32_to_float(static_cast<int32_t const *>(src), dst, length, 1.0f / int32_scale);
+            break;
+        case sample_type::fixed824:
+            selected.int32_to_float(static_cast<int32_t const *>(src), dst, length, 1.0f / fixed824_scale);
+            break;
+    }
+}
+
+static void from_float32_contiguous(float const *const src, void *const dst, sample_type const dst_type,
+                                    uint32_t const length) {
+    auto const &selected = selected_kernels();
+
+    switch (dst_type) {
+        case sample_type::float32:
+            std::memcpy(dst, src, length * sizeof(float));
+            break;
+        case sample_type::float64:
+            selected.float_to_float64(src, static_cast<double *>(dst), length);
+            break;
+        case sample_type::int16:
+            selected.float_to_int16(src, static_cast<int16_t *>(dst), length);
+            break;
+        case sample_type::int24:
+            selected.float_to_int32(src, static_cast<int32_t *>(dst), length, int24_scale, -int24_scale,
+                                   int24_scale - 1.0f);
+            break;
+        case sample_type::int32:
+            selected.float_to_int32(src, static_cast<int32_t *>(dst), length, int32_scale, int32_min, int32_max);
+            break;
+        case sample_type::fixed824:
+            selected.float_to_int32(src, static_cast<int32_t *>(dst), length, fixed824_scale, int32_min, int32_max);
+            break;
+    }
+}
+
+#pragma mark - strided
+
+template <typename T>
+static void gather(T const *const src, uint32_t const src_stride, T *const dst, uint32_t const length) {
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        dst[idx] = src[idx * src_stride];
+    }
+}
+
+template <typename T>
+static void scatter(T const *const src, T *const dst, uint32_t const dst_stride, uint32_t const length) {
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        dst[idx * dst_stride] = src[idx];
+    }
+}
+
+static void gather(void const *const src, sample_type const src_type, uint32_t const src_stride, void *const dst,
+                   uint32_t const length) {
+    switch (src_type) {
+        case sample_type::float32:
+            gather(static_cast<float const *>(src), src_stride, static_cast<float *>(dst), length);
+            break;
+        case sample_type::float64:
+            gather(static_cast<double const *>(src), src_stride, static_cast<double *>(dst), length);
+            break;
+        case sample_type::int16:
+            gather(static_cast<int16_t const *>(src), src_stride, static_cast<int16_t *>(dst), length);
+            break;
+        case sample_type::int24: {
+            auto const *const src_data = static_cast<uint8_t const *>(src);
+            auto *const dst_data = static_cast<int32_t *>(dst);
+            for (uint32_t idx = 0; idx < length; ++idx) {
+                uint8_t const *const bytes = &src_data[idx * src_stride * 3];
+                uint32_t const value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16);
+                dst_data[idx] = static_cast<int32_t>(value << 8) >> 8;
+            }
+        } break;
+        case sample_type::int32:
+        case sample_type::fixed824:
+            gather(static_cast<int32_t const *>(src), src_stride, static_cast<int32_t *>(dst), length);
+            break;
+    }
+}
+
+static void scatter(void const *const src, void *const dst, sample_type const dst_type, uint32_t const dst_stride,
+                    uint32_t const length) {
+    switch (dst_type) {
+        case sample_type::float32:
+            scatter(static_cast<float const *>(src), static_cast<float *>(dst), dst_stride, length);
+            break;
+        case sample_type::float64:
+            scatter(static_cast<double const *>(src), static_cast<double *>(dst), dst_stride, length);
+            break;
+        case sample_type::int16:
+            scatter(static_cast<int16_t const *>(src), static_cast<int16_t *>(dst), dst_stride, length);
+            break;
+        case sample_type::int24: {
+            auto const *const src_data = static_cast<int32_t const *>(src);
+            auto *const dst_data = static_cast<uint8_t *>(dst);
+            for (uint32_t idx = 0; idx < length; ++idx) {
+                uint32_t const value = static_cast<uint32_t>(src_data[idx]);
+                uint8_t *const bytes = &dst_data[idx * dst_stride * 3];
+                bytes[0] = value & 0xFF;
+                bytes[1] = (value >> 8) & 0xFF;
+                bytes[2] = (value >> 16) & 0xFF;
+            }
+        } break;
+        case sample_type::int32:
+        case sample_type::fixed824:
+            scatter(static_cast<int32_t const *>(src), static_cast<int32_t *>(dst), dst_stride, length);
+            break;
+    }
+}
+
+static bool is_ditherable(sample_type const type) {
+    return type == sample_type::int16 || type == sample_type::int24;
+}
+
+static float dither_lsb(sample_type const type) {
+    return type == sample_type::int16 ? 1.0f / int16_scale : 1.0f / int24_scale;
+}
+
+template <typename T>
+static uint32_t apply_tpdf_dither(uint32_t state, T *const data, uint32_t const length, T const lsb) {
+    T const scale = lsb / T(4294967296.0);
+
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        state = state * 1664525u + 1013904223u;
+        uint32_t const first = state;
+        state = state * 1664525u + 1013904223u;
+        data[idx] += (static_cast<T>(first) - static_cast<T>(state)) * scale;
+    }
+
+    return state;
+}
+
+#pragma mark - float64
+
+// the samples of float64 and int32 have more bits than the mantissa of float32.
+static bool is_wider_than_float32(sample_type const type) {
+    return type == sample_type::float64 || type == sample_type::int32;
+}
+
+template <typename T>
+static void int_to_double(T const *const src, double *const dst, uint32_t const length, double const scale) {
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        dst[idx] = static_cast<double>(src[idx]) * scale;
+    }
+}
+
+template <typename T>
+static void double_to_int(double const *const src, T *const dst, uint32_t const length, double const scale,
+                          double const min, double const max) {
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        dst[idx] = static_cast<T>(std::llrint(std::clamp(src[idx] * scale, min, max)));
+    }
+}
+
+// int24 is handled as sign extended int32 values here.
+static void to_float64_contiguous(void const *const src, sample_type const src_type, double *const dst,
+                                  uint32_t const length) {
+    switch (src_type) {
+        case sample_type::float32: {
+            auto const *const src_data = static_cast<float const *>(src);
+            std::copy_n(src_data, length, dst);
+        } break;
+        case sample_type::float64:
+            std::memcpy(dst, src, length * sizeof(double));
+            break;
+        case sample_type::int16:
+            int_to_double(static_cast<int16_t const *>(src), dst, length, 1.0 / int16_scale);
+            break;
+        case sample_type::int24:
+            int_to_double(static_cast<int32_t const *>(src), dst, length, 1.0 / int24_scale);
+            break;
+        case sample_type::int32:
+            int_to_double(static_cast<int32_t const *>(src), dst, length, 1.0 / int32_scale);
+            break;
+        case sample_type::fixed824:
+            int_to_double(static_cast<int32_t const *>(src), dst, length, 1.0 / fixed824_scale);
+            break;
+    }
+}
+
+static void from_float64_contiguous(double const *const src, void *const dst, sample_type const dst_type,
+                                    uint32_t const length) {
+    switch (dst_type) {
+        case sample_type::float32: {
+            auto *const dst_data = static_cast<float *>(dst);
+            for (uint32_t idx = 0; idx < length; ++idx) {
+                dst_data[idx] = static_cast<float>(src[idx]);
+            }
+        } break;
+        case sample_type::float64:
+            std::memcpy(dst, src, length * sizeof(double));
+            break;
+        case sample_type::int16:
+            double_to_int(src, static_cast<int16_t *>(dst), length, int16_scale, -int16_scale, int16_scale - 1.0);
+            break;
+        case sample_type::int24:
+            double_to_int(src, static_cast<int32_t *>(dst), length, int24_scale, -int24_scale, int24_scale - 1.0);
+            break;
+        case sample_type::int32:
+            double_to_int(src, static_cast<int32_t *>(dst), length, int32_scale, -2147483648.0, 2147483647.0);
+            break;
+        case sample_type::fixed824:
+            double_to_int(src, static_cast<int32_t *>(dst), length, fixed824_scale, -2147483648.0, 2147483647.0);
+            break;
+    }
+}
+
+static void convert_via_float64(void const *const src, sample_type const src_type, uint32_t const src_stride,
+                                void *const dst, sample_type const dst_type, uint32_t const dst_stride,
+                                uint32_t const length, tpdf_dither *const dither) {
+    bool const is_dithering = dither && is_ditherable(dst_type);
+    bool const is_src_packed = src_stride == 1 && src_type != sample_type::int24;
+    bool const is_dst_packed = dst_stride == 1 && dst_type != sample_type::int24;
+
+    double intermediate[chunk_length];
+    alignas(16) uint8_t gathered[chunk_length * sizeof(double)];
+    alignas(16) uint8_t converted[chunk_length * sizeof(double)];
+    auto const *const src_data = static_cast<uint8_t const *>(src);
+    auto *const dst_data = static_cast<uint8_t *>(dst);
+    uint32_t const src_byte_count = sample_byte_count(src_type);
+    uint32_t const dst_byte_count = sample_byte_count(dst_type);
+
+    for (uint32_t begin = 0; begin < length; begin += chunk_length) {
+        uint32_t const length_in_chunk = std::min(chunk_length, length - begin);
+        uint8_t const *const chunk_src = &src_data[begin * src_stride * src_byte_count];
+        uint8_t *const chunk_dst = &dst_data[begin * dst_stride * dst_byte_count];
+
+        if (is_src_packed) {
+            to_float64_contiguous(chunk_src, src_type, intermediate, length_in_chunk);
+        } else {
+            gather(chunk_src, src_type, src_stride, gathered, length_in_chunk);
+            to_float64_contiguous(gathered, src_type, intermediate, length_in_chunk);
+        }
+
+        if (is_dithering) {
+            dither->apply(intermediate, length_in_chunk, dither_lsb(dst_type));
+        }
+
+        if (is_dst_packed) {
+            from_float64_contiguous(intermediate, chunk_dst, dst_type, length_in_chunk);
+        } else {
+            from_float64_contiguous(intermediate, converted, dst_type, length_in_chunk);
+            scatter(converted, chunk_dst, dst_type, dst_stride, length_in_chunk);
+        }
+    }
+}
+}  // namespace yas::audio::dsp::convert_utils
+
+#pragma mark - tpdf_dither
+
+dsp::tpdf_dither::tpdf_dither(uint32_t const seed) : _state(seed) {
+}
+
+void dsp::tpdf_dither::apply(float *const data, uint32_t const length, float const lsb) {
+    this->_state = convert_utils::apply_tpdf_dither(this->_state, data, length, lsb);
+}
+
+void dsp::tpdf_dither::apply(double *const data, uint32_t const length, double const lsb) {
+    this->_state = convert_utils::apply_tpdf_dither(this->_state, data, length, lsb);
+}
+
+#pragma mark -
+
+bool dsp::is_convertible_pcm_format(pcm_format const pcm_format) {
+    return to_dsp_sample_type(pcm_format).has_value();
+}
+
+std::optional<dsp::sample_type> dsp::to_dsp_sample_type(pcm_format const pcm_format) {
+    switch (pcm_format) {
+        case pcm_format::float32:
+            return sample_type::float32;
+        case pcm_format::float64:
+            return sample_type::float64;
+        case pcm_format::int16:
+            return sample_type::int16;
+        case pcm_format::fixed824:
+            return sample_type::fixed824;
+        case pcm_format::other:
+            return std::nullopt;
+    }
+}
+
+uint32_t dsp::sample_byte_count(sample_type const type) {
+    switch (type) {
+        case sample_type::float32:
+            return 4;
+        case sample_type::float64:
+            return 8;
+        case sample_type::int16:
+            return 2;
+        case sample_type::int24:
+            return 3;
+        case sample_type::int32:
+        case sample_type::fixed824:
+            return 4;
+    }
+}
+
+void dsp::convert_to_float32(void const *const src, sample_type const src_type, uint32_t const src_stride,
+                             float *const dst, uint32_t const length) {
+    if (src_stride == 1 && src_type != sample_type::int24) {
+        convert_utils::to_float32_contiguous(src, src_type, dst, length);
+        return;
+    }
+
+    alignas(16) uint8_t gathered[convert_utils::chunk_length * sizeof(double)];
+    auto const *const src_data = static_cast<uint8_t const *>(src);
+    uint32_t const src_byte_count = sample_byte_count(src_type);
+
+    for (uint32_t begin = 0; begin < length; begin += convert_utils::chunk_length) {
+        uint32_t const chunk_length = std::min(convert_utils::chunk_length, length - begin);
+        convert_utils::gather(&src_data[begin * src_stride * src_byte_count], src_type, src_stride, gathered,
+                              chunk_length);
+        convert_utils::to_float32_contiguous(gathered, src_type, &dst[begin], chunk_length);
+    }
+}
+
+void dsp::convert_from_float32(float const *const src, void *const dst, sample_type const dst_type,
+                               uint32_t const dst_stride, uint32_t const length, tpdf_dither *const dither) {
+    bool const is_dithering = dither && convert_utils::is_ditherable(dst_type);
+
+    if (dst_stride == 1 && dst_type != sample_type::int24 && !is_dithering) {
+        convert_utils::from_float32_contiguous(src, dst, dst_type, length);
+        return;
+    }
+
+    float dithered[convert_utils::chunk_length];
+    alignas(16) uint8_t converted[convert_utils::chunk_length * sizeof(double)];
+    auto *const dst_data = static_cast<uint8_t *>(dst);
+    uint32_t const dst_byte_count = sample_byte_count(dst_type);
+    bool const is_packed = dst_stride == 1 && dst_type != sample_type::int24;
+
+    for (uint32_t begin = 0; begin < length; begin += convert_utils::chunk_length) {
+        uint32_t const chunk_length = std::min(convert_utils::chunk_length, length - begin);
+        float const *chunk_src = &src[begin];
+        uint8_t *const chunk_dst = &dst_data[begin * dst_stride * dst_byte_count];
+
+        if (is_dithering) {
+            std::copy_n(chunk_src, chunk_length, dithered);
+            dither->apply(dithered, chunk_length, convert_utils::dither_lsb(dst_type));
+            chunk_src = dithered;
+        }
+
+        if (is_packed) {
+            convert_utils::from_float32_contiguous(chunk_src, chunk_dst, dst_type, chunk_length);
+        } else {
+            convert_utils::from_float32_contiguous(chunk_src, converted, dst_type, chunk_length);
+            convert_utils::scatter(converted, chunk_dst, dst_type, dst_stride, chunk_length);
+        }
+    }
+}
+
+void dsp::convert(void const *const src, sample_type const src_type, uint32_t const src_stride, void *const dst,
+                  sample_type const dst_type, uint32_t const dst_stride, uint32_t const length,
+                  tpdf_dither *const dither) {
+    if (src_type == sample_type::float32 && src_stride == 1) {
+        convert_from_float32(static_cast<float const *>(src), dst, dst_type, dst_stride, length, dither);
+        return;
+    }
+
+    if (dst_type == sample_type::float32 && dst_stride == 1) {
+        convert_to_float32(src, src_type, src_stride, static_cast<float *>(dst), length);
+        return;
+    }
+
+    if (convert_utils::is_wider_than_float32(src_type) || convert_utils::is_wider_than_float32(dst_type)) {
+        convert_utils::convert_via_float64(src, src_type, src_stride, dst, dst_type, dst_stride, length, dither);
+        return;
+    }
+
+    float intermediate[convert_utils::chunk_length];
+    auto const *const src_data = static_cast<uint8_t const *>(src);
+    auto *const dst_data = static_cast<uint8_t *>(dst);
+    uint32_t const src_byte_count = sample_byte_count(src_type);
+    uint32_t const dst_byte_count = sample_byte_count(dst_type);
+
+    for (uint32_t begin = 0; begin < length; begin += convert_utils::chunk_length) {
+        uint32_t const chunk_length = std::min(convert_utils::chunk_length, length - begin);
+        convert_to_float32(&src_data[begin * src_stride * src_byte_count], src_type, src_stride, intermediate,
+                           chunk_length);
+        convert_from_float32(intermediate, &dst_data[begin * dst_stride * dst_byte_count], dst_type, dst_stride,
+                             chunk_length, dither);
+    }
+}
+
+void dsp::convert_to_float32(void const *const src, pcm_format const src_pcm_format, uint32_t const src_stride,
+                             float *const dst, uint32_t const length) {
+    if (auto const src_type = to_dsp_sample_type(src_pcm_format)) {
+        convert_to_float32(src, *src_type, src_stride, dst, length);
+    } else {
+        std::fill_n(dst, length, 0.0f);
+    }
+}
+
+void dsp::convert_from_float32(float const *const src, void *const dst, pcm_format const dst_pcm_format,
+                               uint32_t const dst_stride, uint32_t const length) {
+    if (auto const dst_type = to_dsp_sample_type(dst_pcm_format)) {
+        convert_from_float32(src, dst, *dst_type, dst_stride, length);
+    }
+}
@@ -0,0 +1,49 @@
+//
+//  yas_audio_dsp_convert.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_types.h>
+
+#include <optional>
+
+namespace yas::audio::dsp {
+enum class sample_type {
+    float32,
+    float64,
+    int16,
+    int24,  // packed 3 bytes, little endian
+    int32,
+    fixed824,
+};
+
+struct tpdf_dither final {
+    explicit tpdf_dither(uint32_t const seed = 1);
+
+    void apply(float *const data, uint32_t const length, float const lsb);
+    void apply(double *const data, uint32_t const length, double const lsb);
+
+   private:
+    uint32_t _state;
+};
+
+[[nodiscard]] bool is_convertible_pcm_format(audio::pcm_format const);
+[[nodiscard]] std::optional<sample_type> to_dsp_sample_type(audio::pcm_format const);
+[[nodiscard]] uint32_t sample_byte_count(sample_type const);
+
+// strides are counted in samples. dither is applied only when narrowing to int16 or int24.
+// convert() goes through float64 instead of float32 when either side is float64 or int32 not to lose the low bits.
+void convert_to_float32(void const *const src, sample_type const src_type, uint32_t const src_stride,
+                        float *const dst, uint32_t const length);
+void convert_from_float32(float const *const src, void *const dst, sample_type const dst_type,
+                          uint32_t const dst_stride, uint32_t const length, tpdf_dither *const dither = nullptr);
+void convert(void const *const src, sample_type const src_type, uint32_t const src_stride, void *const dst,
+             sample_type const dst_type, uint32_t const dst_stride, uint32_t const length,
+             tpdf_dither *const dither = nullptr);
+
+void convert_to_float32(void const *const src, audio::pcm_format const src_pcm_format, uint32_t const src_stride,
+                        float *const dst, uint32_t const length);
+void convert_from_float32(float const *const src, void *const dst, audio::pcm_format const dst_pcm_format,
+                          uint32_t const dst_stride, uint32_t const length);
+}  // namespace yas::audio::dsp
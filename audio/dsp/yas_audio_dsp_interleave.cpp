@@ -0,0 +1,267 @@
+//
+//  yas_audio_dsp_interleave.cpp
+//
+
+#include "yas_audio_dsp_interleave.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "yas_audio_simd.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::dsp::interleave_utils {
+// frames per block. keeps the rows of a block in the L1 cache for up to 64 channels.
+static uint32_t constexpr block_length = 16;
+
+template <typename T>
+static void interleave(T const *const *const src, T *const dst, uint32_t const channel_count, uint32_t const length) {
+    for (uint32_t begin = 0; begin < length; begin += block_length) {
+        uint32_t const end = std::min(begin + block_length, length);
+
+        for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+            T const *const src_data = src[ch_idx];
+            T *const dst_data = &dst[ch_idx];
+
+            for (uint32_t frame = begin; frame < end; ++frame) {
+                dst_data[frame * channel_count] = src_data[frame];
+            }
+        }
+    }
+}
+
+template <typename T>
+static void deinterleave(T const *const src, T *const *const dst, uint32_t const channel_count,
+                         uint32_t const length) {
+    for (uint32_t begin = 0; begin < length; begin += block_length) {
+        uint32_t const end = std::min(begin + block_length, length);
+
+        for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+            T const *const src_data = &src[ch_idx];
+            T *const dst_data = dst[ch_idx];
+
+            for (uint32_t frame = begin; frame < end; ++frame) {
+                dst_data[frame] = src_data[frame * channel_count];
+            }
+        }
+    }
+}
+
+static void interleave_float2(float const *const *const src, float *const dst, uint32_t const length) {
+    float const *const left = src[0];
+    float const *const right = src[1];
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::float4 low, high;
+        simd::zip(simd::load(&left[idx]), simd::load(&right[idx]), low, high);
+        simd::store(&dst[idx * 2], low);
+        simd::store(&dst[idx * 2 + simd::float4_count], high);
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx * 2] = left[idx];
+        dst[idx * 2 + 1] = right[idx];
+    }
+}
+
+static void deinterleave_float2(float const *const src, float *const *const dst, uint32_t const length) {
+    float *const left = dst[0];
+    float *const right = dst[1];
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::float4 even, odd;
+        simd::unzip(simd::load(&src[idx * 2]), simd::load(&src[idx * 2 + simd::float4_count]), even, odd);
+        simd::store(&left[idx], even);
+        simd::store(&right[idx], odd);
+    }
+
+    for (; idx < length; ++idx) {
+        left[idx] = src[idx * 2];
+        right[idx] = src[idx * 2 + 1];
+    }
+}
+
+// channels are handled in groups of 4 with 4x4 transposes. leftover channels and frames are copied one by one.
+static void interleave_float(float const *const *const src, float *const dst, uint32_t const channel_count,
+                             uint32_t const length) {
+    uint32_t const group_channel_count = channel_count - channel_count % simd::float4_count;
+
+    for (uint32_t begin = 0; begin < length; begin += block_length) {
+        uint32_t const end = std::min(begin + block_length, length);
+        uint32_t const simd_end = end - (end - begin) % simd::float4_count;
+
+        for (uint32_t ch_idx = 0; ch_idx < group_channel_count; ch_idx += simd::float4_count) {
+            for (uint32_t frame = begin; frame < simd_end; frame += simd::float4_count) {
+                simd::float4 row0 = simd::load(&src[ch_idx][frame]);
+                simd::float4 row1 = simd::load(&src[ch_idx + 1][frame]);
+                simd::float4 row2 = simd::load(&src[ch_idx + 2][frame]);
+                simd::float4 row3 = simd::load(&src[ch_idx + 3][frame]);
+
+                simd::transpose(row0, row1, row2, row3);
+
+                float *const dst_data = &dst[frame * channel_count + ch_idx];
+                simd::store(dst_data, row0);
+                simd::store(&dst_data[channel_count], row1);
+                simd::store(&dst_data[channel_count * 2], row2);
+                simd::store(&dst_data[channel_count * 3], row3);
+            }
+
+            for (uint32_t frame = simd_end; frame < end; ++frame) {
+                for (uint32_t offset = 0; offset < simd::float4_count; ++offset) {
+                    dst[frame * channel_count + ch_idx + offset] = src[ch_idx + offset][frame];
+                }
+            }
+        }
+
+        for (uint32_t ch_idx = group_channel_count; ch_idx < channel_count; ++ch_idx) {
+            for (uint32_t frame = begin; frame < end; ++frame) {
+                dst[frame * channel_count + ch_idx] = src[ch_idx][frame];
+            }
+        }
+    }
+}
+
+static void deinterleave_float(float const *const src, float *const *const dst, uint32_t const channel_count,
+                               uint32_t const length) {
+    uint32_t const group_channel_count = channel_count - channel_count % simd::float4_count;
+
+    for (uint32_t begin = 0; begin < length; begin += block_length) {
+        uint32_t const end = std::min(begin + block_length, length);
+        uint32_t const simd_end = end - (end - begin) % simd::float4_count;
+
+        for (uint32_t ch_idx = 0; ch_idx < group_channel_count; ch_idx += simd::float4_count) {
+            for (uint32_t frame = begin; frame < simd_end; frame += simd::float4_count) {
+                float const *const src_data = &src[frame * channel_count + ch_idx];
+                simd::float4 row0 = simd::load(src_data);
+                simd::float4 row1 = simd::load(&src_data[channel_count]);
+                simd::float4 row2 = simd::load(&src_data[channel_count * 2]);
+                simd::float4 row3 = simd::load(&src_data[channel_count * 3]);
+
+                simd::transpose(row0, row1, row2, row3);
+
+                simd::store(&dst[ch_idx][frame], row0);
+                simd::store(&dst[ch_idx + 1][frame], row1);
+                simd::store(&dst[ch_idx + 2][frame], row2);
+                simd::store(&dst[ch_idx + 3][frame], row3);
+            }
+
+            for (uint32_t frame = simd_end; frame < end; ++frame) {
+                for (uint32_t offset = 0; offset < simd::float4_count; ++offset) {
+                    dst[ch_idx + offset][frame] = src[frame * channel_count + ch_idx + offset];
+                }
+            }
+        }
+
+        for (uint32_t ch_idx = group_channel_count; ch_idx < channel_count; ++ch_idx) {
+            for (uint32_t frame = begin; frame < end; ++frame) {
+                dst[ch_idx][frame] = src[frame * channel_count + ch_idx];
+            }
+        }
+    }
+}
+
+static void interleave_bytes(uint8_t const *const *const src, uint8_t *const dst, uint32_t const channel_count,
+                             uint32_t const length, uint32_t const sample_byte_count) {
+    uint32_t const frame_byte_count = channel_count * sample_byte_count;
+
+    for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+        for (uint32_t frame = 0; frame < length; ++frame) {
+            std::memcpy(&dst[frame * frame_byte_count + ch_idx * sample_byte_count],
+                        &src[ch_idx][frame * sample_byte_count], sample_byte_count);
+        }
+    }
+}
+
+static void deinterleave_bytes(uint8_t const *const src, uint8_t *const *const dst, uint32_t const channel_count,
+                               uint32_t const length, uint32_t const sample_byte_count) {
+    uint32_t const frame_byte_count = channel_count * sample_byte_count;
+
+    for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+        for (uint32_t frame = 0; frame < length; ++frame) {
+            std::memcpy(&dst[ch_idx][frame * sample_byte_count],
+                        &src[frame * frame_byte_count + ch_idx * sample_byte_count], sample_byte_count);
+        }
+    }
+}
+}  // namespace yas::audio::dsp::interleave_utils
+
+void dsp::interleave(void const *const *const src, void *const dst, uint32_t const channel_count,
+                     uint32_t const length, uint32_t const sample_byte_count) {
+    if (channel_count == 0 || length == 0) {
+        return;
+    }
+
+    if (channel_count == 1) {
+        std::memcpy(dst, src[0], length * sample_byte_count);
+        return;
+    }
+
+    switch (sample_byte_count) {
+        case 2:
+            interleave_utils::interleave(reinterpret_cast<int16_t const *const *>(src), static_cast<int16_t *>(dst),
+                                         channel_count, length);
+            break;
+        case 4: {
+            auto const *const float_src = reinterpret_cast<float const *const *>(src);
+            auto *const float_dst = static_cast<float *>(dst);
+            if (channel_count == 2) {
+                interleave_utils::interleave_float2(float_src, float_dst, length);
+            } else {
+                interleave_utils::interleave_float(float_src, float_dst, channel_count, length);
+            }
+        } break;
+        case 8:
+            interleave_utils::interleave(reinterpret_cast<double const *const *>(src), static_cast<double *>(dst),
+                                         channel_count, length);
+            break;
+        default:
+            interleave_utils::interleave_bytes(reinterpret_cast<uint8_t const *const *>(src),
+                                               static_cast<uint8_t *>(dst), channel_count, length, sample_byte_count);
+            break;
+    }
+}
+
+void dsp::deinterleave(void const *const src, void *const *const dst, uint32_t const channel_count,
+                       uint32_t const length, uint32_t const sample_byte_count) {
+    if (channel_count == 0 || length == 0) {
+        return;
+    }
+
+    if (channel_count == 1) {
+        std::memcpy(dst[0], src, length * sample_byte_count);
+        return;
+    }
+
+    switch (sample_byte_count) {
+        case 2:
+            interleave_utils::deinterleave(static_cast<int16_t const *>(src), reinterpret_cast<int16_t *const *>(dst),
+                                           channel_count, length);
+            break;
+        case 4: {
+            auto const *const float_src = static_cast<float const *>(src);
+            auto *const *const float_dst = reinterpret_cast<float *const *>(dst);
+            if (channel_count == 2) {
+                interleave_utils::deinterleave_float2(float_src, float_dst, length);
+            } else {
+                interleave_utils::deinterleave_float(float_src, float_dst, channel_count, length);
+            }
+        } break;
+        case 8:
+            interleave_utils::deinterleave(static_cast<double const *>(src), reinterpret_cast<double *const *>(dst),
+                                           channel_count, length);
+            break;
+        default:
+            interleave_utils::deinterleave_bytes(static_cast<uint8_t const *>(src),
+                                                 reinterpret_cast<uint8_t *const *>(dst), channel_count, length,
+                                                 sample_byte_count);
+            break;
+    }
+}
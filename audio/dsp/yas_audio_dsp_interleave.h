@@ -0,0 +1,14 @@
+//
+//  yas_audio_dsp_interleave.h
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace yas::audio::dsp {
+void interleave(void const *const *const src, void *const dst, uint32_t const channel_count, uint32_t const length,
+                uint32_t const sample_byte_count);
+void deinterleave(void const *const src, void *const *const dst, uint32_t const channel_count, uint32_t const length,
+                  uint32_t const sample_byte_count);
+}  // namespace yas::audio::dsp
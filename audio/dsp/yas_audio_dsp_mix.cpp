@@ -0,0 +1,123 @@
+//
+//  yas_audio_dsp_mix.cpp
+//
+
+#include "yas_audio_dsp_mix.h"
+
+#include "yas_audio_simd.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+void dsp::scale(float *const data, uint32_t const length, float const gain) {
+    simd::float4 const gain4 = simd::splat(gain);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store(&data[idx], simd::mul(simd::load(&data[idx]), gain4));
+    }
+
+    for (; idx < length; ++idx) {
+        data[idx] *= gain;
+    }
+}
+
+void dsp::scale_ramp(float *const data, uint32_t const length, float const start_gain, float const end_gain) {
+    if (length == 0) {
+        return;
+    }
+
+    if (start_gain == end_gain) {
+        dsp::scale(data, length, start_gain);
+        return;
+    }
+
+    float const step = (end_gain - start_gain) / static_cast<float>(length);
+    simd::float4 const step4 = simd::splat(step * simd::float4_count);
+    simd::float4 gain4 = simd::ramp(start_gain, step);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store(&data[idx], simd::mul(simd::load(&data[idx]), gain4));
+        gain4 = simd::add(gain4, step4);
+    }
+
+    for (; idx < length; ++idx) {
+        data[idx] *= start_gain + step * static_cast<float>(idx);
+    }
+}
+
+void dsp::mix(float const *const src, float *const dst, uint32_t const length, float const gain) {
+    if (gain == 0.0f) {
+        return;
+    }
+
+    simd::float4 const gain4 = simd::splat(gain);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store(&dst[idx], simd::madd(simd::load(&dst[idx]), simd::load(&src[idx]), gain4));
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] += src[idx] * gain;
+    }
+}
+
+void dsp::mix_ramp(float const *const src, float *const dst, uint32_t const length, float const start_gain,
+                   float const end_gain) {
+    if (length == 0) {
+        return;
+    }
+
+    if (start_gain == end_gain) {
+        dsp::mix(src, dst, length, start_gain);
+        return;
+    }
+
+    float const step = (end_gain - start_gain) / static_cast<float>(length);
+    simd::float4 const step4 = simd::splat(step * simd::float4_count);
+    simd::float4 gain4 = simd::ramp(start_gain, step);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::store(&dst[idx], simd::madd(simd::load(&dst[idx]), simd::load(&src[idx]), gain4));
+        gain4 = simd::add(gain4, step4);
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] += src[idx] * (start_gain + step * static_cast<float>(idx));
+    }
+}
+
+void dsp::crossfade(float const *const src, float *const dst, uint32_t const length, float const start_position,
+                    float const end_position) {
+    if (length == 0) {
+        return;
+    }
+
+    float const step = (end_position - start_position) / static_cast<float>(length);
+    simd::float4 const step4 = simd::splat(step * simd::float4_count);
+    simd::float4 position4 = simd::ramp(start_position, step);
+
+    uint32_t idx = 0;
+    uint32_t const simd_length = length - length % simd::float4_count;
+
+    for (; idx < simd_length; idx += simd::float4_count) {
+        simd::float4 const dst4 = simd::load(&dst[idx]);
+        simd::store(&dst[idx], simd::madd(dst4, simd::sub(simd::load(&src[idx]), dst4), position4));
+        position4 = simd::add(position4, step4);
+    }
+
+    for (; idx < length; ++idx) {
+        dst[idx] += (src[idx] - dst[idx]) * (start_position + step * static_cast<float>(idx));
+    }
+}
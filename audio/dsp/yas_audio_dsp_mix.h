@@ -0,0 +1,20 @@
+//
+//  yas_audio_dsp_mix.h
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace yas::audio::dsp {
+void scale(float *const data, uint32_t const length, float const gain);
+void scale_ramp(float *const data, uint32_t const length, float const start_gain, float const end_gain);
+
+void mix(float const *const src, float *const dst, uint32_t const length, float const gain);
+void mix_ramp(float const *const src, float *const dst, uint32_t const length, float const start_gain,
+              float const end_gain);
+
+// moves dst toward src. a position of 0 keeps dst and 1 replaces it with src.
+void crossfade(float const *const src, float *const dst, uint32_t const length, float const start_position,
+               float const end_position);
+}  // namespace yas::audio::dsp
@@ -0,0 +1,313 @@
+//
+//  yas_audio_dsp_resampler.cpp
+//
+
+#include "yas_audio_dsp_resampler.h"
+
+#include <cpp_utils/yas_fast_each.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "yas_audio_simd.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::dsp::resampler_utils {
+static uint32_t constexpr max_phase_count = 4096;
+
+struct quality_parameters {
+    uint32_t zero_crossings;
+    double kaiser_beta;
+    double rolloff;
+};
+
+static quality_parameters parameters(resampler_quality const quality) {
+    switch (quality) {
+        case resampler_quality::low:
+            return {.zero_crossings = 8, .kaiser_beta = 6.0, .rolloff = 0.9};
+        case resampler_quality::medium:
+            return {.zero_crossings = 16, .kaiser_beta = 8.0, .rolloff = 0.94};
+        case resampler_quality::high:
+            return {.zero_crossings = 32, .kaiser_beta = 10.0, .rolloff = 0.97};
+    }
+}
+
+static std::optional<uint32_t> integral_rate(double const sample_rate) {
+    double const rounded = std::round(sample_rate);
+    if (rounded <= 0.0 || std::fabs(sample_rate - rounded) > 1.0e-6) {
+        return std::nullopt;
+    }
+    return static_cast<uint32_t>(rounded);
+}
+
+static std::optional<std::pair<uint32_t, uint32_t>> ratio(double const input_sample_rate,
+                                                          double const output_sample_rate) {
+    auto const input_rate = integral_rate(input_sample_rate);
+    auto const output_rate = integral_rate(output_sample_rate);
+    if (!input_rate || !output_rate) {
+        return std::nullopt;
+    }
+
+    uint32_t const gcd = std::gcd(*input_rate, *output_rate);
+    uint32_t const up = *output_rate / gcd;
+    uint32_t const down = *input_rate / gcd;
+
+    if (up > max_phase_count) {
+        return std::nullopt;
+    }
+
+    return std::make_pair(up, down);
+}
+
+static double bessel_i0(double const x) {
+    double sum = 1.0;
+    double term = 1.0;
+    double const half_x = x * 0.5;
+
+    for (uint32_t k = 1; k < 64; ++k) {
+        term *= (half_x / k) * (half_x / k);
+        sum += term;
+        if (term < sum * 1.0e-12) {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+static double kaiser(double const x, double const beta, double const i0_beta) {
+    if (std::fabs(x) >= 1.0) {
+        return 0.0;
+    }
+    return bessel_i0(beta * std::sqrt(1.0 - x * x)) / i0_beta;
+}
+
+static double sinc(double const x) {
+    if (std::fabs(x) < 1.0e-12) {
+        return 1.0;
+    }
+    double const pi_x = M_PI * x;
+    return std::sin(pi_x) / pi_x;
+}
+}  // namespace yas::audio::dsp::resampler_utils
+
+struct dsp::resampler::filter_table {
+    uint32_t const up;
+    uint32_t const down;
+    uint32_t const tap_count;
+    uint32_t const prefix_length;
+    std::vector<float> coefficients;
+
+    filter_table(uint32_t const up, uint32_t const down, uint32_t const half_length)
+        : up(up),
+          down(down),
+          tap_count((half_length * 2 + simd::float4_count - 1) / simd::float4_count * simd::float4_count),
+          prefix_length(half_length - 1),
+          coefficients(static_cast<std::size_t>(up) * tap_count, 0.0f) {
+    }
+
+    float const *phase_coefficients(uint32_t const phase) const {
+        return &this->coefficients[static_cast<std::size_t>(phase) * this->tap_count];
+    }
+
+    static std::shared_ptr<filter_table const> make_shared(uint32_t const up, uint32_t const down,
+                                                           resampler_quality const quality) {
+        static std::mutex mutex;
+        static std::map<std::tuple<uint32_t, uint32_t, resampler_quality>, std::weak_ptr<filter_table const>> cache;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto const key = std::make_tuple(up, down, quality);
+        if (auto const it = cache.find(key); it != cache.end()) {
+            if (auto const table = it->second.lock()) {
+                return table;
+            }
+        }
+
+        // drops the entries of the tables released by all the resamplers.
+        for (auto it = cache.begin(); it != cache.end();) {
+            it = it->second.expired() ? cache.erase(it) : std::next(it);
+        }
+
+        auto const table = make_table(up, down, quality);
+        cache.emplace(key, table);
+        return table;
+    }
+
+   private:
+    static std::shared_ptr<filter_table const> make_table(uint32_t const up, uint32_t const down,
+                                                          resampler_quality const quality) {
+        auto const params = resampler_utils::parameters(quality);
+        double const scale = std::min(1.0, static_cast<double>(up) / static_cast<double>(down));
+        double const cutoff = scale * params.rolloff;
+        uint32_t const half_length = static_cast<uint32_t>(std::ceil(params.zero_crossings / scale));
+        double const i0_beta = resampler_utils::bessel_i0(params.kaiser_beta);
+
+        auto table = std::make_shared<filter_table>(up, down, half_length);
+
+        auto phase_each = make_fast_each(up);
+        while (yas_each_next(phase_each)) {
+            uint32_t const phase = yas_each_index(phase_each);
+            float *const coefficients = &table->coefficients[static_cast<std::size_t>(phase) * table->tap_count];
+            double const fraction = static_cast<double>(phase) / static_cast<double>(up);
+            double sum = 0.0;
+
+            auto tap_each = make_fast_each(half_length * 2);
+            while (yas_each_next(tap_each)) {
+                uint32_t const tap = yas_each_index(tap_each);
+                double const x = fraction + static_cast<double>(half_length) - 1.0 - static_cast<double>(tap);
+                double const window =
+                    resampler_utils::kaiser(x / static_cast<double>(half_length), params.kaiser_beta, i0_beta);
+                double const value = cutoff * resampler_utils::sinc(cutoff * x) * window;
+                coefficients[tap] = static_cast<float>(value);
+                sum += value;
+            }
+
+            if (sum != 0.0) {
+                auto normalize_each = make_fast_each(half_length * 2);
+                while (yas_each_next(normalize_each)) {
+                    coefficients[yas_each_index(normalize_each)] /= static_cast<float>(sum);
+                }
+            }
+        }
+
+        return table;
+    }
+};
+
+dsp::resampler::resampler(double const input_sample_rate, double const output_sample_rate,
+                          uint32_t const channel_count, uint32_t const input_frame_capacity,
+                          resampler_quality const quality)
+    : _table([&input_sample_rate, &output_sample_rate, &quality] {
+          auto const ratio = resampler_utils::ratio(input_sample_rate, output_sample_rate);
+          if (!ratio) {
+              throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : unsupported sample rates. input(" +
+                                          std::to_string(input_sample_rate) + ") output(" +
+                                          std::to_string(output_sample_rate) + ")");
+          }
+          return filter_table::make_shared(ratio->first, ratio->second, quality);
+      }()),
+      _channel_count(channel_count),
+      _buffer_capacity(input_frame_capacity + this->_table->tap_count),
+      _buffers(channel_count, std::vector<float>(this->_buffer_capacity, 0.0f)) {
+    if (channel_count == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : channel_count is zero.");
+    }
+
+    this->reset();
+}
+
+uint32_t dsp::resampler::channel_count() const {
+    return this->_channel_count;
+}
+
+uint32_t dsp::resampler::tap_count() const {
+    return this->_table->tap_count;
+}
+
+uint32_t dsp::resampler::required_input_frames(uint32_t const output_length) const {
+    if (output_length == 0) {
+        return 0;
+    }
+
+    filter_table const &table = *this->_table;
+    uint64_t const advance =
+        (static_cast<uint64_t>(this->_phase) + static_cast<uint64_t>(output_length - 1) * table.down) / table.up;
+    uint64_t const last = this->_input_idx + advance + table.tap_count;
+
+    return (last > this->_buffered_length) ? static_cast<uint32_t>(last - this->_buffered_length) : 0;
+}
+
+uint32_t dsp::resampler::available_output_frames() const {
+    filter_table const &table = *this->_table;
+
+    if (this->_buffered_length < this->_input_idx + table.tap_count) {
+        return 0;
+    }
+
+    uint64_t const room = this->_buffered_length - table.tap_count - this->_input_idx;
+    uint64_t const limit = (room + 1) * table.up - this->_phase;
+
+    return static_cast<uint32_t>((limit + table.down - 1) / table.down);
+}
+
+uint32_t dsp::resampler::push(float const *const *const input, uint32_t const length) {
+    uint32_t const copy_length = std::min(length, this->_buffer_capacity - this->_buffered_length);
+
+    if (copy_length > 0) {
+        auto each = make_fast_each(this->_channel_count);
+        while (yas_each_next(each)) {
+            auto const &ch_idx = yas_each_index(each);
+            std::memcpy(&this->_buffers[ch_idx][this->_buffered_length], input[ch_idx], copy_length * sizeof(float));
+        }
+        this->_buffered_length += copy_length;
+    }
+
+    return copy_length;
+}
+
+uint32_t dsp::resampler::pull(float *const *const output, uint32_t const length) {
+    filter_table const &table = *this->_table;
+    uint32_t const tap_count = table.tap_count;
+    uint32_t const out_length = std::min(length, this->available_output_frames());
+
+    auto frame_each = make_fast_each(out_length);
+    while (yas_each_next(frame_each)) {
+        auto const &frame_idx = yas_each_index(frame_each);
+        float const *const coefficients = table.phase_coefficients(this->_phase);
+
+        auto ch_each = make_fast_each(this->_channel_count);
+        while (yas_each_next(ch_each)) {
+            auto const &ch_idx = yas_each_index(ch_each);
+            float const *const src = &this->_buffers[ch_idx][this->_input_idx];
+            simd::float4 acc = simd::splat(0.0f);
+
+            for (uint32_t tap = 0; tap < tap_count; tap += simd::float4_count) {
+                acc = simd::madd(acc, simd::load(&src[tap]), simd::load(&coefficients[tap]));
+            }
+
+            output[ch_idx][frame_idx] = simd::sum(acc);
+        }
+
+        this->_phase += table.down;
+        this->_input_idx += this->_phase / table.up;
+        this->_phase %= table.up;
+    }
+
+    if (this->_input_idx > 0) {
+        uint32_t const remain = this->_buffered_length - this->_input_idx;
+
+        for (auto &buffer : this->_buffers) {
+            std::memmove(buffer.data(), &buffer[this->_input_idx], remain * sizeof(float));
+        }
+
+        this->_buffered_length = remain;
+        this->_input_idx = 0;
+    }
+
+    return out_length;
+}
+
+void dsp::resampler::reset() {
+    for (auto &buffer : this->_buffers) {
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+    }
+
+    this->_buffered_length = this->_table->prefix_length;
+    this->_input_idx = 0;
+    this->_phase = 0;
+}
+
+bool dsp::resampler::is_supported(double const input_sample_rate, double const output_sample_rate) {
+    return resampler_utils::ratio(input_sample_rate, output_sample_rate).has_value();
+}
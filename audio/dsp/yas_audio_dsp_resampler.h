@@ -0,0 +1,46 @@
+//
+//  yas_audio_dsp_resampler.h
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace yas::audio::dsp {
+enum class resampler_quality {
+    low,
+    medium,
+    high,
+};
+
+struct resampler final {
+    struct filter_table;
+
+    resampler(double const input_sample_rate, double const output_sample_rate, uint32_t const channel_count,
+              uint32_t const input_frame_capacity, resampler_quality const quality = resampler_quality::medium);
+
+    [[nodiscard]] uint32_t channel_count() const;
+    [[nodiscard]] uint32_t tap_count() const;
+
+    [[nodiscard]] uint32_t required_input_frames(uint32_t const output_length) const;
+    [[nodiscard]] uint32_t available_output_frames() const;
+
+    uint32_t push(float const *const *const input, uint32_t const length);
+    uint32_t pull(float *const *const output, uint32_t const length);
+
+    void reset();
+
+    [[nodiscard]] static bool is_supported(double const input_sample_rate, double const output_sample_rate);
+
+   private:
+    std::shared_ptr<filter_table const> _table;
+    uint32_t const _channel_count;
+    uint32_t const _buffer_capacity;
+    std::vector<std::vector<float>> _buffers;
+    uint32_t _buffered_length;
+    uint32_t _input_idx;
+    uint32_t _phase;
+};
+}  // namespace yas::audio::dsp
@@ -0,0 +1,383 @@
+//
+//  yas_audio_simd.h
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define YAS_AUDIO_SIMD_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define YAS_AUDIO_SIMD_SSE 1
+#endif
+
+namespace yas::audio::simd {
+static uint32_t constexpr float4_count = 4;
+
+#if YAS_AUDIO_SIMD_NEON
+
+using float4 = float32x4_t;
+
+inline float4 load(float const *const ptr) {
+    return vld1q_f32(ptr);
+}
+
+inline void store(float *const ptr, float4 const value) {
+    vst1q_f32(ptr, value);
+}
+
+inline float4 splat(float const value) {
+    return vdupq_n_f32(value);
+}
+
+inline float4 add(float4 const lhs, float4 const rhs) {
+    return vaddq_f32(lhs, rhs);
+}
+
+inline float4 sub(float4 const lhs, float4 const rhs) {
+    return vsubq_f32(lhs, rhs);
+}
+
+inline float4 mul(float4 const lhs, float4 const rhs) {
+    return vmulq_f32(lhs, rhs);
+}
+
+inline float4 madd(float4 const acc, float4 const lhs, float4 const rhs) {
+    return vmlaq_f32(acc, lhs, rhs);
+}
+
+inline float4 ramp(float const start, float const step) {
+    float const values[4] = {start, start + step, start + step * 2.0f, start + step * 3.0f};
+    return vld1q_f32(values);
+}
+
+inline float sum(float4 const value) {
+#if defined(__aarch64__)
+    return vaddvq_f32(value);
+#else
+    float32x2_t const pair = vadd_f32(vget_low_f32(value), vget_high_f32(value));
+    return vget_lane_f32(vpadd_f32(pair, pair), 0);
+#endif
+}
+
+inline float4 min(float4 const lhs, float4 const rhs) {
+    return vminq_f32(lhs, rhs);
+}
+
+inline float4 max(float4 const lhs, float4 const rhs) {
+    return vmaxq_f32(lhs, rhs);
+}
+
+inline float4 abs(float4 const value) {
+    return vabsq_f32(value);
+}
+
+inline float reduce_max(float4 const value) {
+#if defined(__aarch64__)
+    return vmaxvq_f32(value);
+#else
+    float32x2_t const pair = vpmax_f32(vget_low_f32(value), vget_high_f32(value));
+    return vget_lane_f32(vpmax_f32(pair, pair), 0);
+#endif
+}
+
+inline float4 load_int16(int16_t const *const ptr) {
+    return vcvtq_f32_s32(vmovl_s16(vld1_s16(ptr)));
+}
+
+inline float4 load_int32(int32_t const *const ptr) {
+    return vcvtq_f32_s32(vld1q_s32(ptr));
+}
+
+inline int32x4_t round_int32(float4 const value) {
+#if defined(__aarch64__)
+    return vcvtnq_s32_f32(value);
+#else
+    float values[4];
+    vst1q_f32(values, value);
+    int32_t rounded[4];
+    for (uint32_t idx = 0; idx < 4; ++idx) {
+        rounded[idx] = static_cast<int32_t>(std::lrint(values[idx]));
+    }
+    return vld1q_s32(rounded);
+#endif
+}
+
+inline void store_int16(int16_t *const ptr, float4 const value) {
+    vst1_s16(ptr, vqmovn_s32(round_int32(value)));
+}
+
+inline void store_int32(int32_t *const ptr, float4 const value) {
+    vst1q_s32(ptr, round_int32(value));
+}
+
+inline float4 load_float64(double const *const ptr) {
+#if defined(__aarch64__)
+    return vcombine_f32(vcvt_f32_f64(vld1q_f64(ptr)), vcvt_f32_f64(vld1q_f64(ptr + 2)));
+#else
+    float const values[4] = {static_cast<float>(ptr[0]), static_cast<float>(ptr[1]), static_cast<float>(ptr[2]),
+                             static_cast<float>(ptr[3])};
+    return vld1q_f32(values);
+#endif
+}
+
+inline void store_float64(double *const ptr, float4 const value) {
+#if defined(__aarch64__)
+    vst1q_f64(ptr, vcvt_f64_f32(vget_low_f32(value)));
+    vst1q_f64(ptr + 2, vcvt_high_f64_f32(value));
+#else
+    float values[4];
+    vst1q_f32(values, value);
+    ptr[0] = values[0];
+    ptr[1] = values[1];
+    ptr[2] = values[2];
+    ptr[3] = values[3];
+#endif
+}
+
+inline void zip(float4 const lhs, float4 const rhs, float4 &low, float4 &high) {
+    float32x4x2_t const zipped = vzipq_f32(lhs, rhs);
+    low = zipped.val[0];
+    high = zipped.val[1];
+}
+
+inline void unzip(float4 const low, float4 const high, float4 &even, float4 &odd) {
+    float32x4x2_t const unzipped = vuzpq_f32(low, high);
+    even = unzipped.val[0];
+    odd = unzipped.val[1];
+}
+
+inline void transpose(float4 &row0, float4 &row1, float4 &row2, float4 &row3) {
+    float32x4x2_t const t01 = vtrnq_f32(row0, row1);
+    float32x4x2_t const t23 = vtrnq_f32(row2, row3);
+    row0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    row1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    row2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    row3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+#elif YAS_AUDIO_SIMD_SSE
+
+using float4 = __m128;
+
+inline float4 load(float const *const ptr) {
+    return _mm_loadu_ps(ptr);
+}
+
+inline void store(float *const ptr, float4 const value) {
+    _mm_storeu_ps(ptr, value);
+}
+
+inline float4 splat(float const value) {
+    return _mm_set1_ps(value);
+}
+
+inline float4 add(float4 const lhs, float4 const rhs) {
+    return _mm_add_ps(lhs, rhs);
+}
+
+inline float4 sub(float4 const lhs, float4 const rhs) {
+    return _mm_sub_ps(lhs, rhs);
+}
+
+inline float4 mul(float4 const lhs, float4 const rhs) {
+    return _mm_mul_ps(lhs, rhs);
+}
+
+inline float4 madd(float4 const acc, float4 const lhs, float4 const rhs) {
+    return _mm_add_ps(acc, _mm_mul_ps(lhs, rhs));
+}
+
+inline float4 ramp(float const start, float const step) {
+    return _mm_setr_ps(start, start + step, start + step * 2.0f, start + step * 3.0f);
+}
+
+inline float sum(float4 const value) {
+    __m128 const high = _mm_movehl_ps(value, value);
+    __m128 const pair = _mm_add_ps(value, high);
+    return _mm_cvtss_f32(_mm_add_ss(pair, _mm_shuffle_ps(pair, pair, 1)));
+}
+
+inline float4 min(float4 const lhs, float4 const rhs) {
+    return _mm_min_ps(lhs, rhs);
+}
+
+inline float4 max(float4 const lhs, float4 const rhs) {
+    return _mm_max_ps(lhs, rhs);
+}
+
+inline float4 abs(float4 const value) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+}
+
+inline float reduce_max(float4 const value) {
+    __m128 const high = _mm_movehl_ps(value, value);
+    __m128 const pair = _mm_max_ps(value, high);
+    return _mm_cvtss_f32(_mm_max_ss(pair, _mm_shuffle_ps(pair, pair, 1)));
+}
+
+inline float4 load_int16(int16_t const *const ptr) {
+    __m128i const value = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(ptr));
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16));
+}
+
+inline float4 load_int32(int32_t const *const ptr) {
+    return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr)));
+}
+
+inline void store_int16(int16_t *const ptr, float4 const value) {
+    __m128i const rounded = _mm_cvtps_epi32(value);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(ptr), _mm_packs_epi32(rounded, rounded));
+}
+
+inline void store_int32(int32_t *const ptr, float4 const value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), _mm_cvtps_epi32(value));
+}
+
+inline float4 load_float64(double const *const ptr) {
+    return _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(ptr)), _mm_cvtpd_ps(_mm_loadu_pd(ptr + 2)));
+}
+
+inline void store_float64(double *const ptr, float4 const value) {
+    _mm_storeu_pd(ptr, _mm_cvtps_pd(value));
+    _mm_storeu_pd(ptr + 2, _mm_cvtps_pd(_mm_movehl_ps(value, value)));
+}
+
+inline void zip(float4 const lhs, float4 const rhs, float4 &low, float4 &high) {
+    low = _mm_unpacklo_ps(lhs, rhs);
+    high = _mm_unpackhi_ps(lhs, rhs);
+}
+
+inline void unzip(float4 const low, float4 const high, float4 &even, float4 &odd) {
+    even = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+    odd = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+inline void transpose(float4 &row0, float4 &row1, float4 &row2, float4 &row3) {
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+}
+
+#else
+
+struct float4 {
+    float v[4];
+};
+
+inline float4 load(float const *const ptr) {
+    return float4{{ptr[0], ptr[1], ptr[2], ptr[3]}};
+}
+
+inline void store(float *const ptr, float4 const value) {
+    ptr[0] = value.v[0];
+    ptr[1] = value.v[1];
+    ptr[2] = value.v[2];
+    ptr[3] = value.v[3];
+}
+
+inline float4 splat(float const value) {
+    return float4{{value, value, value, value}};
+}
+
+inline float4 add(float4 const lhs, float4 const rhs) {
+    return float4{{lhs.v[0] + rhs.v[0], lhs.v[1] + rhs.v[1], lhs.v[2] + rhs.v[2], lhs.v[3] + rhs.v[3]}};
+}
+
+inline float4 sub(float4 const lhs, float4 const rhs) {
+    return float4{{lhs.v[0] - rhs.v[0], lhs.v[1] - rhs.v[1], lhs.v[2] - rhs.v[2], lhs.v[3] - rhs.v[3]}};
+}
+
+inline float4 mul(float4 const lhs, float4 const rhs) {
+    return float4{{lhs.v[0] * rhs.v[0], lhs.v[1] * rhs.v[1], lhs.v[2] * rhs.v[2], lhs.v[3] * rhs.v[3]}};
+}
+
+inline float4 madd(float4 const acc, float4 const lhs, float4 const rhs) {
+    return add(acc, mul(lhs, rhs));
+}
+
+inline float4 ramp(float const start, float const step) {
+    return float4{{start, start + step, start + step * 2.0f, start + step * 3.0f}};
+}
+
+inline float sum(float4 const value) {
+    return (value.v[0] + value.v[1]) + (value.v[2] + value.v[3]);
+}
+
+inline float4 min(float4 const lhs, float4 const rhs) {
+    return float4{{std::fmin(lhs.v[0], rhs.v[0]), std::fmin(lhs.v[1], rhs.v[1]), std::fmin(lhs.v[2], rhs.v[2]),
+                   std::fmin(lhs.v[3], rhs.v[3])}};
+}
+
+inline float4 max(float4 const lhs, float4 const rhs) {
+    return float4{{std::fmax(lhs.v[0], rhs.v[0]), std::fmax(lhs.v[1], rhs.v[1]), std::fmax(lhs.v[2], rhs.v[2]),
+                   std::fmax(lhs.v[3], rhs.v[3])}};
+}
+
+inline float4 abs(float4 const value) {
+    return float4{{std::fabs(value.v[0]), std::fabs(value.v[1]), std::fabs(value.v[2]), std::fabs(value.v[3])}};
+}
+
+inline float reduce_max(float4 const value) {
+    return std::fmax(std::fmax(value.v[0], value.v[1]), std::fmax(value.v[2], value.v[3]));
+}
+
+inline float4 load_int16(int16_t const *const ptr) {
+    return float4{{static_cast<float>(ptr[0]), static_cast<float>(ptr[1]), static_cast<float>(ptr[2]),
+                   static_cast<float>(ptr[3])}};
+}
+
+inline float4 load_int32(int32_t const *const ptr) {
+    return float4{{static_cast<float>(ptr[0]), static_cast<float>(ptr[1]), static_cast<float>(ptr[2]),
+                   static_cast<float>(ptr[3])}};
+}
+
+inline void store_int16(int16_t *const ptr, float4 const value) {
+    for (uint32_t idx = 0; idx < 4; ++idx) {
+        ptr[idx] = static_cast<int16_t>(std::lrint(value.v[idx]));
+    }
+}
+
+inline void store_int32(int32_t *const ptr, float4 const value) {
+    for (uint32_t idx = 0; idx < 4; ++idx) {
+        ptr[idx] = static_cast<int32_t>(std::lrint(value.v[idx]));
+    }
+}
+
+inline float4 load_float64(double const *const ptr) {
+    return float4{{static_cast<float>(ptr[0]), static_cast<float>(ptr[1]), static_cast<float>(ptr[2]),
+                   static_cast<float>(ptr[3])}};
+}
+
+inline void store_float64(double *const ptr, float4 const value) {
+    ptr[0] = value.v[0];
+    ptr[1] = value.v[1];
+    ptr[2] = value.v[2];
+    ptr[3] = value.v[3];
+}
+
+inline void zip(float4 const lhs, float4 const rhs, float4 &low, float4 &high) {
+    low = float4{{lhs.v[0], rhs.v[0], lhs.v[1], rhs.v[1]}};
+    high = float4{{lhs.v[2], rhs.v[2], lhs.v[3], rhs.v[3]}};
+}
+
+inline void unzip(float4 const low, float4 const high, float4 &even, float4 &odd) {
+    even = float4{{low.v[0], low.v[2], high.v[0], high.v[2]}};
+    odd = float4{{low.v[1], low.v[3], high.v[1], high.v[3]}};
+}
+
+inline void transpose(float4 &row0, float4 &row1, float4 &row2, float4 &row3) {
+    float4 const r0 = row0;
+    float4 const r1 = row1;
+    float4 const r2 = row2;
+    float4 const r3 = row3;
+    row0 = float4{{r0.v[0], r1.v[0], r2.v[0], r3.v[0]}};
+    row1 = float4{{r0.v[1], r1.v[1], r2.v[1], r3.v[1]}};
+    row2 = float4{{r0.v[2], r1.v[2], r2.v[2], r3.v[2]}};
+    row3 = float4{{r0.v[3], r1.v[3], r2.v[3], r3.v[3]}};
+}
+
+#endif
+}  // namespace yas::audio::simd
@@ -10,6 +10,7 @@
 #include <cpp_utils/yas_fast_each.h>
 #include <cpp_utils/yas_result.h>
 
+#include "yas_audio_native_file.h"
 #include "yas_audio_pcm_buffer.h"
 
 using namespace yas;
@@ -25,7 +26,7 @@ file::~file() {
 }
 
 file::open_result_t file::open(open_args args) {
-    if (this->_ext_audio_file) {
+    if (this->is_opened()) {
         return open_result_t(open_error_t::opened);
     }
 
@@ -35,7 +36,8 @@ file::open_result_t file::open(open_args args) {
 
     this->_url = args.file_url;
 
-    if (!this->_open_ext_audio_file(args.pcm_format, args.interleaved)) {
+    if (!this->_open_native_file(args.pcm_format, args.interleaved, args.mapped) &&
+        !this->_open_ext_audio_file(args.pcm_format, args.interleaved)) {
         return open_result_t(open_error_t::open_failed);
     }
 
@@ -43,7 +45,7 @@ file::open_result_t file::open(open_args args) {
 }
 
 file::create_result_t file::create(create_args args) {
-    if (this->_ext_audio_file) {
+    if (this->is_opened()) {
         return create_result_t(create_error_t::created);
     }
 
@@ -53,8 +55,10 @@ file::create_result_t file::create(create_args args) {
 
     this->_url = args.file_url;
     this->_file_type = args.file_type;
+    this->_file_format = format{args.settings};
 
-    if (!this->_create_ext_audio_file(args.settings, args.pcm_format, args.interleaved)) {
+    if (!this->_create_native_file(args.pcm_format, args.interleaved) &&
+        !this->_create_ext_audio_file(args.pcm_format, args.interleaved)) {
         return create_result_t(create_error_t::create_failed);
     }
 
@@ -62,6 +66,11 @@ file::create_result_t file::create(create_args args) {
 }
 
 void file::close() {
+    if (this->_native_file) {
+        this->_native_file->close();
+        this->_native_file = nullptr;
+    }
+
     if (this->_ext_audio_file) {
         ext_audio_file_utils::dispose(this->_ext_audio_file.value());
         this->_ext_audio_file = std::nullopt;
@@ -69,7 +78,15 @@ void file::close() {
 }
 
 bool file::is_opened() const {
-    return this->_ext_audio_file != nullptr;
+    return this->_ext_audio_file.has_value() || this->_native_file != nullptr;
+}
+
+bool file::is_native() const {
+    return this->_native_file != nullptr;
+}
+
+mapped_file_ptr file::mapping() const {
+    return this->_native_file ? this->_native_file->mapping() : nullptr;
 }
 
 yas::url const &file::url() const {
@@ -89,6 +106,9 @@ format const &file::processing_format() const {
 }
 
 int64_t file::file_length() const {
+    if (this->_native_file) {
+        return this->_native_file->file_length();
+    }
     if (this->_ext_audio_file) {
         return ext_audio_file_utils::get_file_length_frames(this->_ext_audio_file.value());
     }
@@ -112,14 +132,24 @@ int64_t file::file_frame_position() const {
 
 void file::set_processing_format(format format) {
     this->_processing_format = std::move(format);
-    if (this->_ext_audio_file) {
+    if (this->_native_file && !this->_native_file->can_process(*this->_processing_format)) {
+        this->_replace_native_file_with_ext_audio_file();
+    } else if (this->_ext_audio_file) {
         ext_audio_file_utils::set_client_format(this->_processing_format->stream_description(),
                                                 this->_ext_audio_file.value());
     }
 }
 
-void file::set_file_frame_position(uint32_t const position) {
-    if (this->_ext_audio_file && this->_file_frame_position != position) {
+void file::set_file_frame_position(int64_t const position) {
+    if (position < 0) {
+        return;
+    }
+
+    if (this->_native_file) {
+        if (this->_native_file->set_file_frame_position(position)) {
+            this->_file_frame_position = position;
+        }
+    } else if (this->_ext_audio_file && this->_file_frame_position != position) {
         OSStatus err = ExtAudioFileSeek(this->_ext_audio_file.value(), position);
         if (err == noErr) {
             this->_file_frame_position = position;
@@ -128,7 +158,7 @@ void file::set_file_frame_position(uint32_t const position) {
 }
 
 file::read_result_t file::read_into_buffer(pcm_buffer &buffer, uint32_t const frame_length) {
-    if (!this->_ext_audio_file) {
+    if (!this->is_opened()) {
         return read_result_t(read_error_t::closed);
     }
 
@@ -140,6 +170,16 @@ file::read_result_t file::read_into_buffer(pcm_buffer &buffer, uint32_t const fr
         return read_result_t(read_error_t::frame_length_out_of_range);
     }
 
+    if (this->_native_file) {
+        if (!this->_native_file->read_into_buffer(buffer, frame_length > 0 ? frame_length : buffer.frame_capacity())) {
+            return read_result_t(read_error_t::read_failed);
+        }
+
+        this->_file_frame_position = this->_native_file->file_frame_position();
+
+        return read_result_t(nullptr);
+    }
+
     OSStatus err = noErr;
     uint32_t out_frame_length = 0;
     uint32_t remain_frames = frame_length > 0 ? frame_length : buffer.frame_capacity();
@@ -196,16 +236,32 @@ file::read_result_t file::read_into_buffer(pcm_buffer &buffer, uint32_t const fr
 }
 
 file::write_result_t file::write_from_buffer(pcm_buffer const &buffer, bool const async) {
-    if (!this->_ext_audio_file) {
+    if (!this->is_opened()) {
         return write_result_t(write_error_t::closed);
     }
 
-    ExtAudioFileRef const &ext_audio_file = this->_ext_audio_file.value();
-
     if (buffer.format() != this->_processing_format) {
         return write_result_t(write_error_t::invalid_format);
     }
 
+    if (this->_native_file) {
+        // the sample rate was changed after writing. the written frames are not resampled.
+        if (!this->_native_file->can_process(buffer.format())) {
+            return write_result_t(write_error_t::invalid_format);
+        }
+
+        // the native file is written synchronously even if async.
+        if (!this->_native_file->write_from_buffer(buffer)) {
+            return write_result_t(write_error_t::write_failed);
+        }
+
+        this->_file_frame_position = this->_native_file->file_frame_position();
+
+        return write_result_t(nullptr);
+    }
+
+    ExtAudioFileRef const &ext_audio_file = this->_ext_audio_file.value();
+
     OSStatus err = noErr;
 
     if (async) {
@@ -226,8 +282,55 @@ file::write_result_t file::write_from_buffer(pcm_buffer const &buffer, bool cons
     return write_result_t(nullptr);
 }
 
+file::write_result_t file::flush(bool const sync) {
+    if (!this->is_opened()) {
+        return write_result_t(write_error_t::closed);
+    }
+
+    if (!this->_native_file || !this->_native_file->flush(sync)) {
+        return write_result_t(write_error_t::write_failed);
+    }
+
+    return write_result_t(nullptr);
+}
+
 #pragma mark - private
 
+bool file::_open_native_file(pcm_format const pcm_format, bool const interleaved, bool const mapped) {
+    auto native_file = native_file::make_opened(*this->_url, mapped);
+    if (!native_file) {
+        return false;
+    }
+
+    this->_file_type = native_file->header().file_type;
+    this->_file_format = native_file->file_format();
+
+    this->_processing_format = format{{.sample_rate = this->_file_format->sample_rate(),
+                                       .channel_count = this->_file_format->channel_count(),
+                                       .pcm_format = pcm_format,
+                                       .interleaved = interleaved}};
+
+    this->_native_file = std::move(native_file);
+
+    return true;
+}
+
+bool file::_create_native_file(pcm_format const pcm_format, bool const interleaved) {
+    auto native_file = native_file::make_created(*this->_url, this->_file_type, *this->_file_format);
+    if (!native_file) {
+        return false;
+    }
+
+    this->_processing_format = format{{.sample_rate = this->_file_format->sample_rate(),
+                                       .channel_count = this->_file_format->channel_count(),
+                                       .pcm_format = pcm_format,
+                                       .interleaved = interleaved}};
+
+    this->_native_file = std::move(native_file);
+
+    return true;
+}
+
 bool file::_open_ext_audio_file(pcm_format const pcm_format, bool const interleaved) {
     if (!ext_audio_file_utils::can_open(this->_url->cf_url())) {
         return false;
@@ -270,10 +373,7 @@ bool file::_open_ext_audio_file(pcm_format const pcm_format, bool const interlea
     return true;
 }
 
-bool file::_create_ext_audio_file(CFDictionaryRef const &settings, pcm_format const pcm_format,
-                                  bool const interleaved) {
-    this->_file_format = format{settings};
-
+bool file::_create_ext_audio_file(pcm_format const pcm_format, bool const interleaved) {
     AudioFileTypeID file_type_id = to_audio_file_type_id(this->_file_type);
 
     ExtAudioFileRef ext_audio_file = nullptr;
@@ -297,6 +397,35 @@ bool file::_create_ext_audio_file(CFDictionaryRef const &settings, pcm_format co
     return true;
 }
 
+// ExtAudioFile converts the sample rate and the channels that native_file does not.
+void file::_replace_native_file_with_ext_audio_file() {
+    auto const processing_format = *this->_processing_format;
+    auto const position = this->_file_frame_position;
+    bool const is_writable = this->_native_file->is_writable();
+
+    if (is_writable && this->_native_file->file_length() > 0) {
+        return;
+    }
+
+    this->_native_file->close();
+    this->_native_file = nullptr;
+
+    bool const is_replaced =
+        is_writable ? this->_create_ext_audio_file(processing_format.pcm_format(), processing_format.is_interleaved()) :
+                      this->_open_ext_audio_file(processing_format.pcm_format(), processing_format.is_interleaved());
+
+    this->_processing_format = processing_format;
+
+    if (!is_replaced) {
+        return;
+    }
+
+    ext_audio_file_utils::set_client_format(processing_format.stream_description(), this->_ext_audio_file.value());
+
+    this->_file_frame_position = 0;
+    this->set_file_frame_position(position);
+}
+
 #pragma mark -
 
 file_ptr file::make_shared() {
@@ -26,6 +26,8 @@ struct file final {
         url file_url;
         audio::pcm_format pcm_format = pcm_format::float32;
         bool interleaved = false;
+        // reads the samples through a mapping of the file if the file is mappable.
+        bool mapped = false;
     };
 
     struct create_args {
@@ -77,6 +79,10 @@ struct file final {
     void close();
 
     [[nodiscard]] bool is_opened() const;
+    // true while the file is read or written by native_file instead of ExtAudioFile.
+    [[nodiscard]] bool is_native() const;
+    // the mapping of the file opened with mapped to make views of the samples. nullptr if not mapped.
+    [[nodiscard]] mapped_file_ptr mapping() const;
     [[nodiscard]] yas::url const &url() const;
     [[nodiscard]] audio::file_type file_type() const;
     [[nodiscard]] audio::format const &file_format() const;
@@ -86,10 +92,13 @@ struct file final {
     [[nodiscard]] int64_t file_frame_position() const;
 
     void set_processing_format(audio::format format);
-    void set_file_frame_position(uint32_t const position);
+    void set_file_frame_position(int64_t const position);
 
     read_result_t read_into_buffer(audio::pcm_buffer &buffer, uint32_t const frame_length = 0);
     write_result_t write_from_buffer(audio::pcm_buffer const &buffer, bool const async = false);
+    // writes the sizes to the header and the buffered to the file. syncs the data to the storage if sync.
+    // fails if not native as an ExtAudioFile is flushed only when closed.
+    write_result_t flush(bool const sync = false);
 
     static file_ptr make_shared();
     static file::make_opened_result_t make_opened(file::open_args);
@@ -100,11 +109,15 @@ struct file final {
     std::optional<format> _processing_format = std::nullopt;
     int64_t _file_frame_position = 0;
     std::optional<ExtAudioFileRef> _ext_audio_file = std::nullopt;
+    native_file_ptr _native_file = nullptr;
     std::optional<yas::url> _url = std::nullopt;
     audio::file_type _file_type;
 
+    bool _open_native_file(pcm_format const pcm_format, bool const interleaved, bool const mapped);
+    bool _create_native_file(pcm_format const pcm_format, bool const interleaved);
     bool _open_ext_audio_file(pcm_format const pcm_format, bool const interleaved);
-    bool _create_ext_audio_file(CFDictionaryRef const &settings, pcm_format const pcm_format, bool const interleaved);
+    bool _create_ext_audio_file(pcm_format const pcm_format, bool const interleaved);
+    void _replace_native_file_with_ext_audio_file();
 
     file();
 
@@ -0,0 +1,204 @@
+//
+//  yas_audio_file_stream.cpp
+//
+
+#include "yas_audio_file_stream.h"
+
+#include <cpp_utils/yas_result.h>
+
+#include <algorithm>
+
+#include "yas_audio_file_stream_pool.h"
+#include "yas_audio_pcm_ring_buffer.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::file_stream_utils {
+static uint32_t constexpr max_chunk_frame_length = 16384;
+}
+
+file_stream::file_stream(args &&args)
+    : _file(args.file),
+      _pool(args.pool),
+      _is_looping(args.is_looping),
+      _ring(pcm_ring_buffer::make_shared(args.file->processing_format(), args.read_ahead_frame_capacity)),
+      _buffer(args.file->processing_format(),
+              std::min(this->_ring->frame_capacity() / 2, file_stream_utils::max_chunk_frame_length)) {
+}
+
+format const &file_stream::format() const {
+    return this->_ring->format();
+}
+
+uint32_t file_stream::read_ahead_frame_capacity() const {
+    return this->_ring->frame_capacity();
+}
+
+void file_stream::play() {
+    this->_is_playing = true;
+
+    if (auto const pool = this->_pool.lock()) {
+        pool->notify();
+    }
+}
+
+void file_stream::pause() {
+    this->_is_playing = false;
+}
+
+bool file_stream::is_playing() const {
+    return this->_is_playing;
+}
+
+void file_stream::seek(int64_t const frame) {
+    this->_requested_frame = frame;
+    ++this->_requested_generation;
+
+    if (auto const pool = this->_pool.lock()) {
+        pool->notify();
+    }
+}
+
+bool file_stream::is_ended() const {
+    return this->_requested_generation == this->_acknowledged_generation && this->_is_ended;
+}
+
+file_stream_statistics file_stream::statistics() const {
+    uint32_t const minimum_prefetch_length = this->_minimum_prefetch_frame_length.load(std::memory_order_relaxed);
+
+    return {.render_count = this->_render_count.load(std::memory_order_relaxed),
+            .rendered_frame_count = this->_rendered_frame_count.load(std::memory_order_relaxed),
+            .underrun_count = this->_underrun_count.load(std::memory_order_relaxed),
+            .underrun_frame_count = this->_underrun_frame_count.load(std::memory_order_relaxed),
+            .prefetch_frame_length = this->_prefetch_frame_length.load(std::memory_order_relaxed),
+            .minimum_prefetch_frame_length = minimum_prefetch_length == UINT32_MAX ? 0 : minimum_prefetch_length};
+}
+
+void file_stream::reset_statistics() {
+    this->_render_count.store(0, std::memory_order_relaxed);
+    this->_rendered_frame_count.store(0, std::memory_order_relaxed);
+    this->_underrun_count.store(0, std::memory_order_relaxed);
+    this->_underrun_frame_count.store(0, std::memory_order_relaxed);
+    this->_prefetch_frame_length.store(0, std::memory_order_relaxed);
+    this->_minimum_prefetch_frame_length.store(UINT32_MAX, std::memory_order_relaxed);
+}
+
+void file_stream::render(pcm_buffer &buffer) {
+    uint32_t const frame_length = buffer.frame_length();
+    uint32_t read_length = 0;
+
+    if (this->_is_playing.load(std::memory_order_relaxed)) {
+        uint32_t prefetch_length = 0;
+        bool is_ended = false;
+
+        // sequentially consistent with the io thread to flush the ring only while the render thread is out.
+        this->_is_rendering = true;
+
+        if (this->_requested_generation == this->_acknowledged_generation) {
+            // loaded before reading so that the ring has the rest of the file if ended.
+            is_ended = this->_is_ended.load(std::memory_order_acquire);
+            prefetch_length = this->_ring->readable_frame_length();
+
+            if (this->_ring->read(buffer, frame_length)) {
+                read_length = buffer.frame_length();
+            }
+        }
+
+        this->_is_rendering = false;
+
+        uint32_t const underrun_length = (is_ended && read_length == prefetch_length) ? 0 : frame_length - read_length;
+
+        this->_render_count.fetch_add(1, std::memory_order_relaxed);
+        this->_rendered_frame_count.fetch_add(read_length, std::memory_order_relaxed);
+
+        if (underrun_length > 0) {
+            this->_underrun_count.fetch_add(1, std::memory_order_relaxed);
+            this->_underrun_frame_count.fetch_add(underrun_length, std::memory_order_relaxed);
+        }
+
+        this->_prefetch_frame_length.store(prefetch_length, std::memory_order_relaxed);
+
+        if (prefetch_length < this->_minimum_prefetch_frame_length.load(std::memory_order_relaxed)) {
+            this->_minimum_prefetch_frame_length.store(prefetch_length, std::memory_order_relaxed);
+        }
+    }
+
+    buffer.set_frame_length(frame_length);
+
+    if (read_length < frame_length) {
+        buffer.clear(read_length, frame_length - read_length);
+    }
+}
+
+std::optional<float> file_stream::read_ahead_ratio() const {
+    if (this->_requested_generation != this->_acknowledged_generation) {
+        return 0.0f;
+    }
+
+    if (this->_is_ended.load(std::memory_order_relaxed) ||
+        this->_ring->writable_frame_length() < this->_buffer.frame_capacity()) {
+        return std::nullopt;
+    }
+
+    return static_cast<float>(this->_ring->readable_frame_length()) / this->_ring->frame_capacity();
+}
+
+void file_stream::read_ahead() {
+    uint64_t const generation = this->_requested_generation;
+
+    if (generation != this->_acknowledged_generation.load(std::memory_order_relaxed)) {
+        // retried after the render thread is out. it does not read the ring until the generation is acknowledged.
+        if (this->_is_rendering) {
+            return;
+        }
+
+        while (this->_ring->readable_frame_length() > 0) {
+            this->_ring->read(this->_buffer);
+        }
+
+        int64_t const frame = std::clamp<int64_t>(this->_requested_frame, 0, this->_file->file_length());
+        this->_file->set_file_frame_position(frame);
+        this->_is_ended.store(false, std::memory_order_relaxed);
+
+        this->_acknowledged_generation.store(generation, std::memory_order_release);
+    }
+
+    if (this->_is_ended.load(std::memory_order_relaxed) ||
+        this->_ring->writable_frame_length() < this->_buffer.frame_capacity()) {
+        return;
+    }
+
+    auto result = this->_file->read_into_buffer(this->_buffer);
+
+    if (result && this->_buffer.frame_length() == 0 && this->_is_looping && this->_file->file_frame_position() > 0) {
+        this->_file->set_file_frame_position(0);
+        result = this->_file->read_into_buffer(this->_buffer);
+    }
+
+    if (!result || this->_buffer.frame_length() == 0) {
+        this->_is_ended.store(true, std::memory_order_release);
+        return;
+    }
+
+    this->_ring->write(this->_buffer);
+}
+
+file_stream_ptr file_stream::make_shared(args args) {
+    if (!args.file || !args.file->is_opened()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : file is not opened.");
+    }
+
+    if (!args.pool) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : pool is null.");
+    }
+
+    if (args.read_ahead_frame_capacity < 2) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : read_ahead_frame_capacity is less than 2.");
+    }
+
+    auto const pool = args.pool;
+    auto shared = file_stream_ptr{new file_stream{std::move(args)}};
+    pool->add_stream(shared);
+    return shared;
+}
@@ -0,0 +1,88 @@
+//
+//  yas_audio_file_stream.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_file.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+
+#include <atomic>
+
+namespace yas::audio {
+struct file_stream_statistics {
+    uint64_t render_count = 0;                   // the renders while playing
+    uint64_t rendered_frame_count = 0;           // delivered to the render buffers from the file
+    uint64_t underrun_count = 0;                 // the renders the read-ahead had not filled
+    uint64_t underrun_frame_count = 0;           // the frames of the underruns filled with silence
+    uint32_t prefetch_frame_length = 0;          // the frames read ahead at the last render
+    uint32_t minimum_prefetch_frame_length = 0;  // the least frames read ahead at the renders
+};
+
+// streams an opened file to a render thread. the io threads of a file_stream_pool read the file ahead into a ring and
+// the render thread reads the ring without locking or waiting. the read-ahead is kept filled while paused.
+struct file_stream final {
+    struct args {
+        audio::file_ptr file;  // the format of the rendered buffers is the processing format of the file
+        // held weakly. kept alive by the owner while the stream is played.
+        file_stream_pool_ptr pool;
+        uint32_t read_ahead_frame_capacity = 65536;
+        bool is_looping = false;
+    };
+
+    [[nodiscard]] audio::format const &format() const;
+    [[nodiscard]] uint32_t read_ahead_frame_capacity() const;
+
+    // control thread.
+    void play();
+    void pause();
+    [[nodiscard]] bool is_playing() const;
+    // the read-ahead is refilled from the frame. seeking while playing underruns until it is refilled.
+    void seek(int64_t const frame);
+    // true when the rest of the file is in the read-ahead. the end is rendered as silence without underruns.
+    [[nodiscard]] bool is_ended() const;
+
+    [[nodiscard]] file_stream_statistics statistics() const;
+    void reset_statistics();
+
+    // render thread. fills the frame length of the buffer in the format. silence while paused.
+    void render(pcm_buffer &buffer);
+
+    // io thread of the pool. the ratio of the frames read ahead to the capacity. nullopt if no read is needed.
+    [[nodiscard]] std::optional<float> read_ahead_ratio() const;
+    // io thread of the pool. reads a chunk of the file into the read-ahead.
+    void read_ahead();
+
+    [[nodiscard]] static file_stream_ptr make_shared(args);
+
+   private:
+    audio::file_ptr const _file;
+    std::weak_ptr<file_stream_pool> const _pool;
+    bool const _is_looping;
+    pcm_ring_buffer_ptr const _ring;
+    pcm_buffer _buffer;
+
+    // a seek is a generation. the io thread flushes the ring and acknowledges it while the render thread is out.
+    std::atomic<int64_t> _requested_frame{0};
+    std::atomic<uint64_t> _requested_generation{1};
+    std::atomic<uint64_t> _acknowledged_generation{0};
+    std::atomic<bool> _is_rendering{false};
+    std::atomic<bool> _is_playing{false};
+    std::atomic<bool> _is_ended{false};
+
+    std::atomic<uint64_t> _render_count{0};
+    std::atomic<uint64_t> _rendered_frame_count{0};
+    std::atomic<uint64_t> _underrun_count{0};
+    std::atomic<uint64_t> _underrun_frame_count{0};
+    std::atomic<uint32_t> _prefetch_frame_length{0};
+    std::atomic<uint32_t> _minimum_prefetch_frame_length{UINT32_MAX};
+
+    explicit file_stream(args &&);
+
+    file_stream(file_stream const &) = delete;
+    file_stream(file_stream &&) = delete;
+    file_stream &operator=(file_stream const &) = delete;
+    file_stream &operator=(file_stream &&) = delete;
+};
+}  // namespace yas::audio
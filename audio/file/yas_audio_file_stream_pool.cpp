@@ -0,0 +1,132 @@
+//
+//  yas_audio_file_stream_pool.cpp
+//
+
+#include "yas_audio_file_stream_pool.h"
+
+#include <algorithm>
+
+#include "yas_audio_file_stream.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+struct file_stream_pool::entry {
+    std::weak_ptr<file_stream> const stream;
+    bool is_reading = false;
+
+    explicit entry(std::weak_ptr<file_stream> const &stream) : stream(stream) {
+    }
+};
+
+file_stream_pool::file_stream_pool(args &&args) : _interval(args.interval) {
+    uint32_t const worker_count = std::max(args.worker_count, uint32_t(1));
+
+    this->_workers.reserve(worker_count);
+
+    for (uint32_t idx = 0; idx < worker_count; ++idx) {
+        this->_workers.emplace_back([this] { this->_run_worker(); });
+    }
+}
+
+file_stream_pool::~file_stream_pool() {
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        this->_is_terminated = true;
+    }
+
+    this->_condition.notify_all();
+
+    for (auto &worker : this->_workers) {
+        worker.join();
+    }
+}
+
+uint32_t file_stream_pool::worker_count() const {
+    return static_cast<uint32_t>(this->_workers.size());
+}
+
+std::size_t file_stream_pool::stream_count() const {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+
+    return std::count_if(this->_entries.begin(), this->_entries.end(),
+                         [](auto const &entry) { return !entry->stream.expired(); });
+}
+
+void file_stream_pool::add_stream(std::weak_ptr<file_stream> const &stream) {
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        this->_entries.push_back(std::make_shared<entry>(stream));
+    }
+
+    this->_condition.notify_one();
+}
+
+void file_stream_pool::notify() {
+    { std::lock_guard<std::mutex> lock(this->_mutex); }
+    this->_condition.notify_all();
+}
+
+void file_stream_pool::_run_worker() {
+    std::unique_lock<std::mutex> lock(this->_mutex);
+
+    while (!this->_is_terminated) {
+        auto const entry = this->_claim_entry();
+
+        if (!entry) {
+            this->_condition.wait_for(lock, this->_interval);
+            continue;
+        }
+
+        lock.unlock();
+
+        // the stream may be released on this thread.
+        if (auto const stream = entry->stream.lock()) {
+            stream->read_ahead();
+        }
+
+        lock.lock();
+
+        entry->is_reading = false;
+    }
+}
+
+std::shared_ptr<file_stream_pool::entry> file_stream_pool::_claim_entry() {
+    std::shared_ptr<entry> claimed_entry = nullptr;
+    float claimed_ratio = 0.0f;
+
+    auto each = this->_entries.begin();
+
+    while (each != this->_entries.end()) {
+        auto const &entry = *each;
+        auto const stream = entry->stream.lock();
+
+        if (!stream) {
+            if (entry->is_reading) {
+                ++each;
+            } else {
+                each = this->_entries.erase(each);
+            }
+            continue;
+        }
+
+        if (!entry->is_reading) {
+            if (auto const ratio = stream->read_ahead_ratio(); ratio && (!claimed_entry || *ratio < claimed_ratio)) {
+                claimed_entry = entry;
+                claimed_ratio = *ratio;
+            }
+        }
+
+        ++each;
+    }
+
+    if (claimed_entry) {
+        claimed_entry->is_reading = true;
+    }
+
+    return claimed_entry;
+}
+
+file_stream_pool_ptr file_stream_pool::make_shared(args args) {
+    return file_stream_pool_ptr{new file_stream_pool{std::move(args)}};
+}
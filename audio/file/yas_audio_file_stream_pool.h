@@ -0,0 +1,60 @@
+//
+//  yas_audio_file_stream_pool.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_ptr.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace yas::audio {
+// reads ahead many file_streams on a bounded pool of io threads. the stream with the least frames read ahead is read
+// first. a stream is read by one thread at a time.
+struct file_stream_pool final {
+    struct args {
+        uint32_t worker_count = 2;
+        // the render threads do not notify the workers not to lock. the streams are polled at the interval instead.
+        std::chrono::milliseconds interval{5};
+    };
+
+    ~file_stream_pool();
+
+    [[nodiscard]] uint32_t worker_count() const;
+    [[nodiscard]] std::size_t stream_count() const;
+
+    // called by file_stream. the stream is held weakly and removed after it is released.
+    void add_stream(std::weak_ptr<file_stream> const &);
+    // wakes the workers to read the streams before the interval.
+    void notify();
+
+    [[nodiscard]] static file_stream_pool_ptr make_shared(args);
+
+   private:
+    struct entry;
+
+    std::chrono::milliseconds const _interval;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<std::shared_ptr<entry>> _entries;
+    bool _is_terminated = false;
+
+    std::vector<std::thread> _workers;
+
+    explicit file_stream_pool(args &&);
+
+    void _run_worker();
+    // the entry of the stream to read next. nullptr if no stream needs to be read.
+    std::shared_ptr<entry> _claim_entry();
+
+    file_stream_pool(file_stream_pool const &) = delete;
+    file_stream_pool(file_stream_pool &&) = delete;
+    file_stream_pool &operator=(file_stream_pool const &) = delete;
+    file_stream_pool &operator=(file_stream_pool &&) = delete;
+};
+}  // namespace yas::audio
@@ -22,6 +22,9 @@ enum class file_type {
     mpeg4,
     apple_m4a,
     wave,
+    rf64,
+    bw64,
+    wave64,
 };
 
 audio::file_type to_file_type(AudioFileTypeID const);
@@ -34,6 +34,13 @@ AudioFileTypeID audio::to_audio_file_type_id(audio::file_type const file_type) {
             return kAudioFileM4AType;
         case audio::file_type::wave:
             return kAudioFileWAVEType;
+        case audio::file_type::rf64:
+            return kAudioFileRF64Type;
+        case audio::file_type::bw64:
+            // kAudioFileBW64Type is declared from macOS 11.
+            return 'BW64';
+        case audio::file_type::wave64:
+            return kAudioFileWave64Type;
     }
 }
 
@@ -61,6 +68,12 @@ std::string yas::to_string(audio::file_type const file_type) {
             return "com.apple.m4a-audio";
         case audio::file_type::wave:
             return "com.microsoft.waveform-audio";
+        case audio::file_type::rf64:
+            return "org.ebu.rf64-audio";
+        case audio::file_type::bw64:
+            return "org.itu.bw64-audio";
+        case audio::file_type::wave64:
+            return "com.sony.wave64-audio";
     }
 }
 
@@ -88,6 +101,12 @@ audio::file_type audio::to_file_type(AudioFileTypeID const fileTypeID) {
             return audio::file_type::apple_m4a;
         case kAudioFileWAVEType:
             return audio::file_type::wave;
+        case kAudioFileRF64Type:
+            return audio::file_type::rf64;
+        case 'BW64':
+            return audio::file_type::bw64;
+        case kAudioFileWave64Type:
+            return audio::file_type::wave64;
         default:
             throw std::invalid_argument("invalid file type id.");
     }
@@ -116,6 +135,12 @@ audio::file_type audio::to_file_type(std::string const &string) {
         return audio::file_type::apple_m4a;
     } else if (string == to_string(audio::file_type::wave)) {
         return audio::file_type::wave;
+    } else if (string == to_string(audio::file_type::rf64)) {
+        return audio::file_type::rf64;
+    } else if (string == to_string(audio::file_type::bw64)) {
+        return audio::file_type::bw64;
+    } else if (string == to_string(audio::file_type::wave64)) {
+        return audio::file_type::wave64;
     }
     throw std::invalid_argument("invalid file type string.");
 }
@@ -0,0 +1,189 @@
+//
+//  yas_audio_file_writer.cpp
+//
+
+#include "yas_audio_file_writer.h"
+
+#include <cpp_utils/yas_result.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "yas_audio_pcm_ring_buffer.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::file_writer_utils {
+static uint32_t constexpr block_byte_count = 4096;
+
+// rounds up to the frames of whole blocks in the file.
+static uint32_t block_frame_length(format const &file_format, uint32_t const frame_length) {
+    uint32_t const frame_byte_count = file_format.stream_description().mBytesPerFrame;
+    uint32_t const frames_per_block = block_byte_count / std::gcd(block_byte_count, frame_byte_count);
+    return std::max((frame_length + frames_per_block - 1) / frames_per_block, uint32_t(1)) * frames_per_block;
+}
+}  // namespace yas::audio::file_writer_utils
+
+file_writer::file_writer(args &&args)
+    : _file(std::move(args.file)),
+      _sync_policy(args.sync_policy),
+      _sync_interval(args.sync_interval),
+      _interval(args.interval),
+      _ring(pcm_ring_buffer::make_shared(this->_file->processing_format(), args.queue_frame_capacity)),
+      _write_buffer(this->_file->processing_format(),
+                    std::min(file_writer_utils::block_frame_length(this->_file->file_format(), args.write_frame_length),
+                             this->_ring->frame_capacity())) {
+    this->_thread = std::thread{[this] { this->_run_writer(); }};
+}
+
+file_writer::~file_writer() {
+    this->finish();
+}
+
+bool file_writer::push(pcm_buffer const &buffer) {
+    uint32_t const frame_length = buffer.frame_length();
+    bool is_pushed = false;
+
+    if (!this->_is_stopped.load(std::memory_order_acquire) && this->_ring->writable_frame_length() >= frame_length) {
+        if (auto const result = this->_ring->write(buffer); result && result.value() == frame_length) {
+            is_pushed = true;
+        }
+    }
+
+    if (is_pushed) {
+        this->_pushed_frame_count.fetch_add(frame_length, std::memory_order_relaxed);
+    } else {
+        this->_dropped_frame_count.fetch_add(frame_length, std::memory_order_relaxed);
+    }
+
+    uint32_t const queue_frame_length = this->_ring->readable_frame_length();
+
+    if (queue_frame_length > this->_maximum_queue_frame_length.load(std::memory_order_relaxed)) {
+        this->_maximum_queue_frame_length.store(queue_frame_length, std::memory_order_relaxed);
+    }
+
+    return is_pushed;
+}
+
+void file_writer::finish() {
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+
+        if (this->_is_finishing) {
+            return;
+        }
+
+        this->_is_finishing = true;
+    }
+
+    this->_condition.notify_all();
+
+    this->_thread.join();
+
+    this->_is_stopped = true;
+    this->_is_finished = true;
+}
+
+bool file_writer::is_finished() const {
+    return this->_is_finished;
+}
+
+audio::file_ptr const &file_writer::file() const {
+    return this->_file;
+}
+
+std::optional<file::write_error_t> file_writer::write_error() const {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    return this->_write_error;
+}
+
+file_writer_statistics file_writer::statistics() const {
+    return {.pushed_frame_count = this->_pushed_frame_count.load(std::memory_order_relaxed),
+            .dropped_frame_count = this->_dropped_frame_count.load(std::memory_order_relaxed),
+            .written_frame_count = this->_written_frame_count.load(std::memory_order_relaxed),
+            .write_count = this->_write_count.load(std::memory_order_relaxed),
+            .sync_count = this->_sync_count.load(std::memory_order_relaxed),
+            .queue_frame_length = this->_ring->readable_frame_length(),
+            .maximum_queue_frame_length = this->_maximum_queue_frame_length.load(std::memory_order_relaxed)};
+}
+
+void file_writer::_run_writer() {
+    auto &buffer = this->_write_buffer;
+    auto synced_time = std::chrono::steady_clock::now();
+
+    while (true) {
+        bool is_finishing = false;
+
+        {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+
+            this->_condition.wait_for(lock, this->_interval, [this, &buffer] {
+                return this->_is_finishing || this->_ring->readable_frame_length() >= buffer.frame_capacity();
+            });
+
+            is_finishing = this->_is_finishing;
+        }
+
+        auto const now = std::chrono::steady_clock::now();
+        bool const is_sync_due = this->_sync_policy == sync::periodic && now - synced_time >= this->_sync_interval;
+        // the frames short of a block are left in the queue unless they are flushed.
+        bool const is_flushing = is_finishing || is_sync_due;
+
+        // only the frames queued so far not to be kept writing by the pushes while flushing.
+        uint32_t queue_frame_length = this->_ring->readable_frame_length();
+
+        while (queue_frame_length >= buffer.frame_capacity() || (is_flushing && queue_frame_length > 0)) {
+            auto const read_result = this->_ring->read(buffer, std::min(buffer.frame_capacity(), queue_frame_length));
+
+            if (!read_result || read_result.value() == 0) {
+                break;
+            }
+
+            if (auto const write_result = this->_file->write_from_buffer(buffer); !write_result) {
+                this->_stop_writer(write_result.error());
+                return;
+            }
+
+            queue_frame_length -= read_result.value();
+            this->_written_frame_count.fetch_add(read_result.value(), std::memory_order_relaxed);
+            this->_write_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (is_sync_due || (is_finishing && this->_sync_policy != sync::none)) {
+            if (auto const flush_result = this->_file->flush(true); !flush_result) {
+                this->_stop_writer(flush_result.error());
+                return;
+            }
+
+            synced_time = now;
+            this->_sync_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (is_finishing) {
+            return;
+        }
+    }
+}
+
+void file_writer::_stop_writer(file::write_error_t const error) {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+
+    if (!this->_write_error) {
+        this->_write_error = error;
+    }
+
+    this->_is_stopped.store(true, std::memory_order_release);
+}
+
+file_writer_ptr file_writer::make_shared(args args) {
+    if (!args.file || !args.file->is_opened()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : file is not opened.");
+    }
+
+    if (args.sync_policy != sync::none && !args.file->is_native()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : file is not native to sync.");
+    }
+
+    return file_writer_ptr{new file_writer{std::move(args)}};
+}
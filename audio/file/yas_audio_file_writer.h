@@ -0,0 +1,99 @@
+//
+//  yas_audio_file_writer.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_file.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace yas::audio {
+struct file_writer_statistics {
+    uint64_t pushed_frame_count = 0;          // queued by the render thread
+    uint64_t dropped_frame_count = 0;         // not queued as the queue was full or the writer had stopped
+    uint64_t written_frame_count = 0;         // written to the file by the writer thread
+    uint64_t write_count = 0;                 // the coalesced writes to the file
+    uint64_t sync_count = 0;                  // the syncs of the file to the storage
+    uint32_t queue_frame_length = 0;          // the frames in the queue now
+    uint32_t maximum_queue_frame_length = 0;  // the most frames in the queue after the pushes
+};
+
+// writes the buffers pushed by a render thread into a file on a writer thread. the render thread only writes into a
+// wait-free queue and never waits. a buffer not fitting in the queue is dropped as a whole and counted.
+// the writer thread coalesces the queued frames into large writes of whole 4096 byte blocks.
+struct file_writer final {
+    enum class sync {
+        none,      // left to the system
+        periodic,  // at the sync interval and when finished
+        finished,  // when finished
+    };
+
+    struct args {
+        audio::file_ptr file;  // created. the buffers are pushed in the processing format
+        uint32_t queue_frame_capacity = 131072;
+        uint32_t write_frame_length = 16384;  // rounded up to whole blocks
+        // the file must be native to sync.
+        file_writer::sync sync_policy = file_writer::sync::none;
+        std::chrono::milliseconds sync_interval{1000};
+        // the render thread does not notify the writer not to lock. the queue is polled at the interval instead.
+        std::chrono::milliseconds interval{10};
+    };
+
+    ~file_writer();
+
+    // render thread. false if the buffer is dropped.
+    bool push(pcm_buffer const &);
+
+    // control thread after the pushes. writes the rest of the queue and syncs by the policy. the file is not closed.
+    void finish();
+    [[nodiscard]] bool is_finished() const;
+
+    [[nodiscard]] audio::file_ptr const &file() const;
+    // the first error of the writer thread. the buffers pushed after it are dropped.
+    [[nodiscard]] std::optional<file::write_error_t> write_error() const;
+    [[nodiscard]] file_writer_statistics statistics() const;
+
+    [[nodiscard]] static file_writer_ptr make_shared(args);
+
+   private:
+    audio::file_ptr const _file;
+    sync const _sync_policy;
+    std::chrono::milliseconds const _sync_interval;
+    std::chrono::milliseconds const _interval;
+    pcm_ring_buffer_ptr const _ring;
+    pcm_buffer _write_buffer;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _is_finishing = false;
+    std::optional<file::write_error_t> _write_error = std::nullopt;
+    std::thread _thread;
+
+    std::atomic<bool> _is_stopped{false};
+    std::atomic<bool> _is_finished{false};
+    std::atomic<uint64_t> _pushed_frame_count{0};
+    std::atomic<uint64_t> _dropped_frame_count{0};
+    std::atomic<uint64_t> _written_frame_count{0};
+    std::atomic<uint64_t> _write_count{0};
+    std::atomic<uint64_t> _sync_count{0};
+    std::atomic<uint32_t> _maximum_queue_frame_length{0};
+
+    explicit file_writer(args &&);
+
+    void _run_writer();
+    void _stop_writer(file::write_error_t const);
+
+    file_writer(file_writer const &) = delete;
+    file_writer(file_writer &&) = delete;
+    file_writer &operator=(file_writer const &) = delete;
+    file_writer &operator=(file_writer &&) = delete;
+};
+}  // namespace yas::audio
@@ -0,0 +1,173 @@
+//
+//  yas_audio_mapped_file.cpp
+//
+
+#include "yas_audio_mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::mapped_file_utils {
+static bool is_host_big_endian() {
+    uint16_t const value = 1;
+    return *reinterpret_cast<uint8_t const *>(&value) == 0;
+}
+
+// the packed 24 bit samples are read by bytes.
+static uint32_t sample_alignment(dsp::sample_type const type) {
+    return type == dsp::sample_type::int24 ? 1 : dsp::sample_byte_count(type);
+}
+
+static int to_advice(mapped_file::access const access) {
+    switch (access) {
+        case mapped_file::access::normal:
+            return MADV_NORMAL;
+        case mapped_file::access::sequential:
+            return MADV_SEQUENTIAL;
+        case mapped_file::access::random:
+            return MADV_RANDOM;
+    }
+}
+}  // namespace yas::audio::mapped_file_utils
+
+mapped_file::mapped_file(uint8_t *const memory, std::size_t const byte_count, native_file_header const &header)
+    : _memory(memory),
+      _byte_count(byte_count),
+      _header(header),
+      _file_format(native_file_utils::to_stream_description(header)) {
+}
+
+mapped_file::~mapped_file() {
+    munmap(this->_memory, this->_byte_count);
+}
+
+native_file_header const &mapped_file::header() const {
+    return this->_header;
+}
+
+format const &mapped_file::file_format() const {
+    return this->_file_format;
+}
+
+int64_t mapped_file::file_length() const {
+    return this->_header.frame_length;
+}
+
+std::optional<pcm_buffer> mapped_file::make_view(int64_t const begin_frame, uint32_t const length) const {
+    auto const &format = this->_file_format;
+
+    if (format.pcm_format() == pcm_format::other || length == 0 || begin_frame < 0 ||
+        begin_frame + length > this->_header.frame_length) {
+        return std::nullopt;
+    }
+
+    auto abl = allocate_audio_buffer_list(1, format.channel_count(), 0).first;
+    abl->mBuffers[0].mData = this->_data_at_frame(begin_frame);
+    abl->mBuffers[0].mDataByteSize = length * this->_header.frame_byte_count();
+
+    return pcm_buffer{format, std::move(abl), length};
+}
+
+bool mapped_file::read_into_buffer(pcm_buffer &buffer, int64_t const begin_frame, uint32_t const frame_length) const {
+    auto const &format = buffer.format();
+    auto const dst_type = dsp::to_dsp_sample_type(format.pcm_format());
+
+    if (!dst_type || format.channel_count() != this->_header.channel_count || buffer.frame_capacity() < frame_length ||
+        begin_frame < 0) {
+        return false;
+    }
+
+    auto const src_type = this->_header.encoding.sample_type;
+    uint32_t const channel_count = this->_header.channel_count;
+    uint32_t const src_sample_byte_count = dsp::sample_byte_count(src_type);
+    uint32_t const dst_sample_byte_count = dsp::sample_byte_count(*dst_type);
+    uint32_t const length =
+        static_cast<uint32_t>(std::clamp<int64_t>(this->_header.frame_length - begin_frame, 0, frame_length));
+
+    if (length == 0) {
+        buffer.set_frame_length(0);
+        return true;
+    }
+
+    uint8_t const *const src = this->_data_at_frame(begin_frame);
+
+    if (src_type == *dst_type && (format.is_interleaved() || channel_count == 1)) {
+        std::copy_n(src, length * this->_header.frame_byte_count(),
+                    static_cast<uint8_t *>(buffer.audio_buffer_list()->mBuffers[0].mData));
+    } else {
+        for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+            uint32_t const buf_idx = format.is_interleaved() ? 0 : ch_idx;
+            uint32_t const dst_offset = format.is_interleaved() ? ch_idx : 0;
+            auto *const dst = static_cast<uint8_t *>(buffer.audio_buffer_list()->mBuffers[buf_idx].mData) +
+                              dst_offset * dst_sample_byte_count;
+
+            native_file_utils::convert_samples(&src[ch_idx * src_sample_byte_count], src_type, channel_count, dst,
+                                               *dst_type, format.stride(), length);
+        }
+    }
+
+    buffer.set_frame_length(length);
+
+    return true;
+}
+
+void mapped_file::set_access(access const access) {
+    madvise(this->_memory, this->_byte_count, mapped_file_utils::to_advice(access));
+}
+
+void mapped_file::prefetch(int64_t const begin_frame, uint32_t const length) const {
+    int64_t const frame_length =
+        std::clamp<int64_t>(this->_header.frame_length - begin_frame, 0, static_cast<int64_t>(length));
+
+    if (begin_frame < 0 || frame_length == 0) {
+        return;
+    }
+
+    // madvise takes the page aligned address.
+    std::size_t const page_size = static_cast<std::size_t>(getpagesize());
+    std::size_t const begin_byte = static_cast<std::size_t>(this->_data_at_frame(begin_frame) - this->_memory);
+    std::size_t const end_byte = begin_byte + static_cast<std::size_t>(frame_length) * this->_header.frame_byte_count();
+    std::size_t const aligned_begin_byte = begin_byte / page_size * page_size;
+
+    madvise(this->_memory + aligned_begin_byte, end_byte - aligned_begin_byte, MADV_WILLNEED);
+}
+
+uint8_t *mapped_file::_data_at_frame(int64_t const frame) const {
+    return this->_memory + this->_header.data_offset + frame * this->_header.frame_byte_count();
+}
+
+mapped_file_ptr mapped_file::make_opened(yas::url const &url) {
+    std::FILE *const file = std::fopen(url.path().c_str(), "rb");
+    if (!file) {
+        return nullptr;
+    }
+
+    auto const header = native_file_utils::read_header(file);
+
+    struct stat file_stat;
+    void *memory = MAP_FAILED;
+    std::size_t byte_count = 0;
+
+    if (header && header->encoding.is_big_endian == mapped_file_utils::is_host_big_endian() &&
+        header->data_offset % mapped_file_utils::sample_alignment(header->encoding.sample_type) == 0 &&
+        fstat(fileno(file), &file_stat) == 0 && file_stat.st_size > 0) {
+        byte_count = static_cast<std::size_t>(file_stat.st_size);
+        // read only not to commit memory for the copies on write that never happen.
+        memory = mmap(nullptr, byte_count, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    }
+    std::fclose(file);
+
+    if (memory == MAP_FAILED) {
+        return nullptr;
+    }
+
+    return mapped_file_ptr{new mapped_file{static_cast<uint8_t *>(memory), byte_count, *header}};
+}
@@ -0,0 +1,64 @@
+//
+//  yas_audio_mapped_file.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_native_file.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+#include <cpp_utils/yas_url.h>
+
+#include <optional>
+
+namespace yas::audio {
+// maps a wave, aiff, aifc or caf file read only to read the linear pcm data without copying it through a std::FILE.
+// the pages are loaded by the kernel when they are touched.
+struct mapped_file final {
+    enum class access {
+        normal,
+        sequential,
+        random,
+    };
+
+    ~mapped_file();
+
+    [[nodiscard]] native_file_header const &header() const;
+    // interleaved if multi channel. the pcm_format is other if the samples are not viewable as a pcm_buffer.
+    [[nodiscard]] audio::format const &file_format() const;
+    [[nodiscard]] int64_t file_length() const;
+
+    // a pcm_buffer in the file format over the mapped samples. nullopt if out of the file or the pcm_format is other.
+    // valid while the mapped_file is alive. read only. a write to it faults.
+    [[nodiscard]] std::optional<pcm_buffer> make_view(int64_t const begin_frame, uint32_t const length) const;
+
+    // converts the frames from the begin frame into the head of the buffer and sets the frame length of the buffer
+    // to the read. the interleaved samples are deinterleaved only for the read frames.
+    [[nodiscard]] bool read_into_buffer(pcm_buffer &buffer, int64_t const begin_frame,
+                                        uint32_t const frame_length) const;
+
+    // tells the kernel how the pages will be touched. sequential reads ahead more and frees the read pages sooner.
+    void set_access(access const);
+    // asks the kernel to load the pages of the frames in the background.
+    void prefetch(int64_t const begin_frame, uint32_t const length) const;
+
+    // nullptr if the file is not a supported linear pcm file in the host endianness or the samples are not aligned.
+    [[nodiscard]] static mapped_file_ptr make_opened(yas::url const &);
+
+   private:
+    uint8_t *const _memory;
+    std::size_t const _byte_count;
+    native_file_header const _header;
+    audio::format const _file_format;
+
+    mapped_file(uint8_t *const memory, std::size_t const byte_count, native_file_header const &);
+
+    uint8_t *_data_at_frame(int64_t const frame) const;
+
+    mapped_file(mapped_file const &) = delete;
+    mapped_file(mapped_file &&) = delete;
+    mapped_file &operator=(mapped_file const &) = delete;
+    mapped_file &operator=(mapped_file &&) = delete;
+};
+}  // namespace yas::audio
@@ -0,0 +1,1176 @@
+//
+//  yas_audio_native_file.cpp
+//
+
+#include "yas_audio_native_file.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "yas_audio_mapped_file.h"
+#include "yas_audio_pcm_buffer.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::native_file_utils {
+static std::size_t constexpr io_buffer_byte_count = 1 << 20;
+static uint32_t constexpr scratch_byte_count = 1 << 16;
+
+// the tail of the subformat guids of WAVE_FORMAT_EXTENSIBLE. the head 2 bytes are the format tag.
+static uint8_t constexpr wave_guid_tail[14] = {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80,
+                                               0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+static uint16_t constexpr wave_format_pcm = 0x0001;
+static uint16_t constexpr wave_format_ieee_float = 0x0003;
+static uint16_t constexpr wave_format_extensible = 0xFFFE;
+
+static uint32_t constexpr caf_linear_pcm_flag_is_float = 1;
+static uint32_t constexpr caf_linear_pcm_flag_is_little_endian = 2;
+
+static uint32_t constexpr aifc_version_1 = 0xA2805140;
+
+// the body of the ds64 chunk without the table. a junk chunk of the same size is reserved for it in a riff file.
+static uint32_t constexpr ds64_byte_count = 28;
+
+// the chunks of wave64 are identified by guids. the head 4 bytes of the guids are the ids of riff.
+static uint8_t constexpr wave64_riff_guid[16] = {'r',  'i',  'f',  'f',  0x2E, 0x91, 0xCF, 0x11,
+                                                 0xA5, 0xD6, 0x28, 0xDB, 0x04, 0xC1, 0x00, 0x00};
+static uint8_t constexpr wave64_guid_tail[12] = {0xF3, 0xAC, 0xD3, 0x11, 0x8C, 0xD1,
+                                                 0x00, 0xC0, 0x4F, 0x8E, 0xDB, 0x8A};
+static uint32_t constexpr wave64_chunk_header_byte_count = 24;
+
+static bool is_host_big_endian() {
+    uint16_t const value = 1;
+    return *reinterpret_cast<uint8_t const *>(&value) == 0;
+}
+
+static uint64_t load_le(uint8_t const *const bytes, uint32_t const byte_count) {
+    uint64_t value = 0;
+    for (uint32_t idx = 0; idx < byte_count; ++idx) {
+        value |= static_cast<uint64_t>(bytes[idx]) << (idx * 8);
+    }
+    return value;
+}
+
+static uint64_t load_be(uint8_t const *const bytes, uint32_t const byte_count) {
+    uint64_t value = 0;
+    for (uint32_t idx = 0; idx < byte_count; ++idx) {
+        value = (value << 8) | bytes[idx];
+    }
+    return value;
+}
+
+static void append_le(std::vector<uint8_t> &bytes, uint64_t const value, uint32_t const byte_count) {
+    for (uint32_t idx = 0; idx < byte_count; ++idx) {
+        bytes.push_back(static_cast<uint8_t>(value >> (idx * 8)));
+    }
+}
+
+static void append_be(std::vector<uint8_t> &bytes, uint64_t const value, uint32_t const byte_count) {
+    for (uint32_t idx = byte_count; idx > 0; --idx) {
+        bytes.push_back(static_cast<uint8_t>(value >> ((idx - 1) * 8)));
+    }
+}
+
+static void append_id(std::vector<uint8_t> &bytes, char const *const id) {
+    bytes.insert(bytes.end(), id, id + 4);
+}
+
+static bool is_id(uint8_t const *const bytes, char const *const id) {
+    return std::memcmp(bytes, id, 4) == 0;
+}
+
+static void append_wave64_guid(std::vector<uint8_t> &bytes, char const *const id) {
+    append_id(bytes, id);
+    bytes.insert(bytes.end(), std::begin(wave64_guid_tail), std::end(wave64_guid_tail));
+}
+
+static bool is_wave64_guid(uint8_t const *const bytes, char const *const id) {
+    return is_id(bytes, id) && std::memcmp(&bytes[4], wave64_guid_tail, 12) == 0;
+}
+
+static bool seek(std::FILE *const file, int64_t const offset) {
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+}
+
+static bool read_bytes(std::FILE *const file, uint8_t *const bytes, std::size_t const byte_count) {
+    return std::fread(bytes, 1, byte_count, file) == byte_count;
+}
+
+static bool sync(std::FILE *const file) {
+#if defined(__APPLE__)
+    // fdatasync is not declared on darwin. F_FULLFSYNC would flush the cache of the drive at a much higher cost.
+    return fsync(fileno(file)) == 0;
+#else
+    return fdatasync(fileno(file)) == 0;
+#endif
+}
+
+static int64_t file_byte_count(std::FILE *const file) {
+    if (fseeko(file, 0, SEEK_END) != 0) {
+        return -1;
+    }
+    return static_cast<int64_t>(ftello(file));
+}
+
+static std::optional<dsp::sample_type> to_integer_sample_type(uint32_t const sample_byte_count) {
+    switch (sample_byte_count) {
+        case 2:
+            return dsp::sample_type::int16;
+        case 3:
+            return dsp::sample_type::int24;
+        case 4:
+            return dsp::sample_type::int32;
+        default:
+            return std::nullopt;
+    }
+}
+
+static std::optional<dsp::sample_type> to_float_sample_type(uint32_t const sample_byte_count) {
+    switch (sample_byte_count) {
+        case 4:
+            return dsp::sample_type::float32;
+        case 8:
+            return dsp::sample_type::float64;
+        default:
+            return std::nullopt;
+    }
+}
+
+static bool is_float(dsp::sample_type const type) {
+    return type == dsp::sample_type::float32 || type == dsp::sample_type::float64;
+}
+
+// the chunks after the data are aligned to even bytes. to 8 bytes in wave64.
+static uint64_t padding_byte_count(audio::file_type const file_type, uint64_t const data_byte_count) {
+    switch (file_type) {
+        case file_type::core_audio_format:
+            return 0;
+        case file_type::wave64:
+            return (8 - data_byte_count % 8) % 8;
+        default:
+            return data_byte_count & 1;
+    }
+}
+
+// the fmt chunk is the same in riff, rf64, bw64 and wave64.
+static std::optional<native_file_header> read_wave_fmt(std::FILE *const file, audio::file_type const file_type,
+                                                       int64_t const chunk_byte_count) {
+    uint8_t fmt[40] = {0};
+    if (chunk_byte_count < 16 || !read_bytes(file, fmt, std::min<int64_t>(chunk_byte_count, 40))) {
+        return std::nullopt;
+    }
+
+    uint32_t format_tag = static_cast<uint32_t>(load_le(&fmt[0], 2));
+    uint32_t const channel_count = static_cast<uint32_t>(load_le(&fmt[2], 2));
+    uint32_t const sample_rate = static_cast<uint32_t>(load_le(&fmt[4], 4));
+    uint32_t const block_align = static_cast<uint32_t>(load_le(&fmt[12], 2));
+
+    if (format_tag == wave_format_extensible) {
+        if (chunk_byte_count < 40 || std::memcmp(&fmt[26], wave_guid_tail, 14) != 0) {
+            return std::nullopt;
+        }
+        format_tag = static_cast<uint32_t>(load_le(&fmt[24], 2));
+    }
+
+    if (channel_count == 0 || sample_rate == 0 || block_align % channel_count != 0) {
+        return std::nullopt;
+    }
+
+    uint32_t const sample_byte_count = block_align / channel_count;
+    std::optional<dsp::sample_type> sample_type = std::nullopt;
+
+    if (format_tag == wave_format_pcm) {
+        sample_type = to_integer_sample_type(sample_byte_count);
+    } else if (format_tag == wave_format_ieee_float) {
+        sample_type = to_float_sample_type(sample_byte_count);
+    }
+
+    if (!sample_type) {
+        return std::nullopt;
+    }
+
+    return native_file_header{.file_type = file_type,
+                              .sample_rate = static_cast<double>(sample_rate),
+                              .channel_count = channel_count,
+                              .encoding = {.sample_type = *sample_type, .is_big_endian = false}};
+}
+
+static std::optional<native_file_header> read_wave_header(std::FILE *const file, int64_t const file_byte_count,
+                                                          audio::file_type const file_type) {
+    std::optional<native_file_header> header = std::nullopt;
+    std::optional<int64_t> data_offset = std::nullopt;
+    std::optional<int64_t> ds64_data_byte_count = std::nullopt;
+    int64_t data_byte_count = 0;
+    int64_t offset = 12;
+
+    // the fmt chunk is rarely after the data chunk.
+    while (offset + 8 <= file_byte_count && !(header && data_offset)) {
+        uint8_t chunk[8];
+        if (!seek(file, offset) || !read_bytes(file, chunk, 8)) {
+            return std::nullopt;
+        }
+
+        int64_t const body_offset = offset + 8;
+        int64_t chunk_byte_count = load_le(&chunk[4], 4);
+
+        if (is_id(chunk, "ds64")) {
+            uint8_t ds64[ds64_byte_count];
+            if (chunk_byte_count < ds64_byte_count || !read_bytes(file, ds64, ds64_byte_count)) {
+                return std::nullopt;
+            }
+            ds64_data_byte_count = static_cast<int64_t>(load_le(&ds64[8], 8));
+        } else if (is_id(chunk, "fmt ")) {
+            header = read_wave_fmt(file, file_type, chunk_byte_count);
+            if (!header) {
+                return std::nullopt;
+            }
+        } else if (is_id(chunk, "data")) {
+            // the size in the ds64 chunk of a rf64 or bw64 file overrides the size of 0xFFFFFFFF.
+            if (ds64_data_byte_count && chunk_byte_count == UINT32_MAX) {
+                chunk_byte_count = *ds64_data_byte_count;
+            }
+            data_offset = body_offset;
+            data_byte_count = std::min(chunk_byte_count, file_byte_count - body_offset);
+        }
+
+        offset = body_offset + chunk_byte_count + (chunk_byte_count & 1);
+    }
+
+    if (!header || !data_offset) {
+        return std::nullopt;
+    }
+
+    header->data_offset = *data_offset;
+    header->frame_length = data_byte_count / header->frame_byte_count();
+
+    return header;
+}
+
+static std::optional<native_file_header> read_wave64_header(std::FILE *const file, int64_t const file_byte_count) {
+    std::optional<native_file_header> header = std::nullopt;
+    std::optional<int64_t> data_offset = std::nullopt;
+    int64_t data_byte_count = 0;
+    int64_t offset = 40;
+
+    while (offset + wave64_chunk_header_byte_count <= file_byte_count && !(header && data_offset)) {
+        uint8_t chunk[wave64_chunk_header_byte_count];
+        if (!seek(file, offset) || !read_bytes(file, chunk, wave64_chunk_header_byte_count)) {
+            return std::nullopt;
+        }
+
+        int64_t const body_offset = offset + wave64_chunk_header_byte_count;
+        // the sizes of wave64 include the guid and the size.
+        int64_t const chunk_byte_count = static_cast<int64_t>(load_le(&chunk[16], 8)) - wave64_chunk_header_byte_count;
+
+        if (chunk_byte_count < 0) {
+            return std::nullopt;
+        }
+
+        if (is_wave64_guid(chunk, "fmt ")) {
+            header = read_wave_fmt(file, file_type::wave64, chunk_byte_count);
+            if (!header) {
+                return std::nullopt;
+            }
+        } else if (is_wave64_guid(chunk, "data")) {
+            data_offset = body_offset;
+            data_byte_count = std::min(chunk_byte_count, file_byte_count - body_offset);
+        }
+
+        // the chunks are aligned to 8 bytes.
+        offset = body_offset + ((chunk_byte_count + 7) & ~int64_t(7));
+    }
+
+    if (!header || !data_offset) {
+        return std::nullopt;
+    }
+
+    header->data_offset = *data_offset;
+    header->frame_length = data_byte_count / header->frame_byte_count();
+
+    return header;
+}
+
+static std::optional<native_file_header> read_aiff_header(std::FILE *const file, int64_t const file_byte_count,
+                                                          bool const is_aifc) {
+    std::optional<native_file_header> header = std::nullopt;
+    std::optional<int64_t> data_offset = std::nullopt;
+    int64_t data_byte_count = 0;
+    int64_t comm_frame_length = 0;
+    int64_t offset = 12;
+
+    while (offset + 8 <= file_byte_count && !(header && data_offset)) {
+        uint8_t chunk[8];
+        if (!seek(file, offset) || !read_bytes(file, chunk, 8)) {
+            return std::nullopt;
+        }
+
+        int64_t const body_offset = offset + 8;
+        int64_t const chunk_byte_count = load_be(&chunk[4], 4);
+
+        if (is_id(chunk, "COMM")) {
+            uint8_t comm[22] = {0};
+            uint32_t const comm_byte_count = is_aifc ? 22 : 18;
+            if (chunk_byte_count < comm_byte_count || !read_bytes(file, comm, comm_byte_count)) {
+                return std::nullopt;
+            }
+
+            uint32_t const channel_count = static_cast<uint32_t>(load_be(&comm[0], 2));
+            comm_frame_length = static_cast<int64_t>(load_be(&comm[2], 4));
+            uint32_t const sample_byte_count = (static_cast<uint32_t>(load_be(&comm[6], 2)) + 7) / 8;
+            double const sample_rate = to_float64_from_extended(&comm[8]);
+
+            std::optional<dsp::sample_type> sample_type = to_integer_sample_type(sample_byte_count);
+            bool is_big_endian = true;
+
+            if (is_aifc && !is_id(&comm[18], "NONE") && !is_id(&comm[18], "twos")) {
+                if (is_id(&comm[18], "sowt")) {
+                    is_big_endian = false;
+                } else if (is_id(&comm[18], "fl32") || is_id(&comm[18], "FL32") || is_id(&comm[18], "fl64") ||
+                           is_id(&comm[18], "FL64")) {
+                    sample_type = to_float_sample_type(sample_byte_count);
+                } else {
+                    sample_type = std::nullopt;
+                }
+            }
+
+            if (channel_count == 0 || sample_rate <= 0.0 || !sample_type) {
+                return std::nullopt;
+            }
+
+            header = native_file_header{.file_type = is_aifc ? file_type::aifc : file_type::aiff,
+                                        .sample_rate = sample_rate,
+                                        .channel_count = channel_count,
+                                        .encoding = {.sample_type = *sample_type, .is_big_endian = is_big_endian}};
+        } else if (is_id(chunk, "SSND")) {
+            uint8_t ssnd[8];
+            if (chunk_byte_count < 8 || !read_bytes(file, ssnd, 8)) {
+                return std::nullopt;
+            }
+
+            int64_t const ssnd_offset = static_cast<int64_t>(load_be(&ssnd[0], 4));
+            data_offset = body_offset + 8 + ssnd_offset;
+            data_byte_count = std::min(chunk_byte_count - 8 - ssnd_offset, file_byte_count - *data_offset);
+        }
+
+        offset = body_offset + chunk_byte_count + (chunk_byte_count & 1);
+    }
+
+    if (!header || !data_offset || data_byte_count < 0) {
+        return std::nullopt;
+    }
+
+    header->data_offset = *data_offset;
+    header->frame_length = std::min(comm_frame_length, data_byte_count / header->frame_byte_count());
+
+    return header;
+}
+
+static std::optional<native_file_header> read_caf_header(std::FILE *const file, int64_t const file_byte_count) {
+    std::optional<native_file_header> header = std::nullopt;
+    std::optional<int64_t> data_offset = std::nullopt;
+    int64_t data_byte_count = 0;
+    int64_t offset = 8;
+
+    while (offset + 12 <= file_byte_count && !(header && data_offset)) {
+        uint8_t chunk[12];
+        if (!seek(file, offset) || !read_bytes(file, chunk, 12)) {
+            return std::nullopt;
+        }
+
+        int64_t const body_offset = offset + 12;
+        int64_t const chunk_byte_count = static_cast<int64_t>(load_be(&chunk[4], 8));
+
+        if (is_id(chunk, "desc")) {
+            uint8_t desc[32];
+            if (chunk_byte_count < 32 || !read_bytes(file, desc, 32)) {
+                return std::nullopt;
+            }
+
+            uint64_t const sample_rate_bits = load_be(&desc[0], 8);
+            double sample_rate = 0.0;
+            std::memcpy(&sample_rate, &sample_rate_bits, 8);
+            uint32_t const flags = static_cast<uint32_t>(load_be(&desc[12], 4));
+            uint32_t const bytes_per_packet = static_cast<uint32_t>(load_be(&desc[16], 4));
+            uint32_t const frames_per_packet = static_cast<uint32_t>(load_be(&desc[20], 4));
+            uint32_t const channel_count = static_cast<uint32_t>(load_be(&desc[24], 4));
+
+            if (!is_id(&desc[8], "lpcm") || frames_per_packet != 1 || channel_count == 0 || sample_rate <= 0.0 ||
+                bytes_per_packet % channel_count != 0) {
+                return std::nullopt;
+            }
+
+            uint32_t const sample_byte_count = bytes_per_packet / channel_count;
+            auto const sample_type = (flags & caf_linear_pcm_flag_is_float) ?
+                                         to_float_sample_type(sample_byte_count) :
+                                         to_integer_sample_type(sample_byte_count);
+
+            if (!sample_type) {
+                return std::nullopt;
+            }
+
+            header = native_file_header{
+                .file_type = file_type::core_audio_format,
+                .sample_rate = sample_rate,
+                .channel_count = channel_count,
+                .encoding = {.sample_type = *sample_type,
+                             .is_big_endian = !(flags & caf_linear_pcm_flag_is_little_endian)}};
+        } else if (is_id(chunk, "data")) {
+            // skips the edit count. the size is -1 while the file is being written.
+            data_offset = body_offset + 4;
+            data_byte_count = chunk_byte_count < 0 ? file_byte_count - *data_offset :
+                                                     std::min(chunk_byte_count - 4, file_byte_count - *data_offset);
+
+            if (chunk_byte_count < 0) {
+                break;
+            }
+        }
+
+        offset = body_offset + chunk_byte_count;
+    }
+
+    if (!header || !data_offset || data_byte_count < 0) {
+        return std::nullopt;
+    }
+
+    header->data_offset = *data_offset;
+    header->frame_length = data_byte_count / header->frame_byte_count();
+
+    return header;
+}
+
+static std::vector<uint8_t> make_wave_fmt_bytes(native_file_header const &header) {
+    auto const &encoding = header.encoding;
+    uint32_t const sample_byte_count = dsp::sample_byte_count(encoding.sample_type);
+    uint32_t const frame_byte_count = header.frame_byte_count();
+    uint16_t const format_tag = is_float(encoding.sample_type) ? wave_format_ieee_float : wave_format_pcm;
+    bool const is_extensible = header.channel_count > 2 || (format_tag == wave_format_pcm && sample_byte_count > 2);
+
+    std::vector<uint8_t> bytes;
+    append_le(bytes, is_extensible ? wave_format_extensible : format_tag, 2);
+    append_le(bytes, header.channel_count, 2);
+    append_le(bytes, static_cast<uint32_t>(std::round(header.sample_rate)), 4);
+    append_le(bytes, static_cast<uint32_t>(std::round(header.sample_rate)) * frame_byte_count, 4);
+    append_le(bytes, frame_byte_count, 2);
+    append_le(bytes, sample_byte_count * 8, 2);
+
+    if (is_extensible) {
+        append_le(bytes, 22, 2);
+        append_le(bytes, sample_byte_count * 8, 2);
+        // assigns the speakers in the order of the channel mask bits.
+        append_le(bytes, header.channel_count <= 18 ? (1u << header.channel_count) - 1 : 0, 4);
+        append_le(bytes, format_tag, 2);
+        bytes.insert(bytes.end(), std::begin(wave_guid_tail), std::end(wave_guid_tail));
+    }
+
+    return bytes;
+}
+
+static std::vector<uint8_t> make_wave_header_bytes(native_file_header const &header) {
+    auto const fmt = make_wave_fmt_bytes(header);
+    uint64_t const data_byte_count = header.frame_length * header.frame_byte_count();
+    uint64_t const riff_byte_count = 4 + 8 + ds64_byte_count + 8 + fmt.size() + 8 + data_byte_count +
+                                     padding_byte_count(header.file_type, data_byte_count);
+    // a wave file is promoted to rf64 past the 32 bit sizes. the ds64 chunk replaces the junk chunk without moving
+    // the data.
+    bool const is_ds64 = header.file_type != file_type::wave || riff_byte_count > UINT32_MAX;
+
+    std::vector<uint8_t> bytes;
+    append_id(bytes, header.file_type == file_type::bw64 ? "BW64" : (is_ds64 ? "RF64" : "RIFF"));
+    append_le(bytes, is_ds64 ? UINT32_MAX : riff_byte_count, 4);
+    append_id(bytes, "WAVE");
+
+    append_id(bytes, is_ds64 ? "ds64" : "JUNK");
+    append_le(bytes, ds64_byte_count, 4);
+    append_le(bytes, is_ds64 ? riff_byte_count : 0, 8);
+    append_le(bytes, is_ds64 ? data_byte_count : 0, 8);
+    append_le(bytes, is_ds64 ? header.frame_length : 0, 8);
+    append_le(bytes, 0, 4);
+
+    append_id(bytes, "fmt ");
+    append_le(bytes, fmt.size(), 4);
+    bytes.insert(bytes.end(), fmt.begin(), fmt.end());
+
+    append_id(bytes, "data");
+    append_le(bytes, is_ds64 ? UINT32_MAX : data_byte_count, 4);
+
+    return bytes;
+}
+
+static std::vector<uint8_t> make_wave64_header_bytes(native_file_header const &header) {
+    auto const fmt = make_wave_fmt_bytes(header);
+    // the fmt body of 16 or 40 bytes keeps the data aligned to 8 bytes.
+    uint64_t const fmt_chunk_byte_count = wave64_chunk_header_byte_count + fmt.size();
+    uint64_t const data_byte_count = header.frame_length * header.frame_byte_count();
+    uint64_t const riff_byte_count = 40 + fmt_chunk_byte_count + wave64_chunk_header_byte_count + data_byte_count +
+                                     padding_byte_count(header.file_type, data_byte_count);
+
+    std::vector<uint8_t> bytes;
+    bytes.insert(bytes.end(), std::begin(wave64_riff_guid), std::end(wave64_riff_guid));
+    append_le(bytes, riff_byte_count, 8);
+    append_wave64_guid(bytes, "wave");
+
+    append_wave64_guid(bytes, "fmt ");
+    append_le(bytes, fmt_chunk_byte_count, 8);
+    bytes.insert(bytes.end(), fmt.begin(), fmt.end());
+
+    append_wave64_guid(bytes, "data");
+    append_le(bytes, wave64_chunk_header_byte_count + data_byte_count, 8);
+
+    return bytes;
+}
+
+static std::vector<uint8_t> make_aiff_header_bytes(native_file_header const &header) {
+    auto const &encoding = header.encoding;
+    bool const is_aifc = header.file_type == file_type::aifc;
+    uint64_t const data_byte_count = header.frame_length * header.frame_byte_count();
+
+    char const *compression_type = "NONE";
+    char const *compression_name = "not compressed";
+
+    if (encoding.sample_type == dsp::sample_type::float32) {
+        compression_type = "fl32";
+        compression_name = "32-bit floating point";
+    } else if (encoding.sample_type == dsp::sample_type::float64) {
+        compression_type = "fl64";
+        compression_name = "64-bit floating point";
+    } else if (!encoding.is_big_endian) {
+        compression_type = "sowt";
+        compression_name = "";
+    }
+
+    std::vector<uint8_t> comm;
+    append_be(comm, header.channel_count, 2);
+    append_be(comm, header.frame_length, 4);
+    append_be(comm, dsp::sample_byte_count(encoding.sample_type) * 8, 2);
+    uint8_t rate[10];
+    to_extended_from_float64(header.sample_rate, rate);
+    comm.insert(comm.end(), std::begin(rate), std::end(rate));
+
+    if (is_aifc) {
+        std::size_t const name_length = std::strlen(compression_name);
+        append_id(comm, compression_type);
+        comm.push_back(static_cast<uint8_t>(name_length));
+        comm.insert(comm.end(), compression_name, compression_name + name_length);
+        if (comm.size() & 1) {
+            comm.push_back(0);
+        }
+    }
+
+    uint64_t const fver_byte_count = is_aifc ? 12 : 0;
+
+    std::vector<uint8_t> bytes;
+    append_id(bytes, "FORM");
+    append_be(bytes, 4 + fver_byte_count + 8 + comm.size() + 16 + data_byte_count + (data_byte_count & 1), 4);
+    append_id(bytes, is_aifc ? "AIFC" : "AIFF");
+
+    if (is_aifc) {
+        append_id(bytes, "FVER");
+        append_be(bytes, 4, 4);
+        append_be(bytes, aifc_version_1, 4);
+    }
+
+    append_id(bytes, "COMM");
+    append_be(bytes, comm.size(), 4);
+    bytes.insert(bytes.end(), comm.begin(), comm.end());
+
+    append_id(bytes, "SSND");
+    append_be(bytes, 8 + data_byte_count, 4);
+    append_be(bytes, 0, 4);
+    append_be(bytes, 0, 4);
+
+    return bytes;
+}
+
+static std::vector<uint8_t> make_caf_header_bytes(native_file_header const &header) {
+    auto const &encoding = header.encoding;
+    uint32_t const sample_byte_count = dsp::sample_byte_count(encoding.sample_type);
+    uint32_t flags = is_float(encoding.sample_type) ? caf_linear_pcm_flag_is_float : 0;
+    if (!encoding.is_big_endian) {
+        flags |= caf_linear_pcm_flag_is_little_endian;
+    }
+    uint64_t sample_rate_bits = 0;
+    std::memcpy(&sample_rate_bits, &header.sample_rate, 8);
+
+    std::vector<uint8_t> bytes;
+    append_id(bytes, "caff");
+    append_be(bytes, 1, 2);
+    append_be(bytes, 0, 2);
+
+    append_id(bytes, "desc");
+    append_be(bytes, 32, 8);
+    append_be(bytes, sample_rate_bits, 8);
+    append_id(bytes, "lpcm");
+    append_be(bytes, flags, 4);
+    append_be(bytes, header.frame_byte_count(), 4);
+    append_be(bytes, 1, 4);
+    append_be(bytes, header.channel_count, 4);
+    append_be(bytes, sample_byte_count * 8, 4);
+
+    append_id(bytes, "data");
+    append_be(bytes, 4 + header.frame_length * header.frame_byte_count(), 8);
+    append_be(bytes, 0, 4);
+
+    return bytes;
+}
+
+template <typename T>
+static void copy_samples(void const *const src, uint32_t const src_stride, void *const dst, uint32_t const dst_stride,
+                         uint32_t const length) {
+    auto const *const src_data = static_cast<T const *>(src);
+    auto *const dst_data = static_cast<T *>(dst);
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        dst_data[idx * dst_stride] = src_data[idx * src_stride];
+    }
+}
+
+// copies the samples of the same type between the strides without converting them through float32.
+static void copy_samples(void const *const src, uint32_t const src_stride, void *const dst, uint32_t const dst_stride,
+                         uint32_t const sample_byte_count, uint32_t const length) {
+    switch (sample_byte_count) {
+        case 2:
+            copy_samples<int16_t>(src, src_stride, dst, dst_stride, length);
+            break;
+        case 4:
+            copy_samples<int32_t>(src, src_stride, dst, dst_stride, length);
+            break;
+        case 8:
+            copy_samples<int64_t>(src, src_stride, dst, dst_stride, length);
+            break;
+        default: {
+            auto const *const src_data = static_cast<uint8_t const *>(src);
+            auto *const dst_data = static_cast<uint8_t *>(dst);
+            for (uint32_t idx = 0; idx < length; ++idx) {
+                std::memcpy(&dst_data[idx * dst_stride * sample_byte_count],
+                            &src_data[idx * src_stride * sample_byte_count], sample_byte_count);
+            }
+        } break;
+    }
+}
+}  // namespace yas::audio::native_file_utils
+
+#pragma mark - native_file_encoding
+
+bool native_file_encoding::operator==(native_file_encoding const &rhs) const {
+    return this->sample_type == rhs.sample_type && this->is_big_endian == rhs.is_big_endian;
+}
+
+bool native_file_encoding::operator!=(native_file_encoding const &rhs) const {
+    return !(*this == rhs);
+}
+
+#pragma mark - native_file_header
+
+uint32_t native_file_header::frame_byte_count() const {
+    return dsp::sample_byte_count(this->encoding.sample_type) * this->channel_count;
+}
+
+#pragma mark - native_file
+
+native_file::native_file(std::FILE *const file, std::vector<char> &&io_buffer, native_file_header const &header,
+                         bool const is_writable, mapped_file_ptr const &mapping)
+    : _file(file),
+      _io_buffer(std::move(io_buffer)),
+      _scratch(std::max(native_file_utils::scratch_byte_count, header.frame_byte_count())),
+      _header(header),
+      _file_format(native_file_utils::to_stream_description(header)),
+      _is_writable(is_writable),
+      _mapping(mapping) {
+}
+
+native_file::~native_file() {
+    this->close();
+}
+
+native_file_header const &native_file::header() const {
+    return this->_header;
+}
+
+format const &native_file::file_format() const {
+    return this->_file_format;
+}
+
+bool native_file::is_writable() const {
+    return this->_is_writable;
+}
+
+int64_t native_file::file_length() const {
+    return this->_header.frame_length;
+}
+
+int64_t native_file::file_frame_position() const {
+    return this->_frame_position;
+}
+
+mapped_file_ptr const &native_file::mapping() const {
+    return this->_mapping;
+}
+
+bool native_file::can_process(format const &format) const {
+    return format.sample_rate() == this->_header.sample_rate && format.channel_count() == this->_header.channel_count &&
+           dsp::to_dsp_sample_type(format.pcm_format()).has_value();
+}
+
+bool native_file::set_file_frame_position(int64_t const position) {
+    if (!this->_file || position < 0 || position > this->_header.frame_length) {
+        return false;
+    }
+
+    int64_t const byte_offset = this->_header.data_offset + position * this->_header.frame_byte_count();
+
+    if (!this->_mapping && !native_file_utils::seek(this->_file, byte_offset)) {
+        return false;
+    }
+
+    this->_frame_position = position;
+
+    return true;
+}
+
+bool native_file::read_into_buffer(pcm_buffer &buffer, uint32_t const frame_length) {
+    auto const &format = buffer.format();
+
+    if (!this->_file || this->_is_writable || !this->can_process(format) || buffer.frame_capacity() < frame_length) {
+        return false;
+    }
+
+    if (this->_mapping) {
+        if (!this->_mapping->read_into_buffer(buffer, this->_frame_position, frame_length)) {
+            return false;
+        }
+
+        this->_frame_position += buffer.frame_length();
+
+        return true;
+    }
+
+    auto const &encoding = this->_header.encoding;
+    auto const dst_type = *dsp::to_dsp_sample_type(format.pcm_format());
+    uint32_t const channel_count = this->_header.channel_count;
+    uint32_t const src_sample_byte_count = dsp::sample_byte_count(encoding.sample_type);
+    uint32_t const src_frame_byte_count = this->_header.frame_byte_count();
+    uint32_t const dst_sample_byte_count = dsp::sample_byte_count(dst_type);
+    bool const is_swapped = encoding.is_big_endian != native_file_utils::is_host_big_endian();
+    // the file data is the same as the buffer storage.
+    bool const is_direct = encoding.sample_type == dst_type && (format.is_interleaved() || channel_count == 1);
+
+    uint32_t const scratch_frame_length = static_cast<uint32_t>(this->_scratch.size()) / src_frame_byte_count;
+    uint32_t const length = static_cast<uint32_t>(
+        std::clamp<int64_t>(this->_header.frame_length - this->_frame_position, 0, frame_length));
+    uint32_t read_length = 0;
+
+    while (read_length < length) {
+        uint32_t const chunk_length =
+            is_direct ? length - read_length : std::min(length - read_length, scratch_frame_length);
+        uint8_t *src = this->_scratch.data();
+
+        if (is_direct) {
+            src = static_cast<uint8_t *>(buffer.audio_buffer_list()->mBuffers[0].mData) +
+                  read_length * src_frame_byte_count;
+        }
+
+        uint32_t const chunk_read_length =
+            static_cast<uint32_t>(std::fread(src, src_frame_byte_count, chunk_length, this->_file));
+
+        if (is_swapped) {
+            native_file_utils::swap_bytes(src, src_sample_byte_count, chunk_read_length * channel_count);
+        }
+
+        if (!is_direct) {
+            for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                uint32_t const buf_idx = format.is_interleaved() ? 0 : ch_idx;
+                uint32_t const dst_offset =
+                    format.is_interleaved() ? read_length * channel_count + ch_idx : read_length;
+                auto *const dst = static_cast<uint8_t *>(buffer.audio_buffer_list()->mBuffers[buf_idx].mData) +
+                                  dst_offset * dst_sample_byte_count;
+
+                native_file_utils::convert_samples(&src[ch_idx * src_sample_byte_count], encoding.sample_type,
+                                                   channel_count, dst, dst_type, format.stride(), chunk_read_length);
+            }
+        }
+
+        read_length += chunk_read_length;
+
+        if (chunk_read_length < chunk_length) {
+            break;
+        }
+    }
+
+    this->_frame_position += read_length;
+    buffer.set_frame_length(read_length);
+
+    return std::ferror(this->_file) == 0;
+}
+
+bool native_file::write_from_buffer(pcm_buffer const &buffer) {
+    auto const &format = buffer.format();
+
+    if (!this->_file || !this->_is_writable || !this->can_process(format)) {
+        return false;
+    }
+
+    auto const &encoding = this->_header.encoding;
+    auto const src_type = *dsp::to_dsp_sample_type(format.pcm_format());
+    uint32_t const channel_count = this->_header.channel_count;
+    uint32_t const dst_sample_byte_count = dsp::sample_byte_count(encoding.sample_type);
+    uint32_t const dst_frame_byte_count = this->_header.frame_byte_count();
+    uint32_t const src_sample_byte_count = dsp::sample_byte_count(src_type);
+    bool const is_swapped = encoding.is_big_endian != native_file_utils::is_host_big_endian();
+    // the buffer storage is written as it is. swapping needs the scratch not to modify the buffer.
+    bool const is_direct =
+        encoding.sample_type == src_type && (format.is_interleaved() || channel_count == 1) && !is_swapped;
+
+    uint32_t const scratch_frame_length = static_cast<uint32_t>(this->_scratch.size()) / dst_frame_byte_count;
+    uint32_t const length = buffer.frame_length();
+    uint32_t written_length = 0;
+
+    // the sizes of aiff are 32 bits. a wave file is promoted to rf64 and the sizes of caf are 64 bits.
+    if ((this->_header.file_type == file_type::aiff || this->_header.file_type == file_type::aifc) &&
+        this->_header.data_offset + (this->_frame_position + length) * dst_frame_byte_count >= UINT32_MAX) {
+        return false;
+    }
+
+    while (written_length < length) {
+        uint32_t const chunk_length =
+            is_direct ? length - written_length : std::min(length - written_length, scratch_frame_length);
+        uint8_t const *dst = nullptr;
+
+        if (is_direct) {
+            dst = static_cast<uint8_t const *>(buffer.audio_buffer_list()->mBuffers[0].mData) +
+                  written_length * dst_frame_byte_count;
+        } else {
+            for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                uint32_t const buf_idx = format.is_interleaved() ? 0 : ch_idx;
+                uint32_t const src_offset =
+                    format.is_interleaved() ? written_length * channel_count + ch_idx : written_length;
+                auto const *const src =
+                    static_cast<uint8_t const *>(buffer.audio_buffer_list()->mBuffers[buf_idx].mData) +
+                    src_offset * src_sample_byte_count;
+
+                native_file_utils::convert_samples(src, src_type, format.stride(),
+                                                   &this->_scratch[ch_idx * dst_sample_byte_count],
+                                                   encoding.sample_type, channel_count, chunk_length);
+            }
+
+            if (is_swapped) {
+                native_file_utils::swap_bytes(this->_scratch.data(), dst_sample_byte_count,
+                                              chunk_length * channel_count);
+            }
+
+            dst = this->_scratch.data();
+        }
+
+        if (std::fwrite(dst, dst_frame_byte_count, chunk_length, this->_file) != chunk_length) {
+            return false;
+        }
+
+        written_length += chunk_length;
+        this->_frame_position += chunk_length;
+        this->_header.frame_length = std::max(this->_header.frame_length, this->_frame_position);
+    }
+
+    return true;
+}
+
+bool native_file::flush(bool const sync) {
+    if (!this->_file || !this->_is_writable) {
+        return false;
+    }
+
+    if (!this->_write_header() || std::fflush(this->_file) != 0) {
+        return false;
+    }
+
+    return !sync || native_file_utils::sync(this->_file);
+}
+
+void native_file::close() {
+    if (!this->_file) {
+        return;
+    }
+
+    if (this->_is_writable) {
+        int64_t const data_byte_count = this->_header.frame_length * this->_header.frame_byte_count();
+
+        uint64_t const padding_byte_count =
+            native_file_utils::padding_byte_count(this->_header.file_type, data_byte_count);
+
+        if (padding_byte_count > 0 &&
+            native_file_utils::seek(this->_file, this->_header.data_offset + data_byte_count)) {
+            for (uint64_t idx = 0; idx < padding_byte_count; ++idx) {
+                std::fputc(0, this->_file);
+            }
+        }
+
+        this->_write_header();
+    }
+
+    std::fclose(this->_file);
+    this->_file = nullptr;
+}
+
+bool native_file::_write_header() {
+    auto const bytes = native_file_utils::make_header_bytes(this->_header);
+
+    if (!native_file_utils::seek(this->_file, 0) ||
+        std::fwrite(bytes.data(), 1, bytes.size(), this->_file) != bytes.size()) {
+        return false;
+    }
+
+    return native_file_utils::seek(
+        this->_file, this->_header.data_offset + this->_frame_position * this->_header.frame_byte_count());
+}
+
+native_file_ptr native_file::make_opened(yas::url const &url, bool const mapped) {
+    std::FILE *const file = std::fopen(url.path().c_str(), "rb");
+    if (!file) {
+        return nullptr;
+    }
+
+    std::vector<char> io_buffer(native_file_utils::io_buffer_byte_count);
+    std::setvbuf(file, io_buffer.data(), _IOFBF, io_buffer.size());
+
+    auto const header = native_file_utils::read_header(file);
+    if (!header || !native_file_utils::seek(file, header->data_offset)) {
+        std::fclose(file);
+        return nullptr;
+    }
+
+    auto const mapping = mapped ? mapped_file::make_opened(url) : nullptr;
+
+    return native_file_ptr{new native_file{file, std::move(io_buffer), *header, false, mapping}};
+}
+
+native_file_ptr native_file::make_created(yas::url const &url, audio::file_type const file_type,
+                                          format const &file_format) {
+    auto const encoding = native_file_utils::to_encoding(file_format.stream_description());
+    if (!encoding || !native_file_utils::is_supported(file_type, *encoding)) {
+        return nullptr;
+    }
+
+    native_file_header header{.file_type = file_type,
+                              .sample_rate = file_format.sample_rate(),
+                              .channel_count = file_format.channel_count(),
+                              .encoding = *encoding};
+    header.data_offset = static_cast<int64_t>(native_file_utils::make_header_bytes(header).size());
+
+    std::FILE *const file = std::fopen(url.path().c_str(), "wb");
+    if (!file) {
+        return nullptr;
+    }
+
+    std::vector<char> io_buffer(native_file_utils::io_buffer_byte_count);
+    std::setvbuf(file, io_buffer.data(), _IOFBF, io_buffer.size());
+
+    auto shared = native_file_ptr{new native_file{file, std::move(io_buffer), header, true, nullptr}};
+
+    if (!shared->_write_header()) {
+        return nullptr;
+    }
+
+    return shared;
+}
+
+#pragma mark - native_file_utils
+
+std::optional<native_file_encoding> native_file_utils::to_encoding(AudioStreamBasicDescription const &asbd) {
+    uint32_t const channel_count = asbd.mChannelsPerFrame;
+
+    if (asbd.mFormatID != kAudioFormatLinearPCM || channel_count == 0 || asbd.mFramesPerPacket != 1 ||
+        ((asbd.mFormatFlags & kAudioFormatFlagIsNonInterleaved) && channel_count > 1) ||
+        (asbd.mFormatFlags & kLinearPCMFormatFlagsSampleFractionMask)) {
+        return std::nullopt;
+    }
+
+    uint32_t const sample_byte_count = asbd.mBitsPerChannel / 8;
+
+    if (asbd.mBitsPerChannel % 8 != 0 || asbd.mBytesPerFrame != sample_byte_count * channel_count) {
+        return std::nullopt;
+    }
+
+    std::optional<dsp::sample_type> sample_type = std::nullopt;
+
+    if (asbd.mFormatFlags & kAudioFormatFlagIsFloat) {
+        sample_type = to_float_sample_type(sample_byte_count);
+    } else if (asbd.mFormatFlags & kAudioFormatFlagIsSignedInteger) {
+        sample_type = to_integer_sample_type(sample_byte_count);
+    }
+
+    if (!sample_type) {
+        return std::nullopt;
+    }
+
+    return native_file_encoding{.sample_type = *sample_type,
+                                .is_big_endian = (asbd.mFormatFlags & kAudioFormatFlagIsBigEndian) != 0};
+}
+
+AudioStreamBasicDescription native_file_utils::to_stream_description(native_file_header const &header) {
+    auto const &encoding = header.encoding;
+    uint32_t const frame_byte_count = header.frame_byte_count();
+
+    AudioStreamBasicDescription asbd = {
+        .mSampleRate = header.sample_rate,
+        .mFormatID = kAudioFormatLinearPCM,
+    };
+
+    asbd.mFormatFlags = kAudioFormatFlagIsPacked;
+    asbd.mFormatFlags |= is_float(encoding.sample_type) ? kAudioFormatFlagIsFloat : kAudioFormatFlagIsSignedInteger;
+    if (encoding.is_big_endian) {
+        asbd.mFormatFlags |= kAudioFormatFlagIsBigEndian;
+    }
+
+    asbd.mBytesPerPacket = frame_byte_count;
+    asbd.mFramesPerPacket = 1;
+    asbd.mBytesPerFrame = frame_byte_count;
+    asbd.mChannelsPerFrame = header.channel_count;
+    asbd.mBitsPerChannel = dsp::sample_byte_count(encoding.sample_type) * 8;
+
+    return asbd;
+}
+
+bool native_file_utils::is_supported(audio::file_type const file_type, native_file_encoding const &encoding) {
+    if (encoding.sample_type == dsp::sample_type::fixed824) {
+        return false;
+    }
+
+    switch (file_type) {
+        case file_type::wave:
+        case file_type::rf64:
+        case file_type::bw64:
+        case file_type::wave64:
+            return !encoding.is_big_endian;
+        case file_type::aiff:
+            return encoding.is_big_endian && !is_float(encoding.sample_type);
+        case file_type::aifc:
+            return encoding.is_big_endian || !is_float(encoding.sample_type);
+        case file_type::core_audio_format:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::optional<native_file_header> native_file_utils::read_header(std::FILE *const file) {
+    int64_t const byte_count = file_byte_count(file);
+    // the head of wave64 is the longest.
+    uint8_t head[40];
+    size_t const head_byte_count = static_cast<size_t>(std::min<int64_t>(byte_count, 40));
+
+    if (byte_count < 12 || !seek(file, 0) || !read_bytes(file, head, head_byte_count)) {
+        return std::nullopt;
+    }
+
+    if (is_id(&head[8], "WAVE") && (is_id(&head[0], "RIFF") || is_id(&head[0], "RF64") || is_id(&head[0], "BW64"))) {
+        auto const file_type = is_id(&head[0], "RIFF") ? file_type::wave
+                               : is_id(&head[0], "RF64") ? file_type::rf64
+                                                         : file_type::bw64;
+        return read_wave_header(file, byte_count, file_type);
+    } else if (head_byte_count == 40 && std::memcmp(head, wave64_riff_guid, 16) == 0 &&
+               is_wave64_guid(&head[24], "wave")) {
+        return read_wave64_header(file, byte_count);
+    } else if (is_id(&head[0], "FORM") && (is_id(&head[8], "AIFF") || is_id(&head[8], "AIFC"))) {
+        return read_aiff_header(file, byte_count, is_id(&head[8], "AIFC"));
+    } else if (is_id(&head[0], "caff") && load_be(&head[4], 2) == 1) {
+        return read_caf_header(file, byte_count);
+    }
+
+    return std::nullopt;
+}
+
+std::vector<uint8_t> native_file_utils::make_header_bytes(native_file_header const &header) {
+    switch (header.file_type) {
+        case file_type::wave:
+        case file_type::rf64:
+        case file_type::bw64:
+            return make_wave_header_bytes(header);
+        case file_type::wave64:
+            return make_wave64_header_bytes(header);
+        case file_type::aiff:
+        case file_type::aifc:
+            return make_aiff_header_bytes(header);
+        case file_type::core_audio_format:
+            return make_caf_header_bytes(header);
+        default:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : unsupported file type.");
+    }
+}
+
+void native_file_utils::convert_samples(void const *const src, dsp::sample_type const src_type,
+                                        uint32_t const src_stride, void *const dst, dsp::sample_type const dst_type,
+                                        uint32_t const dst_stride, uint32_t const length) {
+    if (src_type == dst_type) {
+        native_file_utils::copy_samples(src, src_stride, dst, dst_stride, dsp::sample_byte_count(src_type), length);
+    } else {
+        dsp::convert(src, src_type, src_stride, dst, dst_type, dst_stride, length);
+    }
+}
+
+void native_file_utils::swap_bytes(void *const data, uint32_t const sample_byte_count, uint32_t const sample_count) {
+    auto *const bytes = static_cast<uint8_t *>(data);
+
+    switch (sample_byte_count) {
+        case 2:
+            for (uint32_t idx = 0; idx < sample_count; ++idx) {
+                uint16_t value;
+                std::memcpy(&value, &bytes[idx * 2], 2);
+                value = __builtin_bswap16(value);
+                std::memcpy(&bytes[idx * 2], &value, 2);
+            }
+            break;
+        case 4:
+            for (uint32_t idx = 0; idx < sample_count; ++idx) {
+                uint32_t value;
+                std::memcpy(&value, &bytes[idx * 4], 4);
+                value = __builtin_bswap32(value);
+                std::memcpy(&bytes[idx * 4], &value, 4);
+            }
+            break;
+        case 8:
+            for (uint32_t idx = 0; idx < sample_count; ++idx) {
+                uint64_t value;
+                std::memcpy(&value, &bytes[idx * 8], 8);
+                value = __builtin_bswap64(value);
+                std::memcpy(&bytes[idx * 8], &value, 8);
+            }
+            break;
+        default:
+            for (uint32_t idx = 0; idx < sample_count; ++idx) {
+                std::reverse(&bytes[idx * sample_byte_count], &bytes[(idx + 1) * sample_byte_count]);
+            }
+            break;
+    }
+}
+
+double native_file_utils::to_float64_from_extended(uint8_t const *const bytes) {
+    int32_t const exponent = static_cast<int32_t>(load_be(&bytes[0], 2) & 0x7FFF);
+    uint64_t const mantissa = load_be(&bytes[2], 8);
+
+    if (exponent == 0 && mantissa == 0) {
+        return 0.0;
+    }
+
+    double const value = std::ldexp(static_cast<double>(mantissa), exponent - 16383 - 63);
+    return (bytes[0] & 0x80) ? -value : value;
+}
+
+void native_file_utils::to_extended_from_float64(double const value, uint8_t *const bytes) {
+    std::fill_n(bytes, 10, 0);
+
+    if (value == 0.0 || !std::isfinite(value)) {
+        return;
+    }
+
+    int exponent = 0;
+    double const fraction = std::frexp(std::fabs(value), &exponent);
+    uint32_t const biased_exponent = static_cast<uint32_t>(exponent - 1 + 16383);
+    uint64_t const mantissa = static_cast<uint64_t>(std::ldexp(fraction, 64));
+
+    bytes[0] = static_cast<uint8_t>((biased_exponent >> 8) & 0x7F) | (value < 0.0 ? 0x80 : 0x00);
+    bytes[1] = static_cast<uint8_t>(biased_exponent);
+    for (uint32_t idx = 0; idx < 8; ++idx) {
+        bytes[2 + idx] = static_cast<uint8_t>(mantissa >> ((7 - idx) * 8));
+    }
+}
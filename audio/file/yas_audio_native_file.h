@@ -0,0 +1,113 @@
+//
+//  yas_audio_native_file.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_dsp_convert.h>
+#include <audio/yas_audio_file_utils.h>
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_ptr.h>
+#include <cpp_utils/yas_url.h>
+
+#include <cstdio>
+#include <optional>
+#include <vector>
+
+namespace yas::audio {
+// the encoding of the interleaved samples in a linear pcm file.
+struct native_file_encoding {
+    dsp::sample_type sample_type;
+    bool is_big_endian;
+
+    bool operator==(native_file_encoding const &) const;
+    bool operator!=(native_file_encoding const &) const;
+};
+
+// the layout of the linear pcm data in a file.
+struct native_file_header {
+    audio::file_type file_type;
+    double sample_rate;
+    uint32_t channel_count;
+    native_file_encoding encoding;
+    int64_t data_offset = 0;  // bytes from the head of the file
+    int64_t frame_length = 0;
+
+    [[nodiscard]] uint32_t frame_byte_count() const;
+};
+
+// reads and writes the linear pcm data of wave (with WAVE_FORMAT_EXTENSIBLE), rf64, bw64, wave64, aiff, aifc and caf
+// files without ExtAudioFile. the samples are converted between the file and a processing format of the same sample
+// rate. a wave file is promoted to rf64 when the sizes overflow 32 bits.
+struct native_file final {
+    ~native_file();
+
+    [[nodiscard]] native_file_header const &header() const;
+    [[nodiscard]] audio::format const &file_format() const;
+    [[nodiscard]] bool is_writable() const;
+    [[nodiscard]] int64_t file_length() const;
+    [[nodiscard]] int64_t file_frame_position() const;
+    // the mapping the samples are read from. nullptr if they are read through the std::FILE.
+    [[nodiscard]] mapped_file_ptr const &mapping() const;
+
+    // true if the buffers in the format are readable or writable without resampling.
+    [[nodiscard]] bool can_process(audio::format const &) const;
+
+    [[nodiscard]] bool set_file_frame_position(int64_t const position);
+
+    // reads from the current position into the head of the buffer and sets the frame length of the buffer to the read.
+    [[nodiscard]] bool read_into_buffer(audio::pcm_buffer &buffer, uint32_t const frame_length);
+    [[nodiscard]] bool write_from_buffer(audio::pcm_buffer const &buffer);
+
+    // writes the sizes to the header and the buffered to the file. syncs the data to the storage if sync.
+    [[nodiscard]] bool flush(bool const sync);
+    // writes the sizes to the header if writable.
+    void close();
+
+    // nullptr if the file is not a supported linear pcm file. mapped reads through a mapped_file if possible.
+    [[nodiscard]] static native_file_ptr make_opened(yas::url const &, bool const mapped = false);
+    [[nodiscard]] static native_file_ptr make_created(yas::url const &, audio::file_type const,
+                                                      audio::format const &file_format);
+
+   private:
+    std::FILE *_file;
+    std::vector<char> _io_buffer;
+    std::vector<uint8_t> _scratch;
+    native_file_header _header;
+    audio::format const _file_format;
+    bool const _is_writable;
+    mapped_file_ptr const _mapping;
+    int64_t _frame_position = 0;
+
+    native_file(std::FILE *const, std::vector<char> &&io_buffer, native_file_header const &, bool const is_writable,
+                mapped_file_ptr const &);
+
+    bool _write_header();
+
+    native_file(native_file const &) = delete;
+    native_file(native_file &&) = delete;
+    native_file &operator=(native_file const &) = delete;
+    native_file &operator=(native_file &&) = delete;
+};
+}  // namespace yas::audio
+
+namespace yas::audio::native_file_utils {
+[[nodiscard]] std::optional<native_file_encoding> to_encoding(AudioStreamBasicDescription const &);
+[[nodiscard]] AudioStreamBasicDescription to_stream_description(native_file_header const &);
+[[nodiscard]] bool is_supported(audio::file_type const, native_file_encoding const &);
+
+// reads the header from the head of the file. nullopt if the file is not a supported linear pcm file.
+[[nodiscard]] std::optional<native_file_header> read_header(std::FILE *const);
+// the bytes before the data. the sizes are derived from the frame length of the header.
+[[nodiscard]] std::vector<uint8_t> make_header_bytes(native_file_header const &);
+
+// converts the samples between the strides. the samples of the same type are copied as they are.
+void convert_samples(void const *const src, dsp::sample_type const src_type, uint32_t const src_stride,
+                     void *const dst, dsp::sample_type const dst_type, uint32_t const dst_stride,
+                     uint32_t const length);
+
+void swap_bytes(void *const data, uint32_t const sample_byte_count, uint32_t const sample_count);
+
+[[nodiscard]] double to_float64_from_extended(uint8_t const *const bytes);
+void to_extended_from_float64(double const value, uint8_t *const bytes);
+}  // namespace yas::audio::native_file_utils
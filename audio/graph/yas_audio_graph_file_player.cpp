@@ -0,0 +1,26 @@
+//
+//  yas_audio_graph_file_player.cpp
+//
+
+#include "yas_audio_graph_file_player.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+graph_file_player::graph_file_player(file_stream_ptr const &stream)
+    : node(graph_node::make_shared(graph_node_args{.output_bus_count = 1})), _stream(stream) {
+    auto const manageable_node = manageable_graph_node::cast(this->node);
+
+    manageable_node->set_prepare_rendering_handler([this] {
+        this->node->set_render_handler(
+            [stream = this->_stream](node_render_args const &args) { stream->render(*args.buffer); });
+    });
+}
+
+file_stream_ptr const &graph_file_player::stream() const {
+    return this->_stream;
+}
+
+graph_file_player_ptr graph_file_player::make_shared(file_stream_ptr const &stream) {
+    return graph_file_player_ptr(new graph_file_player{stream});
+}
@@ -0,0 +1,29 @@
+//
+//  yas_audio_graph_file_player.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_file_stream.h>
+#include <audio/yas_audio_graph_node.h>
+
+namespace yas::audio {
+// renders a file_stream as a source of the graph. the format of the connection must be the format of the stream.
+struct graph_file_player final {
+    [[nodiscard]] file_stream_ptr const &stream() const;
+
+    graph_node_ptr const node;
+
+    [[nodiscard]] static graph_file_player_ptr make_shared(file_stream_ptr const &);
+
+   private:
+    file_stream_ptr const _stream;
+
+    explicit graph_file_player(file_stream_ptr const &);
+
+    graph_file_player(graph_file_player const &) = delete;
+    graph_file_player(graph_file_player &&) = delete;
+    graph_file_player &operator=(graph_file_player const &) = delete;
+    graph_file_player &operator=(graph_file_player &&) = delete;
+};
+}  // namespace yas::audio
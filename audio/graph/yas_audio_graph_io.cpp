@@ -10,6 +10,7 @@
 #include "yas_audio_graph_tap.h"
 #include "yas_audio_io.h"
 #include "yas_audio_rendering_connection.h"
+#include "yas_audio_rendering_converter.h"
 #include "yas_audio_rendering_graph.h"
 #include "yas_audio_time.h"
 
@@ -21,9 +22,37 @@ using namespace yas::audio;
 namespace yas::audio {
 struct graph_input_context {
     pcm_buffer *input_buffer = nullptr;
+    rendering_converter *input_converter = nullptr;
 };
 }  // namespace yas::audio
 
+namespace yas::audio::graph_io_utils {
+static bool is_acceptable_output_format(audio::format const &connection_format,
+                                        std::optional<audio::format> const &device_format) {
+    if (!device_format) {
+        return false;
+    }
+    if (connection_format == *device_format) {
+        return true;
+    }
+    return rendering_converter::is_convertible(connection_format, *device_format);
+}
+
+static bool is_acceptable_input_format(std::optional<audio::format> const &device_format,
+                                       audio::format const &connection_format, bool const is_input_renderable) {
+    if (!device_format) {
+        return false;
+    }
+    if (connection_format == *device_format) {
+        return true;
+    }
+    if (device_format->sample_rate() != connection_format.sample_rate() && !is_input_renderable) {
+        return false;
+    }
+    return rendering_converter::is_convertible(*device_format, connection_format);
+}
+}  // namespace yas::audio::graph_io_utils
+
 #pragma mark - graph_io
 
 graph_io::graph_io(io_ptr const &raw_io)
@@ -37,6 +66,8 @@ graph_io::graph_io(io_ptr const &raw_io)
         if (input_buffer) {
             if (input_buffer->format() == buffer->format()) {
                 buffer->copy_from(*input_buffer);
+            } else if (auto *const converter = input_context->input_converter) {
+                converter->push(*input_buffer, buffer);
             }
         }
     });
@@ -63,9 +94,9 @@ bool graph_io::_validate_connections() {
                 return false;
             }
             auto const &device = *device_opt;
-            if (connection_format != device->output_format()) {
+            if (!graph_io_utils::is_acceptable_output_format(connection_format, device->output_format())) {
                 std::ostringstream stream;
-                stream << "graph_io validate_connections failed - output device io format is not match.\n";
+                stream << "graph_io validate_connections failed - output device io format is not convertible.\n";
                 if (device->output_format().has_value()) {
                     stream << "device output format : " << to_string(*device->output_format()) << "\n";
                 } else {
@@ -91,9 +122,10 @@ bool graph_io::_validate_connections() {
                 return false;
             }
             auto const &device = *device_opt;
-            if (connection_format != device->input_format()) {
+            if (!graph_io_utils::is_acceptable_input_format(device->input_format(), connection_format,
+                                                            connection->destination_node()->is_input_renderable())) {
                 std::ostringstream stream;
-                stream << "graph_io validate_connections failed - input device io format is not match.\n";
+                stream << "graph_io validate_connections failed - input device io format is not convertible.\n";
                 if (device->input_format().has_value()) {
                     stream << "device input format : " << to_string(*device->input_format()) << "\n";
                 } else {
@@ -120,10 +152,17 @@ void graph_io::update_rendering() {
         return;
     }
 
-    auto graph = std::make_shared<rendering_graph>(this->output_node, this->input_node);
+    auto const &device = raw_io->device();
+    rendering_graph_args const args{.output_format = device ? device.value()->output_format() : std::nullopt,
+                                    .input_format = device ? device.value()->input_format() : std::nullopt,
+                                    .frame_capacity = raw_io->maximum_frames_per_slice()};
+
+    auto graph = std::make_shared<rendering_graph>(this->output_node, this->input_node, args);
+    auto input_converter = this->_make_input_converter(args);
 
-    auto render_handler = [input_context = this->_input_context, graph](io_render_args args) {
+    auto render_handler = [input_context = this->_input_context, graph, input_converter](io_render_args args) {
         input_context->input_buffer = args.input_buffer;
+        input_context->input_converter = input_converter.get();
 
         if (pcm_buffer *const buffer = args.output_buffer) {
             if (rendering_output_node const *node = graph->output_node()) {
@@ -142,11 +181,34 @@ void graph_io::update_rendering() {
         }
 
         input_context->input_buffer = nullptr;
+        input_context->input_converter = nullptr;
     };
 
     raw_io->set_render_handler(std::move(render_handler));
 }
 
+std::shared_ptr<rendering_converter> graph_io::_make_input_converter(rendering_graph_args const &args) {
+    auto const &output_connections = manageable_graph_node::cast(this->input_node)->output_connections();
+    if (!args.input_format || output_connections.count(0) == 0) {
+        return nullptr;
+    }
+
+    auto const connection = output_connections.at(0).lock();
+    if (!connection || connection->destination_node()->is_input_renderable()) {
+        return nullptr;
+    }
+
+    auto const &connection_format = connection->format();
+    auto const &device_format = *args.input_format;
+
+    if (connection_format == device_format || connection_format.sample_rate() != device_format.sample_rate() ||
+        !rendering_converter::is_convertible(device_format, connection_format)) {
+        return nullptr;
+    }
+
+    return std::make_shared<rendering_converter>(device_format, connection_format, args.frame_capacity);
+}
+
 void graph_io::clear_rendering() {
     auto const &raw_io = this->_raw_io;
     raw_io->set_render_handler(std::nullopt);
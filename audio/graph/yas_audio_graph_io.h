@@ -11,6 +11,8 @@
 
 namespace yas::audio {
 class graph_input_context;
+class rendering_converter;
+class rendering_graph_args;
 
 struct graph_io : manageable_graph_io {
     virtual ~graph_io();
@@ -35,6 +37,7 @@ struct graph_io : manageable_graph_io {
 
     void _prepare(graph_io_ptr const &);
     bool _validate_connections();
+    std::shared_ptr<rendering_converter> _make_input_converter(rendering_graph_args const &);
 
     void update_rendering() override;
     void clear_rendering() override;
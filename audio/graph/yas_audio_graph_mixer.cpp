@@ -0,0 +1,269 @@
+//
+//  yas_audio_graph_mixer.cpp
+//
+
+#include "yas_audio_graph_mixer.h"
+
+#include <cpp_utils/yas_fast_each.h>
+
+#include <algorithm>
+
+#include "yas_audio_dsp_mix.h"
+#include "yas_audio_graph.h"
+#include "yas_audio_graph_io.h"
+#include "yas_audio_io.h"
+#include "yas_audio_pcm_span.h"
+#include "yas_audio_rendering_connection.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::graph_mixer_utils {
+static uint32_t constexpr default_frame_capacity = 4096;
+
+static bool is_mixable_format(audio::format const &format) {
+    return non_interleaved_pcm_span<float>::is_compatible(format);
+}
+
+struct gains {
+    float left = 0.0f;
+    float right = 0.0f;
+
+    float at(uint32_t const ch_idx) const {
+        return ch_idx == 0 ? this->left : this->right;
+    }
+};
+
+static gains make_gains(float const volume, float const pan, uint32_t const output_ch_count) {
+    if (output_ch_count == 2) {
+        float const clamped_pan = std::clamp(pan, -1.0f, 1.0f);
+        return {.left = volume * std::min(1.0f, 1.0f - clamped_pan),
+                .right = volume * std::min(1.0f, 1.0f + clamped_pan)};
+    } else {
+        return {.left = volume, .right = volume};
+    }
+}
+}  // namespace yas::audio::graph_mixer_utils
+
+struct graph_mixer::render_context {
+    struct input {
+        uint32_t const bus_idx;
+        bus_parameters_ptr const parameters;
+        pcm_buffer *const buffer;
+        graph_mixer_utils::gains gains;
+    };
+
+    render_context(bus_parameters_ptr const &output_parameters, uint32_t const frame_capacity)
+        : _output_parameters(output_parameters), _frame_capacity(frame_capacity) {
+    }
+
+    void add_input(uint32_t const bus_idx, bus_parameters_ptr const &parameters, audio::format const &format) {
+        if (!graph_mixer_utils::is_mixable_format(format)) {
+            return;
+        }
+
+        auto buffer_it = std::find_if(this->_buffers.begin(), this->_buffers.end(),
+                                      [&format](auto const &buffer) { return buffer->format() == format; });
+
+        if (buffer_it == this->_buffers.end()) {
+            this->_buffers.emplace_back(std::make_unique<pcm_buffer>(format, this->_frame_capacity));
+            buffer_it = std::prev(this->_buffers.end());
+        }
+
+        this->_inputs.emplace_back(input{.bus_idx = bus_idx, .parameters = parameters, .buffer = buffer_it->get()});
+    }
+
+    void render(node_render_args const &args) {
+        pcm_buffer *const out_buffer = args.buffer;
+        out_buffer->clear();
+
+        auto const &out_format = out_buffer->format();
+        if (!graph_mixer_utils::is_mixable_format(out_format)) {
+            return;
+        }
+
+        uint32_t const frame_length = out_buffer->frame_length();
+        if (frame_length == 0 || frame_length > this->_frame_capacity) {
+            return;
+        }
+
+        non_interleaved_pcm_span<float> const out_span{*out_buffer};
+        uint32_t const out_ch_count = out_span.channel_count();
+        bool const is_initial = this->_is_initial;
+        this->_is_initial = false;
+
+        auto connection_it = args.source_connections.begin();
+        auto const connection_end = args.source_connections.end();
+
+        for (auto &input : this->_inputs) {
+            bus_parameters const &parameters = *input.parameters;
+
+            if (!parameters.enabled.load()) {
+                input.gains = {};
+                continue;
+            }
+
+            while (connection_it != connection_end && connection_it->first < input.bus_idx) {
+                ++connection_it;
+            }
+
+            if (connection_it == connection_end) {
+                break;
+            }
+
+            if (connection_it->first != input.bus_idx) {
+                continue;
+            }
+
+            rendering_connection const &connection = connection_it->second;
+            pcm_buffer *const in_buffer = input.buffer;
+
+            if (connection.format.sample_rate() != out_format.sample_rate()) {
+                continue;
+            }
+
+            in_buffer->set_frame_length(frame_length);
+            in_buffer->clear();
+
+            if (!connection.render(in_buffer, args.time)) {
+                continue;
+            }
+
+            auto const target =
+                graph_mixer_utils::make_gains(parameters.volume.load(), parameters.pan.load(), out_ch_count);
+            auto const start = is_initial ? target : input.gains;
+            input.gains = target;
+
+            non_interleaved_pcm_span<float const> const in_span{*in_buffer};
+            uint32_t const in_ch_count = in_span.channel_count();
+
+            auto each = make_fast_each(out_ch_count);
+            while (yas_each_next(each)) {
+                uint32_t const out_ch_idx = yas_each_index(each);
+                uint32_t const in_ch_idx = (in_ch_count == 1) ? 0 : out_ch_idx;
+                if (in_ch_idx >= in_ch_count) {
+                    break;
+                }
+
+                dsp::mix_ramp(in_span.data_at_channel(in_ch_idx), out_span.data_at_channel(out_ch_idx), frame_length,
+                              start.at(out_ch_idx), target.at(out_ch_idx));
+            }
+        }
+
+        bus_parameters const &out_parameters = *this->_output_parameters;
+        auto const out_target =
+            graph_mixer_utils::make_gains(out_parameters.volume.load(), out_parameters.pan.load(), out_ch_count);
+        auto const out_start = is_initial ? out_target : this->_output_gains;
+        this->_output_gains = out_target;
+
+        auto each = make_fast_each(out_ch_count);
+        while (yas_each_next(each)) {
+            uint32_t const out_ch_idx = yas_each_index(each);
+            dsp::scale_ramp(out_span.data_at_channel(out_ch_idx), frame_length, out_start.at(out_ch_idx),
+                            out_target.at(out_ch_idx));
+        }
+    }
+
+   private:
+    bus_parameters_ptr const _output_parameters;
+    uint32_t const _frame_capacity;
+    std::vector<input> _inputs;
+    std::vector<std::unique_ptr<pcm_buffer>> _buffers;
+    graph_mixer_utils::gains _output_gains;
+    bool _is_initial = true;
+};
+
+graph_mixer::graph_mixer()
+    : node(graph_node::make_shared({.input_bus_count = std::numeric_limits<uint32_t>::max(), .output_bus_count = 1})) {
+    manageable_graph_node::cast(this->node)->set_prepare_rendering_handler([this] { this->_prepare_rendering(); });
+}
+
+void graph_mixer::set_output_volume(float const volume, uint32_t const bus_idx) {
+    this->_output_parameters_at(bus_idx)->volume.store(volume);
+}
+
+float graph_mixer::output_volume(uint32_t const bus_idx) const {
+    return this->_output_parameters_at(bus_idx)->volume.load();
+}
+
+void graph_mixer::set_output_pan(float const pan, uint32_t const bus_idx) {
+    this->_output_parameters_at(bus_idx)->pan.store(pan);
+}
+
+float graph_mixer::output_pan(uint32_t const bus_idx) const {
+    return this->_output_parameters_at(bus_idx)->pan.load();
+}
+
+void graph_mixer::set_input_volume(float const volume, uint32_t const bus_idx) {
+    this->_input_parameters_at(bus_idx)->volume.store(volume);
+}
+
+float graph_mixer::input_volume(uint32_t const bus_idx) const {
+    if (this->_input_parameters.count(bus_idx) > 0) {
+        return this->_input_parameters.at(bus_idx)->volume.load();
+    }
+    return 1.0f;
+}
+
+void graph_mixer::set_input_pan(float const pan, uint32_t const bus_idx) {
+    this->_input_parameters_at(bus_idx)->pan.store(pan);
+}
+
+float graph_mixer::input_pan(uint32_t const bus_idx) const {
+    if (this->_input_parameters.count(bus_idx) > 0) {
+        return this->_input_parameters.at(bus_idx)->pan.load();
+    }
+    return 0.0f;
+}
+
+void graph_mixer::set_input_enabled(bool const enabled, uint32_t const bus_idx) {
+    this->_input_parameters_at(bus_idx)->enabled.store(enabled);
+}
+
+bool graph_mixer::input_enabled(uint32_t const bus_idx) const {
+    if (this->_input_parameters.count(bus_idx) > 0) {
+        return this->_input_parameters.at(bus_idx)->enabled.load();
+    }
+    return true;
+}
+
+graph_mixer::bus_parameters_ptr const &graph_mixer::_input_parameters_at(uint32_t const bus_idx) {
+    auto it = this->_input_parameters.find(bus_idx);
+    if (it == this->_input_parameters.end()) {
+        it = this->_input_parameters.emplace(bus_idx, std::make_shared<bus_parameters>()).first;
+    }
+    return it->second;
+}
+
+graph_mixer::bus_parameters_ptr const &graph_mixer::_output_parameters_at(uint32_t const bus_idx) const {
+    if (bus_idx >= this->node->output_bus_count()) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. bus_idx(" +
+                                std::to_string(bus_idx) + ")");
+    }
+    return this->_output_parameters;
+}
+
+void graph_mixer::_prepare_rendering() {
+    uint32_t frame_capacity = graph_mixer_utils::default_frame_capacity;
+
+    if (auto const graph = this->node->graph()) {
+        if (auto const &io = graph->io()) {
+            frame_capacity = manageable_graph_io::cast(io.value())->raw_io()->maximum_frames_per_slice();
+        }
+    }
+
+    auto context = std::make_shared<render_context>(this->_output_parameters, frame_capacity);
+
+    for (auto const &pair : manageable_graph_node::cast(this->node)->input_connections()) {
+        if (auto const connection = pair.second.lock()) {
+            context->add_input(pair.first, this->_input_parameters_at(pair.first), connection->format());
+        }
+    }
+
+    this->node->set_render_handler(
+        [context = std::move(context)](node_render_args const &args) { context->render(args); });
+}
+
+graph_mixer_ptr graph_mixer::make_shared() {
+    return graph_mixer_ptr(new graph_mixer{});
+}
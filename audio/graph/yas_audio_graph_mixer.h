@@ -0,0 +1,56 @@
+//
+//  yas_audio_graph_mixer.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_graph_node.h>
+
+#include <atomic>
+#include <map>
+
+namespace yas::audio {
+struct graph_mixer final {
+    void set_output_volume(float const volume, uint32_t const bus_idx);
+    [[nodiscard]] float output_volume(uint32_t const bus_idx) const;
+    void set_output_pan(float const pan, uint32_t const bus_idx);
+    [[nodiscard]] float output_pan(uint32_t const bus_idx) const;
+
+    void set_input_volume(float const volume, uint32_t const bus_idx);
+    [[nodiscard]] float input_volume(uint32_t const bus_idx) const;
+    void set_input_pan(float const pan, uint32_t const bus_idx);
+    [[nodiscard]] float input_pan(uint32_t const bus_idx) const;
+
+    void set_input_enabled(bool const enabled, uint32_t const bus_idx);
+    [[nodiscard]] bool input_enabled(uint32_t const bus_idx) const;
+
+    graph_node_ptr const node;
+
+    [[nodiscard]] static graph_mixer_ptr make_shared();
+
+   private:
+    struct bus_parameters {
+        std::atomic<float> volume{1.0f};
+        std::atomic<float> pan{0.0f};
+        std::atomic<bool> enabled{true};
+    };
+
+    using bus_parameters_ptr = std::shared_ptr<bus_parameters>;
+
+    class render_context;
+
+    std::map<uint32_t, bus_parameters_ptr> _input_parameters;
+    bus_parameters_ptr const _output_parameters = std::make_shared<bus_parameters>();
+
+    graph_mixer();
+
+    bus_parameters_ptr const &_input_parameters_at(uint32_t const bus_idx);
+    bus_parameters_ptr const &_output_parameters_at(uint32_t const bus_idx) const;
+    void _prepare_rendering();
+
+    graph_mixer(graph_mixer const &) = delete;
+    graph_mixer(graph_mixer &&) = delete;
+    graph_mixer &operator=(graph_mixer const &) = delete;
+    graph_mixer &operator=(graph_mixer &&) = delete;
+};
+}  // namespace yas::audio
@@ -0,0 +1,151 @@
+//
+//  yas_audio_graph_resampler.cpp
+//
+
+#include "yas_audio_graph_resampler.h"
+
+#include <cpp_utils/yas_fast_each.h>
+
+#include <cmath>
+#include <optional>
+
+#include "yas_audio_graph.h"
+#include "yas_audio_graph_io.h"
+#include "yas_audio_io.h"
+#include "yas_audio_rendering_connection.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::graph_resampler_utils {
+static uint32_t constexpr default_frame_capacity = 4096;
+
+static bool is_resamplable_format(audio::format const &format) {
+    return format.pcm_format() == pcm_format::float32 && !format.is_interleaved();
+}
+
+static uint32_t input_frame_capacity(audio::format const &input_format, audio::format const &output_format,
+                                     uint32_t const output_frame_capacity) {
+    double const ratio = input_format.sample_rate() / output_format.sample_rate();
+    return static_cast<uint32_t>(std::ceil(static_cast<double>(output_frame_capacity) * ratio)) + 1;
+}
+}  // namespace yas::audio::graph_resampler_utils
+
+struct graph_resampler::render_context {
+    render_context(audio::format const &input_format, audio::format const &output_format,
+                   uint32_t const output_frame_capacity, dsp::resampler_quality const quality)
+        : _output_format(output_format),
+          _input_frame_capacity(
+              graph_resampler_utils::input_frame_capacity(input_format, output_format, output_frame_capacity)),
+          _resampler(input_format.sample_rate(), output_format.sample_rate(), input_format.channel_count(),
+                     this->_input_frame_capacity, quality),
+          _input_buffer(input_format, this->_input_frame_capacity + this->_resampler.tap_count()),
+          _input_data(input_format.channel_count()),
+          _output_data(input_format.channel_count()) {
+        auto each = make_fast_each(input_format.channel_count());
+        while (yas_each_next(each)) {
+            auto const &ch_idx = yas_each_index(each);
+            this->_input_data[ch_idx] =
+                static_cast<float const *>(this->_input_buffer.audio_buffer_list()->mBuffers[ch_idx].mData);
+        }
+    }
+
+    void render(node_render_args const &args) {
+        pcm_buffer *const out_buffer = args.buffer;
+
+        if (out_buffer->format() != this->_output_format) {
+            out_buffer->clear();
+            return;
+        }
+
+        uint32_t const frame_length = out_buffer->frame_length();
+        uint32_t const required_length = this->_resampler.required_input_frames(frame_length);
+
+        if (required_length > this->_input_buffer.frame_capacity()) {
+            out_buffer->clear();
+            return;
+        }
+
+        if (!this->_input_sample_time.has_value()) {
+            this->_input_sample_time = std::llround(static_cast<double>(args.time.sample_time()) *
+                                                    this->_input_buffer.format().sample_rate() /
+                                                    this->_output_format.sample_rate());
+        }
+
+        if (required_length > 0) {
+            this->_input_buffer.set_frame_length(required_length);
+            this->_input_buffer.clear();
+
+            if (auto const it = args.source_connections.find(0); it != args.source_connections.end()) {
+                it->second.render(&this->_input_buffer,
+                                  audio::time{*this->_input_sample_time, this->_input_buffer.format().sample_rate()});
+            }
+
+            *this->_input_sample_time += required_length;
+
+            this->_resampler.push(this->_input_data.data(), required_length);
+        }
+
+        auto each = make_fast_each(this->_resampler.channel_count());
+        while (yas_each_next(each)) {
+            auto const &ch_idx = yas_each_index(each);
+            this->_output_data[ch_idx] = static_cast<float *>(out_buffer->audio_buffer_list()->mBuffers[ch_idx].mData);
+        }
+
+        this->_resampler.pull(this->_output_data.data(), frame_length);
+    }
+
+   private:
+    audio::format const _output_format;
+    uint32_t const _input_frame_capacity;
+    dsp::resampler _resampler;
+    pcm_buffer _input_buffer;
+    std::vector<float const *> _input_data;
+    std::vector<float *> _output_data;
+    std::optional<int64_t> _input_sample_time = std::nullopt;
+};
+
+graph_resampler::graph_resampler(dsp::resampler_quality const quality)
+    : node(graph_node::make_shared({.input_bus_count = 1, .output_bus_count = 1})), _quality(quality) {
+    manageable_graph_node::cast(this->node)->set_prepare_rendering_handler([this] { this->_prepare_rendering(); });
+}
+
+void graph_resampler::set_quality(dsp::resampler_quality const quality) {
+    this->_quality = quality;
+
+    renderable_graph_node::cast(this->node)->update_rendering();
+}
+
+dsp::resampler_quality graph_resampler::quality() const {
+    return this->_quality;
+}
+
+void graph_resampler::_prepare_rendering() {
+    auto const input_format = this->node->input_format(0);
+    auto const output_format = this->node->output_format(0);
+
+    if (!input_format || !output_format || !graph_resampler_utils::is_resamplable_format(*input_format) ||
+        !graph_resampler_utils::is_resamplable_format(*output_format) ||
+        input_format->channel_count() != output_format->channel_count() ||
+        !dsp::resampler::is_supported(input_format->sample_rate(), output_format->sample_rate())) {
+        this->node->set_render_handler([](node_render_args const &args) { args.buffer->clear(); });
+        return;
+    }
+
+    uint32_t frame_capacity = graph_resampler_utils::default_frame_capacity;
+
+    if (auto const graph = this->node->graph()) {
+        if (auto const &io = graph->io()) {
+            frame_capacity = manageable_graph_io::cast(io.value())->raw_io()->maximum_frames_per_slice();
+        }
+    }
+
+    auto context = std::make_shared<render_context>(*input_format, *output_format, frame_capacity, this->_quality);
+
+    this->node->set_render_handler(
+        [context = std::move(context)](node_render_args const &args) { context->render(args); });
+}
+
+graph_resampler_ptr graph_resampler::make_shared(dsp::resampler_quality const quality) {
+    return graph_resampler_ptr(new graph_resampler{quality});
+}
@@ -0,0 +1,34 @@
+//
+//  yas_audio_graph_resampler.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_dsp_resampler.h>
+#include <audio/yas_audio_graph_node.h>
+
+namespace yas::audio {
+struct graph_resampler final {
+    void set_quality(dsp::resampler_quality const);
+    [[nodiscard]] dsp::resampler_quality quality() const;
+
+    graph_node_ptr const node;
+
+    [[nodiscard]] static graph_resampler_ptr make_shared(
+        dsp::resampler_quality const = dsp::resampler_quality::medium);
+
+   private:
+    class render_context;
+
+    dsp::resampler_quality _quality;
+
+    explicit graph_resampler(dsp::resampler_quality const);
+
+    void _prepare_rendering();
+
+    graph_resampler(graph_resampler const &) = delete;
+    graph_resampler(graph_resampler &&) = delete;
+    graph_resampler &operator=(graph_resampler const &) = delete;
+    graph_resampler &operator=(graph_resampler &&) = delete;
+};
+}  // namespace yas::audio
@@ -0,0 +1,33 @@
+//
+//  yas_audio_graph_shared_memory_sink.cpp
+//
+
+#include "yas_audio_graph_shared_memory_sink.h"
+
+#include "yas_audio_rendering_connection.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+graph_shared_memory_sink::graph_shared_memory_sink(shared_memory_ring_ptr const &ring)
+    : node(graph_node::make_shared(graph_node_args{.input_bus_count = 1, .output_bus_count = 1})), _ring(ring) {
+    auto const manageable_node = manageable_graph_node::cast(this->node);
+
+    manageable_node->set_prepare_rendering_handler([this] {
+        this->node->set_render_handler([ring = this->_ring](node_render_args const &args) {
+            for (auto const &pair : args.source_connections) {
+                pair.second.render(args.buffer, args.time);
+            }
+
+            ring->write(*args.buffer, args.time);
+        });
+    });
+}
+
+shared_memory_ring_ptr const &graph_shared_memory_sink::ring() const {
+    return this->_ring;
+}
+
+graph_shared_memory_sink_ptr graph_shared_memory_sink::make_shared(shared_memory_ring_ptr const &ring) {
+    return graph_shared_memory_sink_ptr(new graph_shared_memory_sink{ring});
+}
@@ -0,0 +1,29 @@
+//
+//  yas_audio_graph_shared_memory_sink.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_graph_node.h>
+#include <audio/yas_audio_shared_memory_ring.h>
+
+namespace yas::audio {
+// passes the rendered source through and writes it to a shared_memory_ring for another process.
+struct graph_shared_memory_sink final {
+    [[nodiscard]] shared_memory_ring_ptr const &ring() const;
+
+    graph_node_ptr const node;
+
+    [[nodiscard]] static graph_shared_memory_sink_ptr make_shared(shared_memory_ring_ptr const &);
+
+   private:
+    shared_memory_ring_ptr const _ring;
+
+    explicit graph_shared_memory_sink(shared_memory_ring_ptr const &);
+
+    graph_shared_memory_sink(graph_shared_memory_sink const &) = delete;
+    graph_shared_memory_sink(graph_shared_memory_sink &&) = delete;
+    graph_shared_memory_sink &operator=(graph_shared_memory_sink const &) = delete;
+    graph_shared_memory_sink &operator=(graph_shared_memory_sink &&) = delete;
+};
+}  // namespace yas::audio
@@ -29,6 +29,7 @@ void io::_initialize() {
         this->_io_core = io_core;
         io_core->set_render_handler(this->_render_handler);
         io_core->set_maximum_frames_per_slice(this->_maximum_frames);
+        io_core->set_render_thread_policy(this->_render_thread_policy);
     }
 }
 
@@ -119,6 +120,25 @@ uint32_t io::maximum_frames_per_slice() const {
     return this->_maximum_frames;
 }
 
+void io::set_render_thread_policy(audio::render_thread_policy const &policy) {
+    this->_render_thread_policy = policy;
+
+    if (auto const &io_core = this->_io_core) {
+        io_core.value()->set_render_thread_policy(policy);
+    }
+}
+
+audio::render_thread_policy const &io::render_thread_policy() const {
+    return this->_render_thread_policy;
+}
+
+std::vector<audio::render_thread_policy::error_t> io::render_thread_policy_errors() const {
+    if (auto const &io_core = this->_io_core) {
+        return io_core.value()->render_thread_policy_errors();
+    }
+    return {};
+}
+
 void io::start() {
     if (this->_is_running) {
         return;
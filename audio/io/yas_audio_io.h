@@ -7,6 +7,7 @@
 #include <audio/yas_audio_io_device.h>
 #include <audio/yas_audio_io_kernel.h>
 #include <audio/yas_audio_ptr.h>
+#include <audio/yas_audio_render_thread_policy.h>
 #include <audio/yas_audio_time.h>
 #include <audio/yas_audio_types.h>
 #include <observing/yas_observing_umbrella.h>
@@ -35,6 +36,10 @@ struct io final {
     void set_render_handler(std::optional<io_render_f>);
     void set_maximum_frames_per_slice(uint32_t const);
     [[nodiscard]] uint32_t maximum_frames_per_slice() const;
+    void set_render_thread_policy(audio::render_thread_policy const &);
+    [[nodiscard]] audio::render_thread_policy const &render_thread_policy() const;
+    // the settings of the policy refused when the io started last.
+    [[nodiscard]] std::vector<audio::render_thread_policy::error_t> render_thread_policy_errors() const;
 
     void start();
     void stop();
@@ -50,6 +55,7 @@ struct io final {
     bool _is_running = false;
     std::optional<io_render_f> _render_handler = std::nullopt;
     uint32_t _maximum_frames = 4096;
+    audio::render_thread_policy _render_thread_policy;
 
     observing::notifier_ptr<running_method> const _running_notifier =
         observing::notifier<running_method>::make_shared();
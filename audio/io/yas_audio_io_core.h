@@ -5,6 +5,7 @@
 #pragma once
 
 #include <audio/yas_audio_io_kernel.h>
+#include <audio/yas_audio_render_thread_policy.h>
 #include <observing/yas_observing_umbrella.h>
 
 namespace yas::audio {
@@ -16,6 +17,13 @@ struct io_core {
 
     virtual bool start() = 0;
     virtual void stop() = 0;
+
+    // the cores rendering on threads of the system ignore the policy.
+    virtual void set_render_thread_policy(render_thread_policy const &) {
+    }
+    [[nodiscard]] virtual std::vector<render_thread_policy::error_t> render_thread_policy_errors() const {
+        return {};
+    }
 };
 
 using io_core_ptr = std::shared_ptr<io_core>;
@@ -4,9 +4,27 @@
 
 #include "yas_audio_io_kernel.h"
 
+#include <unistd.h>
+
 using namespace yas;
 using namespace yas::audio;
 
+namespace yas::audio::io_kernel_utils {
+static void prefault(pcm_buffer &buffer) {
+    auto const page_size = static_cast<std::size_t>(getpagesize());
+    AudioBufferList *const abl = buffer.audio_buffer_list();
+
+    for (uint32_t buf_idx = 0; buf_idx < abl->mNumberBuffers; ++buf_idx) {
+        auto *const data = static_cast<uint8_t volatile *>(abl->mBuffers[buf_idx].mData);
+        std::size_t const byte_size = abl->mBuffers[buf_idx].mDataByteSize;
+
+        for (std::size_t offset = 0; offset < byte_size; offset += page_size) {
+            data[offset] = data[offset];
+        }
+    }
+}
+}  // namespace yas::audio::io_kernel_utils
+
 io_kernel::io_kernel(io_render_f const &render_handler, std::optional<format> const &input_format,
                      std::optional<format> const &output_format, uint32_t const frame_capacity)
     : render_handler(render_handler),
@@ -24,6 +42,16 @@ void io_kernel::reset_buffers() {
     }
 }
 
+void io_kernel::prefault_buffers() {
+    if (auto const &buffer = this->input_buffer) {
+        io_kernel_utils::prefault(*buffer);
+    }
+
+    if (auto const &buffer = this->output_buffer) {
+        io_kernel_utils::prefault(*buffer);
+    }
+}
+
 io_kernel_ptr io_kernel::make_shared(io_render_f const &render_handler, std::optional<format> const &input_format,
                                      std::optional<format> const &output_format, uint32_t const frame_capacity) {
     return std::shared_ptr<io_kernel>(new io_kernel{render_handler, input_format, output_format, frame_capacity});
@@ -26,6 +26,8 @@ struct io_kernel final {
     std::optional<time> input_time = std::nullopt;
 
     void reset_buffers();
+    // touches every page of the input and output buffers not to fault on the render thread.
+    void prefault_buffers();
 
     [[nodiscard]] static io_kernel_ptr make_shared(io_render_f const &,
                                                    std::optional<audio::format> const &input_format,
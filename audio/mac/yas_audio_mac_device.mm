@@ -1,5 +1,5 @@
 //
-//  yas_audio_mac_device.cpp
+//  yas_audio_mac_device.mm
 //
 
 #include "yas_audio_mac_device.h"
@@ -8,6 +8,7 @@
 
 #include <cpp_utils/yas_cf_utils.h>
 
+#include "yas_audio_executor.h"
 #include "yas_audio_mac_empty_device.h"
 #include "yas_audio_mac_io_core.h"
 #include "yas_audio_renewable_device.h"
@@ -86,10 +87,17 @@ static void _add_listener(AudioObjectID const object_id, AudioObjectPropertySele
     AudioObjectPropertyAddress const address = {
         .mSelector = selector, .mScope = scope, .mElement = kAudioObjectPropertyElementMaster};
 
+    // the block is called on a thread of the hal and the handler is performed on the control executor.
     raise_if_raw_audio_error(AudioObjectAddPropertyListenerBlock(
-        object_id, &address, dispatch_get_main_queue(),
+        object_id, &address, nullptr,
         ^(uint32_t const address_count, const AudioObjectPropertyAddress *const addresses) {
-            handler(address_count, addresses);
+            control_executor()->perform(
+                [handler, addresses = std::vector<AudioObjectPropertyAddress>(addresses, addresses + address_count)] {
+                    // the executor may perform on a thread without a run loop that drains the autoreleased objects.
+                    @autoreleasepool {
+                        handler(static_cast<uint32_t>(addresses.size()), addresses.data());
+                    }
+                });
         }));
 }
 
@@ -1,11 +1,12 @@
 //
-//  yas_audio_mac_device_stream.cpp
+//  yas_audio_mac_device_stream.mm
 //
 
 #include "yas_audio_mac_device.h"
 
 #if (TARGET_OS_MAC && !TARGET_OS_IPHONE)
 
+#include "yas_audio_executor.h"
 #include "yas_audio_format.h"
 
 using namespace yas;
@@ -137,11 +138,16 @@ void mac_device::stream::_add_listener(AudioObjectPropertySelector const &select
                                                 .mScope = kAudioObjectPropertyScopeGlobal,
                                                 .mElement = kAudioObjectPropertyElementMaster};
 
-    raise_if_raw_audio_error(
-        AudioObjectAddPropertyListenerBlock(this->_stream_id, &address, dispatch_get_main_queue(),
-                                            ^(uint32_t address_count, const AudioObjectPropertyAddress *addresses) {
-                                                handler(address_count, addresses);
-                                            }));
+    raise_if_raw_audio_error(AudioObjectAddPropertyListenerBlock(
+        this->_stream_id, &address, nullptr, ^(uint32_t address_count, const AudioObjectPropertyAddress *addresses) {
+            control_executor()->perform(
+                [handler, addresses = std::vector<AudioObjectPropertyAddress>(addresses, addresses + address_count)] {
+                    // the executor may perform on a thread without a run loop that drains the autoreleased objects.
+                    @autoreleasepool {
+                        handler(static_cast<uint32_t>(addresses.size()), addresses.data());
+                    }
+                });
+        }));
 }
 
 mac_device::stream_ptr mac_device::stream::make_shared(mac_device::stream::args args) {
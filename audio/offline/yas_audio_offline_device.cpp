@@ -4,13 +4,40 @@
 
 #include "yas_audio_offline_device.h"
 
+#include <algorithm>
+
 #include "yas_audio_offline_io_core.h"
 
 using namespace yas;
 using namespace yas::audio;
 
-offline_device::offline_device(format const &output_format, offline_render_f &&render_handler)
-    : _output_format(output_format), _render_handler(std::move(render_handler)) {
+offline_device::offline_device(args &&args)
+    : _output_format(args.output_format),
+      _render_handler(args.render_handler.value_or(nullptr)),
+      _stream_args(std::move(args.stream)),
+      _scheduler(args.scheduler),
+      _scheduling_priority(args.scheduling_priority) {
+    if (args.render_handler.has_value() == this->_stream_args.has_value()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) +
+                                    " : either render_handler or stream is required.");
+    }
+
+    if (args.render_handler.has_value() && !this->_render_handler) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : render_handler is null.");
+    }
+
+    if (this->_scheduler.has_value() && !this->_scheduler.value()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : scheduler is null.");
+    }
+
+    if (auto &stream_args = this->_stream_args) {
+        if (!stream_args->sink) {
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : sink is null.");
+        }
+
+        auto &sample_times = stream_args->split_sample_times;
+        std::sort(sample_times.begin(), sample_times.end());
+    }
 }
 
 std::optional<format> offline_device::input_format() const {
@@ -38,10 +65,22 @@ offline_render_f offline_device::render_handler() const {
     return this->_render_handler;
 }
 
+std::optional<offline_stream_args> const &offline_device::stream_args() const {
+    return this->_stream_args;
+}
+
 std::optional<offline_completion_f> offline_device::completion_handler() const {
     return this->_completion_handler;
 }
 
+std::optional<offline_scheduler_ptr> const &offline_device::scheduler() const {
+    return this->_scheduler;
+}
+
+int32_t offline_device::scheduling_priority() const {
+    return this->_scheduling_priority;
+}
+
 void offline_device::_prepare(offline_device_ptr const &device, offline_completion_f &&completion_handler) {
     this->_weak_device = device;
 
@@ -49,7 +88,10 @@ void offline_device::_prepare(offline_device_ptr const &device, offline_completi
                                  called = std::make_shared<bool>(false)](bool const cancelled) mutable {
         if (!*called) {
             *called = true;
-            completion_handler(cancelled);
+
+            if (completion_handler) {
+                completion_handler(cancelled);
+            }
 
             if (auto const device = weak_device.lock()) {
                 device->_completion_handler = std::nullopt;
@@ -61,7 +103,14 @@ void offline_device::_prepare(offline_device_ptr const &device, offline_completi
 
 offline_device_ptr offline_device::make_shared(format const &output_format, offline_render_f &&render_handler,
                                                offline_completion_f &&completion_handler) {
-    auto shared = offline_device_ptr{new offline_device{output_format, std::move(render_handler)}};
+    return make_shared(
+        {.output_format = output_format, .render_handler = std::move(render_handler),
+         .completion_handler = std::move(completion_handler)});
+}
+
+offline_device_ptr offline_device::make_shared(args args) {
+    auto completion_handler = std::move(args.completion_handler);
+    auto shared = offline_device_ptr{new offline_device{std::move(args)}};
     shared->_prepare(shared, std::move(completion_handler));
     return shared;
 }
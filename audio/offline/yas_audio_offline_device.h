@@ -15,7 +15,37 @@ struct offline_render_args {
 using offline_render_f = std::function<continuation(offline_render_args)>;
 using offline_completion_f = std::function<void(bool const cancelled)>;
 
+// receives the rendered blocks directly on the render thread.
+struct offline_sink {
+    virtual ~offline_sink() = default;
+
+    // the frame length of the buffer is the length of the block.
+    virtual continuation write(pcm_buffer const &, audio::time const &) = 0;
+    // called on the render thread after the last block before the completion.
+    virtual void finish(bool const cancelled) {
+    }
+};
+
+// renders blocks as large as the maximum frames per slice of the io into the sink.
+struct offline_stream_args {
+    offline_sink_ptr sink;
+    uint64_t frame_length = 0;  // renders until the sink aborts if 0
+    // the blocks are split at these sample times so that the events on them are sample accurate.
+    std::vector<int64_t> split_sample_times = {};
+};
+
 struct offline_device : io_device {
+    struct args {
+        audio::format output_format;
+        // either of them. the stream renders blocks into the sink instead of calling the render handler each slice.
+        std::optional<offline_render_f> render_handler = std::nullopt;
+        std::optional<offline_stream_args> stream = std::nullopt;
+        offline_completion_f completion_handler = nullptr;
+        // renders as a job of the scheduler instead of on its own thread.
+        std::optional<offline_scheduler_ptr> scheduler = std::nullopt;
+        int32_t scheduling_priority = 0;
+    };
+
     [[nodiscard]] std::optional<audio::format> input_format() const override;
     [[nodiscard]] std::optional<audio::format> output_format() const override;
 
@@ -25,21 +55,29 @@ struct offline_device : io_device {
 
     [[nodiscard]] observing::endable observe_io_device(observing::caller<io_device::method>::handler_f &&) override;
 
+    // null if the device renders a stream.
     [[nodiscard]] offline_render_f render_handler() const;
+    [[nodiscard]] std::optional<offline_stream_args> const &stream_args() const;
     [[nodiscard]] std::optional<offline_completion_f> completion_handler() const;
+    [[nodiscard]] std::optional<offline_scheduler_ptr> const &scheduler() const;
+    [[nodiscard]] int32_t scheduling_priority() const;
 
     static offline_device_ptr make_shared(audio::format const &output_format, offline_render_f &&,
                                           offline_completion_f &&);
+    static offline_device_ptr make_shared(args);
 
    private:
     std::weak_ptr<offline_device> _weak_device;
     audio::format const _output_format;
-    offline_render_f _render_handler;
+    offline_render_f const _render_handler;
+    std::optional<offline_stream_args> _stream_args;
     std::optional<offline_completion_f> _completion_handler;
+    std::optional<offline_scheduler_ptr> const _scheduler;
+    int32_t const _scheduling_priority;
 
     observing::notifier_ptr<io_device::method> const _notifier = observing::notifier<io_device::method>::make_shared();
 
-    offline_device(audio::format const &output_format, offline_render_f &&);
+    explicit offline_device(args &&);
 
     void _prepare(offline_device_ptr const &, offline_completion_f &&);
 };
@@ -0,0 +1,196 @@
+//
+//  yas_audio_offline_file_sink.cpp
+//
+
+#include "yas_audio_offline_file_sink.h"
+
+#include <cpp_utils/yas_result.h>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::offline_file_sink_utils {
+static int64_t now_nanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static double to_seconds(int64_t const nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1000000000.0;
+}
+}  // namespace yas::audio::offline_file_sink_utils
+
+offline_file_sink::offline_file_sink(args &&args)
+    : _file(std::move(args.file)),
+      _ring(pcm_ring_buffer::make_shared(this->_file->processing_format(), args.ring_frame_capacity)),
+      _write_buffer(this->_file->processing_format(),
+                    std::clamp(args.write_frame_length, uint32_t(1), this->_ring->frame_capacity())) {
+    this->_thread = std::thread{[this] { this->_run_writer(); }};
+}
+
+offline_file_sink::~offline_file_sink() {
+    this->_join_writer();
+}
+
+continuation offline_file_sink::write(pcm_buffer const &buffer, audio::time const &) {
+    if (buffer.format() != this->_ring->format()) {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        if (!this->_write_error) {
+            this->_write_error = file::write_error_t::invalid_format;
+        }
+        return continuation::abort;
+    }
+
+    int64_t expected = -1;
+    this->_begin_nanoseconds.compare_exchange_strong(expected, offline_file_sink_utils::now_nanoseconds());
+
+    uint32_t const frame_length = buffer.frame_length();
+    uint32_t begin_frame = 0;
+
+    while (begin_frame < frame_length) {
+        auto const result = this->_ring->write(buffer, begin_frame);
+        if (!result) {
+            return continuation::abort;
+        }
+
+        uint32_t const written_length = result.value();
+        begin_frame += written_length;
+
+        std::unique_lock<std::mutex> lock(this->_mutex);
+
+        if (this->_write_error || this->_is_finishing) {
+            return continuation::abort;
+        }
+
+        if (written_length > 0) {
+            this->_condition.notify_all();
+        }
+
+        if (begin_frame < frame_length) {
+            // back-pressure. waits until the writer thread frees a part of the ring.
+            int64_t const wait_begin = offline_file_sink_utils::now_nanoseconds();
+
+            this->_condition.wait(lock, [this] {
+                return this->_write_error || this->_is_finishing || this->_ring->writable_frame_length() > 0;
+            });
+
+            this->_blocked_nanoseconds += offline_file_sink_utils::now_nanoseconds() - wait_begin;
+        }
+    }
+
+    this->_rendered_frames += frame_length;
+
+    return continuation::keep;
+}
+
+void offline_file_sink::finish(bool const) {
+    this->_join_writer();
+}
+
+audio::file_ptr const &offline_file_sink::file() const {
+    return this->_file;
+}
+
+bool offline_file_sink::is_finished() const {
+    return this->_is_finished;
+}
+
+std::optional<file::write_error_t> offline_file_sink::write_error() const {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    return this->_write_error;
+}
+
+offline_file_sink_statistics offline_file_sink::statistics() const {
+    offline_file_sink_statistics statistics{.rendered_frames = this->_rendered_frames,
+                                            .written_frames = this->_written_frames,
+                                            .blocked_duration = offline_file_sink_utils::to_seconds(
+                                                static_cast<int64_t>(this->_blocked_nanoseconds.load())),
+                                            .write_duration = offline_file_sink_utils::to_seconds(
+                                                static_cast<int64_t>(this->_write_nanoseconds.load()))};
+
+    int64_t const begin = this->_begin_nanoseconds;
+
+    if (begin >= 0) {
+        int64_t const end = this->_end_nanoseconds;
+        statistics.elapsed_duration =
+            offline_file_sink_utils::to_seconds((end >= 0 ? end : offline_file_sink_utils::now_nanoseconds()) - begin);
+    }
+
+    if (statistics.elapsed_duration > 0.0) {
+        statistics.frames_per_second = static_cast<double>(statistics.written_frames) / statistics.elapsed_duration;
+    }
+
+    return statistics;
+}
+
+void offline_file_sink::_run_writer() {
+    auto &buffer = this->_write_buffer;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+
+            this->_condition.wait(lock, [this, &buffer] {
+                return this->_is_finishing || this->_ring->readable_frame_length() >= buffer.frame_capacity();
+            });
+        }
+
+        // the remaining frames are drained after finishing.
+        auto const read_result = this->_ring->read(buffer);
+
+        if (read_result && read_result.value() > 0) {
+            // locks once so that the render thread does not miss the notification between its check and wait.
+            { std::lock_guard<std::mutex> lock(this->_mutex); }
+            this->_condition.notify_all();
+
+            int64_t const write_begin = offline_file_sink_utils::now_nanoseconds();
+            auto const write_result = this->_file->write_from_buffer(buffer);
+            this->_write_nanoseconds += offline_file_sink_utils::now_nanoseconds() - write_begin;
+
+            if (!write_result) {
+                std::lock_guard<std::mutex> lock(this->_mutex);
+                this->_write_error = write_result.error();
+                this->_condition.notify_all();
+                return;
+            }
+
+            this->_written_frames += read_result.value();
+        } else {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            if (this->_is_finishing) {
+                return;
+            }
+        }
+    }
+}
+
+void offline_file_sink::_join_writer() {
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+
+        if (this->_is_finishing) {
+            return;
+        }
+
+        this->_is_finishing = true;
+    }
+
+    this->_condition.notify_all();
+
+    this->_thread.join();
+
+    this->_end_nanoseconds = offline_file_sink_utils::now_nanoseconds();
+    this->_is_finished = true;
+}
+
+offline_file_sink_ptr offline_file_sink::make_shared(args args) {
+    if (!args.file || !args.file->is_opened()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : file is not opened.");
+    }
+
+    return offline_file_sink_ptr{new offline_file_sink{std::move(args)}};
+}
@@ -0,0 +1,78 @@
+//
+//  yas_audio_offline_file_sink.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_file.h>
+#include <audio/yas_audio_offline_device.h>
+#include <audio/yas_audio_pcm_ring_buffer.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace yas::audio {
+struct offline_file_sink_statistics {
+    uint64_t rendered_frames = 0;  // handed to the sink by the render thread
+    uint64_t written_frames = 0;   // written to the file by the writer thread
+    double blocked_duration = 0.0;  // seconds. the render thread waited for space in the ring
+    double write_duration = 0.0;    // seconds. the writer thread spent converting and writing
+    double elapsed_duration = 0.0;  // seconds. from the first block until finished or now
+    double frames_per_second = 0.0;  // the combined throughput of rendering and writing
+};
+
+// hands the blocks rendered by an offline_device in stream mode through a ring to a writer thread.
+// the writer converts and writes into the file while the next block renders.
+// the render thread waits while the ring is full, so the rendering never runs ahead of the file more than the ring.
+struct offline_file_sink final : offline_sink {
+    struct args {
+        audio::file_ptr file;  // created. the processing format must be the format of the device
+        uint32_t ring_frame_capacity = 65536;
+        uint32_t write_frame_length = 8192;  // the maximum frames written to the file at once
+    };
+
+    ~offline_file_sink();
+
+    continuation write(pcm_buffer const &, audio::time const &) override;
+    void finish(bool const cancelled) override;
+
+    [[nodiscard]] audio::file_ptr const &file() const;
+    [[nodiscard]] bool is_finished() const;
+    // the first error of the writer thread. the rendering is aborted by it.
+    [[nodiscard]] std::optional<file::write_error_t> write_error() const;
+    [[nodiscard]] offline_file_sink_statistics statistics() const;
+
+    [[nodiscard]] static offline_file_sink_ptr make_shared(args);
+
+   private:
+    audio::file_ptr const _file;
+    pcm_ring_buffer_ptr const _ring;
+    pcm_buffer _write_buffer;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _is_finishing = false;
+    std::optional<file::write_error_t> _write_error = std::nullopt;
+    std::thread _thread;
+
+    std::atomic<bool> _is_finished{false};
+    std::atomic<uint64_t> _rendered_frames{0};
+    std::atomic<uint64_t> _written_frames{0};
+    std::atomic<uint64_t> _blocked_nanoseconds{0};
+    std::atomic<uint64_t> _write_nanoseconds{0};
+    std::atomic<int64_t> _begin_nanoseconds{-1};
+    std::atomic<int64_t> _end_nanoseconds{-1};
+
+    explicit offline_file_sink(args &&);
+
+    void _run_writer();
+    void _join_writer();
+
+    offline_file_sink(offline_file_sink const &) = delete;
+    offline_file_sink(offline_file_sink &&) = delete;
+    offline_file_sink &operator=(offline_file_sink const &) = delete;
+    offline_file_sink &operator=(offline_file_sink &&) = delete;
+};
+}  // namespace yas::audio
@@ -16,6 +16,9 @@ struct offline_io_core : io_core {
     [[nodiscard]] bool start() override;
     void stop() override;
 
+    void set_render_thread_policy(render_thread_policy const &) override;
+    [[nodiscard]] std::vector<render_thread_policy::error_t> render_thread_policy_errors() const override;
+
     static offline_io_core_ptr make_shared(offline_device_ptr const &);
 
    private:
@@ -26,6 +29,8 @@ struct offline_io_core : io_core {
 
     std::optional<io_render_f> _render_handler = std::nullopt;
     uint32_t _maximum_frames = 4096;
+    render_thread_policy _render_thread_policy;
+    std::vector<render_thread_policy::error_t> _render_thread_policy_errors;
 
     offline_io_core(offline_device_ptr const &);
 
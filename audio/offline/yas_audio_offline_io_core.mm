@@ -3,9 +3,11 @@
 //
 
 #include "yas_audio_offline_io_core.h"
-#include <cpp_utils/yas_thread.h>
 #include <future>
+#include <mutex>
+#include "yas_audio_executor.h"
 #include "yas_audio_offline_device.h"
+#include "yas_audio_offline_scheduler.h"
 
 using namespace yas;
 using namespace yas::audio;
@@ -17,35 +19,51 @@ struct offline_io_core::render_context {
     render_context(std::optional<offline_completion_f> completion) : _completion(std::move(completion)) {
     }
 
+    // called on the control thread. the completion is called once by stop() or complete() whichever is first.
     void stop() {
-        raise_if_sub_thread();
+        std::optional<offline_completion_f> completion = std::nullopt;
+
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+
+            if (!this->promise.has_value()) {
+                return;
+            }
 
-        if (this->promise.has_value()) {
             this->is_cancelled = true;
 
             this->promise.value().get_future().get();
 
             this->promise = std::nullopt;
 
-            if (auto const &completion = this->_completion) {
-                completion.value()(this->is_cancelled);
-                this->_completion = std::nullopt;
-            }
+            completion = std::exchange(this->_completion, std::nullopt);
+        }
+
+        // the completion may stop the io again.
+        if (completion) {
+            completion.value()(this->is_cancelled);
         }
     }
 
+    // called on the control executor.
     void complete() {
-        raise_if_sub_thread();
+        std::optional<offline_completion_f> completion = std::nullopt;
 
-        this->promise = std::nullopt;
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+
+            this->promise = std::nullopt;
 
-        if (auto const &completion = this->_completion) {
+            completion = std::exchange(this->_completion, std::nullopt);
+        }
+
+        if (completion) {
             completion.value()(this->is_cancelled);
-            this->_completion = std::nullopt;
         }
     }
 
    private:
+    std::mutex _mutex;
     std::optional<offline_completion_f> _completion;
 };
 
@@ -75,46 +93,166 @@ bool offline_io_core::start() {
         return false;
     }
 
+    if (this->_render_thread_policy.prefaults_buffers) {
+        kernel->prefault_buffers();
+    }
+
     this->_render_context = std::make_shared<render_context>(this->_device->completion_handler());
 
-    std::thread thread{[kernel = std::move(kernel), render_context = this->_render_context,
-                        device_render_handler = this->_device->render_handler()]() mutable {
-        uint32_t current_sample_time = 0;
+    std::function<continuation(void)> render_slice;
 
-        while (!render_context->is_cancelled) {
-            kernel->reset_buffers();
+    if (auto const &stream_args = this->_device->stream_args()) {
+        render_slice = [kernel = std::move(kernel), render_context = this->_render_context,
+                        args = stream_args.value(), sample_time = int64_t(0),
+                        split_idx = std::size_t(0)]() mutable {
+            if (render_context->is_cancelled) {
+                return continuation::abort;
+            }
 
             auto const &render_buffer = kernel->output_buffer;
             if (!render_buffer) {
                 render_context->is_cancelled = true;
-                break;
+                return continuation::abort;
             }
 
-            time time(current_sample_time, render_buffer->format().sample_rate());
+            uint64_t length = render_buffer->frame_capacity();
+
+            if (args.frame_length > 0) {
+                length = std::min(length, args.frame_length - static_cast<uint64_t>(sample_time));
+            }
+
+            auto const &split_sample_times = args.split_sample_times;
+
+            while (split_idx < split_sample_times.size() && split_sample_times.at(split_idx) <= sample_time) {
+                ++split_idx;
+            }
+
+            if (split_idx < split_sample_times.size()) {
+                length = std::min(length, static_cast<uint64_t>(split_sample_times.at(split_idx) - sample_time));
+            }
+
+            // only the frames of the block are cleared instead of the whole capacity.
+            render_buffer->set_frame_length(static_cast<uint32_t>(length));
+            render_buffer->clear();
+
+            time time(sample_time, render_buffer->format().sample_rate());
 
             kernel->render_handler({.output_buffer = render_buffer.get(),
                                     .output_time = time,
                                     .input_buffer = nullptr,
                                     .input_time = null_time_opt});
 
-            if (device_render_handler({.output_buffer = render_buffer, .output_time = time}) == continuation::abort) {
-                break;
+            if (args.sink->write(*render_buffer, time) == continuation::abort) {
+                return continuation::abort;
+            }
+
+            sample_time += length;
+
+            if (args.frame_length > 0 && static_cast<uint64_t>(sample_time) >= args.frame_length) {
+                return continuation::abort;
             }
 
+            return continuation::keep;
+        };
+    } else {
+        render_slice = [kernel = std::move(kernel), render_context = this->_render_context,
+                        device_render_handler = this->_device->render_handler(),
+                        current_sample_time = uint32_t(0)]() mutable {
             if (render_context->is_cancelled) {
-                break;
+                return continuation::abort;
+            }
+
+            kernel->reset_buffers();
+
+            auto const &render_buffer = kernel->output_buffer;
+            if (!render_buffer) {
+                render_context->is_cancelled = true;
+                return continuation::abort;
+            }
+
+            time time(current_sample_time, render_buffer->format().sample_rate());
+
+            kernel->render_handler({.output_buffer = render_buffer.get(),
+                                    .output_time = time,
+                                    .input_buffer = nullptr,
+                                    .input_time = null_time_opt});
+
+            if (device_render_handler({.output_buffer = render_buffer, .output_time = time}) == continuation::abort) {
+                return continuation::abort;
             }
 
             current_sample_time += render_buffer->frame_capacity();
+
+            return continuation::keep;
+        };
+    }
+
+    std::optional<offline_sink_ptr> sink = std::nullopt;
+    if (auto const &stream_args = this->_device->stream_args()) {
+        sink = stream_args.value().sink;
+    }
+
+    // called once. by the worker that rendered the last slice, or by the completion of a job the scheduler cancelled.
+    auto finish = [render_context = this->_render_context, sink = std::move(sink),
+                   is_finished = std::make_shared<std::atomic<bool>>(false)] {
+        if (is_finished->exchange(true)) {
+            return;
+        }
+
+        if (sink) {
+            sink.value()->finish(render_context->is_cancelled);
         }
 
         render_context->promise->set_value();
 
-        thread::perform_async_on_main([render_context]() { render_context->complete(); });
+        control_executor()->perform([render_context]() { render_context->complete(); });
+    };
+
+    if (auto const &scheduler = this->_device->scheduler()) {
+        // finished on the worker not to make stop() wait for the completion executor. the job cancelled by the
+        // scheduler without rendering the last slice is finished by the completion.
+        scheduler.value()->add_job({.render_slice =
+                                        [render_slice = std::move(render_slice), finish]() mutable {
+                                            if (render_slice() == continuation::abort) {
+                                                finish();
+                                                return continuation::abort;
+                                            }
+                                            return continuation::keep;
+                                        },
+                                    .completion =
+                                        [render_context = this->_render_context, finish](bool const cancelled) {
+                                            if (cancelled) {
+                                                render_context->is_cancelled = true;
+                                            }
+                                            finish();
+                                        },
+                                    .priority = this->_device->scheduling_priority()});
+
+        return true;
+    }
+
+    std::promise<std::vector<render_thread_policy::error_t>> applied;
+    auto applied_future = applied.get_future();
+
+    std::thread thread{[render_slice = std::move(render_slice), finish = std::move(finish),
+                        policy = this->_render_thread_policy, applied = std::move(applied)]() mutable {
+        // applied before the first slice not to render without the policy.
+        applied.set_value(policy.apply(pthread_self()));
+
+        if (policy.prefaults_buffers) {
+            prefault_thread_stack();
+        }
+
+        while (render_slice() == continuation::keep) {
+        }
+
+        finish();
     }};
 
     thread.detach();
 
+    this->_render_thread_policy_errors = applied_future.get();
+
     return true;
 }
 
@@ -124,6 +262,14 @@ void offline_io_core::stop() {
     }
 }
 
+void offline_io_core::set_render_thread_policy(render_thread_policy const &policy) {
+    this->_render_thread_policy = policy;
+}
+
+std::vector<render_thread_policy::error_t> offline_io_core::render_thread_policy_errors() const {
+    return this->_render_thread_policy_errors;
+}
+
 io_kernel_ptr offline_io_core::_make_kernel() const {
     auto const &output_format = this->_device->output_format();
 
@@ -0,0 +1,207 @@
+//
+//  yas_audio_offline_scheduler.cpp
+//
+
+#include "yas_audio_offline_scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+
+#include "yas_audio_executor.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+struct offline_scheduler::job {
+    job_id const identifier;
+    std::function<continuation(void)> render_slice;
+    std::function<void(bool const)> completion;
+    int32_t const priority;
+    std::atomic<bool> is_cancelled{false};
+    uint64_t ready_turn = 0;
+
+    job(job_id const identifier, job_args &&args)
+        : identifier(identifier),
+          render_slice(std::move(args.render_slice)),
+          completion(std::move(args.completion)),
+          priority(args.priority) {
+    }
+};
+
+offline_scheduler::offline_scheduler(args &&args)
+    : _slices_per_turn(std::max(args.slices_per_turn, uint32_t(1))),
+      _maximum_waiting_turns(args.maximum_waiting_turns),
+      _completion_executor(args.completion_executor.value_or(control_executor())) {
+    uint32_t const worker_count =
+        args.worker_count > 0 ? args.worker_count : std::max(std::thread::hardware_concurrency(), 1u);
+
+    this->_workers.reserve(worker_count);
+
+    for (uint32_t idx = 0; idx < worker_count; ++idx) {
+        std::promise<std::vector<render_thread_policy::error_t>> applied;
+        auto applied_future = applied.get_future();
+
+        this->_workers.emplace_back([this, policy = args.thread_policy, applied = std::move(applied)]() mutable {
+            // applied before the first job not to render without the policy.
+            applied.set_value(policy.apply(pthread_self()));
+
+            if (policy.prefaults_buffers) {
+                prefault_thread_stack();
+            }
+
+            this->_run_worker();
+        });
+
+        for (auto const &error : applied_future.get()) {
+            if (std::find(this->_render_thread_policy_errors.begin(), this->_render_thread_policy_errors.end(),
+                          error) == this->_render_thread_policy_errors.end()) {
+                this->_render_thread_policy_errors.push_back(error);
+            }
+        }
+    }
+}
+
+offline_scheduler::~offline_scheduler() {
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+
+        this->_is_terminated = true;
+
+        for (auto const &pair : this->_jobs) {
+            pair.second->is_cancelled = true;
+        }
+    }
+
+    this->_condition.notify_all();
+
+    for (auto &worker : this->_workers) {
+        worker.join();
+    }
+}
+
+uint32_t offline_scheduler::worker_count() const {
+    return static_cast<uint32_t>(this->_workers.size());
+}
+
+std::size_t offline_scheduler::job_count() const {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    return this->_jobs.size();
+}
+
+std::vector<render_thread_policy::error_t> const &offline_scheduler::render_thread_policy_errors() const {
+    return this->_render_thread_policy_errors;
+}
+
+offline_scheduler::job_id offline_scheduler::add_job(job_args &&args) {
+    if (!args.render_slice) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : render_slice is null.");
+    }
+
+    job_id identifier;
+
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+
+        if (this->_is_terminated) {
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " : terminated.");
+        }
+
+        identifier = this->_next_job_id++;
+
+        auto const job = std::make_shared<offline_scheduler::job>(identifier, std::move(args));
+        this->_jobs.emplace(identifier, job);
+        this->_push_ready_job(job);
+    }
+
+    this->_condition.notify_one();
+
+    return identifier;
+}
+
+void offline_scheduler::cancel_job(job_id const identifier) {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+
+    if (auto const iterator = this->_jobs.find(identifier); iterator != this->_jobs.end()) {
+        iterator->second->is_cancelled = true;
+    }
+}
+
+void offline_scheduler::_run_worker() {
+    while (true) {
+        std::shared_ptr<job> job;
+
+        {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+
+            this->_condition.wait(lock, [this] { return this->_is_terminated || !this->_ready_jobs.empty(); });
+
+            // the cancelled jobs are drained to complete them before terminating.
+            if (this->_ready_jobs.empty()) {
+                return;
+            }
+
+            job = this->_pop_ready_job();
+        }
+
+        bool is_finished = false;
+
+        for (uint32_t idx = 0; idx < this->_slices_per_turn; ++idx) {
+            if (job->is_cancelled || job->render_slice() == continuation::abort) {
+                is_finished = true;
+                break;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+
+            if (is_finished) {
+                this->_jobs.erase(job->identifier);
+            } else {
+                this->_push_ready_job(job);
+            }
+        }
+
+        if (!is_finished) {
+            this->_condition.notify_one();
+        } else if (job->completion) {
+            bool const cancelled = job->is_cancelled;
+            this->_completion_executor->perform(
+                [completion = std::move(job->completion), cancelled] { completion(cancelled); });
+        }
+    }
+}
+
+void offline_scheduler::_push_ready_job(std::shared_ptr<job> const &job) {
+    job->ready_turn = this->_turn_count;
+    this->_ready_jobs[job->priority].push_back(job);
+}
+
+std::shared_ptr<offline_scheduler::job> offline_scheduler::_pop_ready_job() {
+    auto iterator = this->_ready_jobs.begin();
+
+    // the front of each priority is the longest waiting of it.
+    for (auto each = std::next(iterator); each != this->_ready_jobs.end(); ++each) {
+        auto const &front = each->second.front();
+        if (this->_turn_count - front->ready_turn >= this->_maximum_waiting_turns &&
+            front->ready_turn < iterator->second.front()->ready_turn) {
+            iterator = each;
+        }
+    }
+
+    auto job = std::move(iterator->second.front());
+    iterator->second.pop_front();
+
+    if (iterator->second.empty()) {
+        this->_ready_jobs.erase(iterator);
+    }
+
+    ++this->_turn_count;
+
+    return job;
+}
+
+offline_scheduler_ptr offline_scheduler::make_shared(args args) {
+    return offline_scheduler_ptr{new offline_scheduler{std::move(args)}};
+}
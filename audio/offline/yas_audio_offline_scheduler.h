@@ -0,0 +1,85 @@
+//
+//  yas_audio_offline_scheduler.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_ptr.h>
+#include <audio/yas_audio_render_thread_policy.h>
+#include <audio/yas_audio_types.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace yas::audio {
+// renders many offline jobs on a bounded pool of worker threads.
+// a worker renders a job for some slices and then rotates it behind the other jobs of the same priority.
+// a job that has waited for the maximum waiting turns is rendered before the higher priorities not to starve.
+struct offline_scheduler final {
+    using job_id = uint64_t;
+
+    struct args {
+        uint32_t worker_count = 0;  // the number of the cores if 0
+        uint32_t slices_per_turn = 4;
+        uint32_t maximum_waiting_turns = 16;
+        render_thread_policy thread_policy;
+        std::optional<executor_ptr> completion_executor = std::nullopt;  // the control executor if null
+    };
+
+    struct job_args {
+        // called on a worker thread until it returns abort.
+        std::function<continuation(void)> render_slice;
+        std::function<void(bool const cancelled)> completion = nullptr;
+        int32_t priority = 0;  // the higher renders first
+    };
+
+    ~offline_scheduler();
+
+    [[nodiscard]] uint32_t worker_count() const;
+    [[nodiscard]] std::size_t job_count() const;
+    // the settings of the thread policy refused by any of the workers.
+    [[nodiscard]] std::vector<render_thread_policy::error_t> const &render_thread_policy_errors() const;
+
+    job_id add_job(job_args &&);
+    // the job stops before its next slice and completes as cancelled.
+    void cancel_job(job_id const);
+
+    [[nodiscard]] static offline_scheduler_ptr make_shared(args);
+
+   private:
+    struct job;
+
+    uint32_t const _slices_per_turn;
+    uint32_t const _maximum_waiting_turns;
+    executor_ptr const _completion_executor;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    std::map<int32_t, std::deque<std::shared_ptr<job>>, std::greater<int32_t>> _ready_jobs;
+    std::unordered_map<job_id, std::shared_ptr<job>> _jobs;
+    job_id _next_job_id = 1;
+    uint64_t _turn_count = 0;
+    bool _is_terminated = false;
+
+    std::vector<std::thread> _workers;
+    std::vector<render_thread_policy::error_t> _render_thread_policy_errors;
+
+    explicit offline_scheduler(args &&);
+
+    void _run_worker();
+    void _push_ready_job(std::shared_ptr<job> const &);
+    [[nodiscard]] std::shared_ptr<job> _pop_ready_job();
+
+    offline_scheduler(offline_scheduler const &) = delete;
+    offline_scheduler(offline_scheduler &&) = delete;
+    offline_scheduler &operator=(offline_scheduler const &) = delete;
+    offline_scheduler &operator=(offline_scheduler &&) = delete;
+};
+}  // namespace yas::audio
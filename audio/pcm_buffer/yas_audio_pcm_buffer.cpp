@@ -9,10 +9,17 @@
 #include <cpp_utils/yas_result.h>
 #include <cpp_utils/yas_stl_utils.h>
 
+#include <algorithm>
+#include <cmath>
 #include <exception>
 #include <functional>
 #include <string>
 
+#include "yas_audio_dsp_analysis.h"
+#include "yas_audio_dsp_convert.h"
+#include "yas_audio_dsp_interleave.h"
+#include "yas_audio_dsp_mix.h"
+
 using namespace yas;
 using namespace yas::audio;
 
@@ -81,15 +88,66 @@ static bool validate_pcm_format(audio::pcm_format const &pcm_format) {
 
 namespace yas::audio {
 struct abl_info {
-    uint32_t channel_count;
-    uint32_t frame_length;
-    std::vector<uint8_t *> datas;
-    std::vector<uint32_t> strides;
+    uint32_t channel_count = 0;
+    uint32_t frame_length = 0;
+};
+
+// a channel position in an AudioBufferList. walks the buffers instead of building per channel tables.
+struct abl_channel {
+    AudioBufferList const *const abl;
+    uint32_t const sample_byte_count;
+    uint32_t buf_idx = 0;
+    uint32_t ch_in_buffer = 0;
+
+    uint32_t stride() const {
+        return this->abl->mBuffers[this->buf_idx].mNumberChannels;
+    }
+
+    uint8_t *data(uint32_t const frame) const {
+        auto *const data = static_cast<uint8_t *>(this->abl->mBuffers[this->buf_idx].mData);
+        return &data[(frame * this->stride() + this->ch_in_buffer) * this->sample_byte_count];
+    }
 
-    abl_info() : channel_count(0), frame_length(0), datas(0), strides(0) {
+    bool is_buffer_head() const {
+        return this->ch_in_buffer == 0;
+    }
+
+    // true if the next count channels each have their own non-interleaved buffer.
+    bool is_non_interleaved(uint32_t const count) const {
+        if (!this->is_buffer_head() || this->buf_idx + count > this->abl->mNumberBuffers) {
+            return false;
+        }
+
+        for (uint32_t idx = this->buf_idx; idx < this->buf_idx + count; ++idx) {
+            if (this->abl->mBuffers[idx].mNumberChannels != 1) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void advance(uint32_t count) {
+        while (count > 0 && this->buf_idx < this->abl->mNumberBuffers) {
+            uint32_t const remain = this->stride() - this->ch_in_buffer;
+            if (count < remain) {
+                this->ch_in_buffer += count;
+                return;
+            }
+            count -= remain;
+            ++this->buf_idx;
+            this->ch_in_buffer = 0;
+        }
     }
 };
 
+static abl_channel make_abl_channel(AudioBufferList const *const abl, uint32_t const sample_byte_count,
+                                    uint32_t const ch_idx = 0) {
+    abl_channel channel{.abl = abl, .sample_byte_count = sample_byte_count};
+    channel.advance(ch_idx);
+    return channel;
+}
+
 using get_abl_info_result_t = result<abl_info, pcm_buffer::copy_error_t>;
 
 static get_abl_info_result_t get_abl_info(AudioBufferList const *abl, uint32_t const sample_byte_count) {
@@ -103,6 +161,10 @@ static get_abl_info_result_t get_abl_info(AudioBufferList const *abl, uint32_t c
 
     for (uint32_t buf_idx = 0; buf_idx < buffer_count; ++buf_idx) {
         uint32_t const stride = abl->mBuffers[buf_idx].mNumberChannels;
+        if (stride == 0) {
+            return get_abl_info_result_t(pcm_buffer::copy_error_t::invalid_abl);
+        }
+
         uint32_t const frame_length = abl->mBuffers[buf_idx].mDataByteSize / stride / sample_byte_count;
         if (data_info.frame_length == 0) {
             data_info.frame_length = frame_length;
@@ -112,20 +174,255 @@ static get_abl_info_result_t get_abl_info(AudioBufferList const *abl, uint32_t c
         data_info.channel_count += stride;
     }
 
-    if (data_info.channel_count > 0) {
-        for (uint32_t buf_idx = 0; buf_idx < buffer_count; buf_idx++) {
-            uint32_t const stride = abl->mBuffers[buf_idx].mNumberChannels;
-            uint8_t *data = static_cast<uint8_t *>(abl->mBuffers[buf_idx].mData);
-            for (uint32_t ch_idx = 0; ch_idx < stride; ++ch_idx) {
-                data_info.datas.push_back(&data[ch_idx * sample_byte_count]);
-                data_info.strides.push_back(stride);
+    return get_abl_info_result_t(std::move(data_info));
+}
+}  // namespace yas::audio
+
+namespace yas::audio::pcm_buffer_utils {
+// upper bound of channels interleaved or deinterleaved in one pass. wider buffers are copied channel by channel.
+static uint32_t constexpr group_channel_capacity = 256;
+
+static pcm_buffer::copy_result convert(AudioBufferList const *const from_abl, pcm_format const from_pcm_format,
+                                       AudioBufferList *const to_abl, pcm_format const to_pcm_format,
+                                       pcm_buffer::copy_options const &args) {
+    auto const from_type = dsp::to_dsp_sample_type(from_pcm_format);
+    auto const to_type = dsp::to_dsp_sample_type(to_pcm_format);
+    if (!from_type || !to_type) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    uint32_t const from_byte_count = dsp::sample_byte_count(*from_type);
+    uint32_t const to_byte_count = dsp::sample_byte_count(*to_type);
+
+    get_abl_info_result_t from_result = get_abl_info(from_abl, from_byte_count);
+    if (!from_result) {
+        return pcm_buffer::copy_result(from_result.error());
+    }
+
+    get_abl_info_result_t to_result = get_abl_info(to_abl, to_byte_count);
+    if (!to_result) {
+        return pcm_buffer::copy_result(to_result.error());
+    }
+
+    abl_info const &from_info = from_result.value();
+    abl_info const &to_info = to_result.value();
+
+    uint32_t const copy_length = args.length ?: (from_info.frame_length - args.from_begin_frame);
+
+    if ((args.from_begin_frame + copy_length) > from_info.frame_length ||
+        (args.to_begin_frame + copy_length) > to_info.frame_length) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    if (from_info.channel_count > to_info.channel_count) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_channel);
+    }
+
+    auto from_channel = make_abl_channel(from_abl, from_byte_count);
+    auto to_channel = make_abl_channel(to_abl, to_byte_count);
+
+    auto each = make_fast_each(from_info.channel_count);
+    while (yas_each_next(each)) {
+        dsp::convert(from_channel.data(args.from_begin_frame), *from_type, from_channel.stride(),
+                     to_channel.data(args.to_begin_frame), *to_type, to_channel.stride(), copy_length, args.dither);
+
+        from_channel.advance(1);
+        to_channel.advance(1);
+    }
+
+    return pcm_buffer::copy_result(copy_length);
+}
+
+// frames converted to float in one pass when the samples are not contiguous float32.
+static uint32_t constexpr float_chunk_length = 256;
+
+static dsp::sample_type dsp_sample_type(audio::format const &format) {
+    if (auto const type = dsp::to_dsp_sample_type(format.pcm_format())) {
+        return *type;
+    } else {
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
+
+// hands the samples to the handler as contiguous float runs. the handler returns false to stop.
+template <typename Handler>
+static bool each_float_run(void const *const data, dsp::sample_type const type, uint32_t const stride,
+                           uint32_t const length, Handler &&handler) {
+    if (type == dsp::sample_type::float32 && stride == 1) {
+        return handler(static_cast<float const *>(data), length);
+    }
+
+    float chunk[float_chunk_length];
+    uint32_t const byte_stride = dsp::sample_byte_count(type) * stride;
+    auto const *const bytes = static_cast<uint8_t const *>(data);
+
+    for (uint32_t begin = 0; begin < length; begin += float_chunk_length) {
+        uint32_t const chunk_length = std::min(float_chunk_length, length - begin);
+        dsp::convert_to_float32(&bytes[begin * byte_stride], type, stride, chunk, chunk_length);
+
+        if (!handler(static_cast<float const *>(chunk), chunk_length)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// runs the kernel on float runs of dst, and of src if it is given. contiguous float32 is processed in place and
+// anything else through stack chunks that are written back to dst.
+template <typename Kernel>
+static void process_float_run(void *const dst, dsp::sample_type const dst_type, uint32_t const dst_stride,
+                              void const *const src, dsp::sample_type const src_type, uint32_t const src_stride,
+                              uint32_t const length, dsp::tpdf_dither *const dither, Kernel &&kernel) {
+    bool const is_dst_in_place = dst_type == dsp::sample_type::float32 && dst_stride == 1;
+    bool const is_src_in_place = !src || (src_type == dsp::sample_type::float32 && src_stride == 1);
+
+    if (is_dst_in_place && is_src_in_place) {
+        kernel(static_cast<float const *>(src), static_cast<float *>(dst), 0, length);
+        return;
+    }
+
+    float dst_chunk[float_chunk_length];
+    float src_chunk[float_chunk_length];
+
+    auto *const dst_bytes = static_cast<uint8_t *>(dst);
+    auto const *const src_bytes = static_cast<uint8_t const *>(src);
+    uint32_t const dst_byte_stride = dsp::sample_byte_count(dst_type) * dst_stride;
+    uint32_t const src_byte_stride = dsp::sample_byte_count(src_type) * src_stride;
+
+    for (uint32_t begin = 0; begin < length; begin += float_chunk_length) {
+        uint32_t const chunk_length = std::min(float_chunk_length, length - begin);
+        void *const dst_data = &dst_bytes[begin * dst_byte_stride];
+
+        float *dst_run = static_cast<float *>(dst_data);
+        if (!is_dst_in_place) {
+            dsp::convert_to_float32(dst_data, dst_type, dst_stride, dst_chunk, chunk_length);
+            dst_run = dst_chunk;
+        }
+
+        float const *src_run = nullptr;
+        if (src) {
+            void const *const src_data = &src_bytes[begin * src_byte_stride];
+            if (is_src_in_place) {
+                src_run = static_cast<float const *>(src_data);
+            } else {
+                dsp::convert_to_float32(src_data, src_type, src_stride, src_chunk, chunk_length);
+                src_run = src_chunk;
             }
         }
+
+        kernel(src_run, dst_run, begin, chunk_length);
+
+        if (!is_dst_in_place) {
+            dsp::convert_from_float32(dst_chunk, dst_data, dst_type, dst_stride, chunk_length, dither);
+        }
+    }
+}
+
+static uint32_t gain_length(pcm_buffer::gain_options const &options, uint32_t const frame_length) {
+    uint32_t const length = options.length ?: (frame_length - std::min(options.begin_frame, frame_length));
+
+    if ((options.begin_frame + length) > frame_length) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. frame(" +
+                                std::to_string(options.begin_frame) + ") length(" + std::to_string(length) +
+                                ") frame_length(" + std::to_string(frame_length) + ")");
     }
 
-    return get_abl_info_result_t(std::move(data_info));
+    return length;
 }
-}  // namespace yas::audio
+
+// the value at offset of a ramp from start to end over length.
+static float ramp_value(float const start, float const end, uint32_t const offset, uint32_t const length) {
+    return start + (end - start) * static_cast<float>(offset) / static_cast<float>(length);
+}
+
+template <typename Kernel>
+static pcm_buffer::copy_result process_from(pcm_buffer const &from_buffer, pcm_buffer &to_buffer,
+                                            pcm_buffer::copy_options const &args, Kernel &&kernel) {
+    audio::format const &from_format = from_buffer.format();
+    audio::format const &to_format = to_buffer.format();
+
+    if (from_format.channel_count() != to_format.channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    auto const from_type = dsp::to_dsp_sample_type(from_format.pcm_format());
+    auto const to_type = dsp::to_dsp_sample_type(to_format.pcm_format());
+    if (!from_type || !to_type) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    uint32_t const from_frame_length = from_buffer.frame_length();
+    uint32_t const to_frame_length = to_buffer.frame_length();
+
+    if (args.from_begin_frame > from_frame_length) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    uint32_t const length = args.length ?: (from_frame_length - args.from_begin_frame);
+
+    if ((args.from_begin_frame + length) > from_frame_length || (args.to_begin_frame + length) > to_frame_length) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    auto from_channel = make_abl_channel(from_buffer.audio_buffer_list(), dsp::sample_byte_count(*from_type));
+    auto to_channel = make_abl_channel(to_buffer.audio_buffer_list(), dsp::sample_byte_count(*to_type));
+
+    auto each = make_fast_each(from_format.channel_count());
+    while (yas_each_next(each)) {
+        process_float_run(to_channel.data(args.to_begin_frame), *to_type, to_channel.stride(),
+                          from_channel.data(args.from_begin_frame), *from_type, from_channel.stride(), length,
+                          args.dither, kernel);
+
+        from_channel.advance(1);
+        to_channel.advance(1);
+    }
+
+    return pcm_buffer::copy_result(length);
+}
+
+template <typename Kernel>
+static pcm_buffer::copy_result process_channel_from(pcm_buffer const &from_buffer, pcm_buffer &to_buffer,
+                                                    pcm_buffer::copy_channel_options const &args, Kernel &&kernel) {
+    audio::format const &from_format = from_buffer.format();
+    audio::format const &to_format = to_buffer.format();
+
+    auto const from_type = dsp::to_dsp_sample_type(from_format.pcm_format());
+    auto const to_type = dsp::to_dsp_sample_type(to_format.pcm_format());
+    if (!from_type || !to_type) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    uint32_t const from_frame_length = from_buffer.frame_length();
+    uint32_t const to_frame_length = to_buffer.frame_length();
+
+    if (args.from_begin_frame >= from_frame_length || args.to_begin_frame >= to_frame_length) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    uint32_t const length =
+        args.length ?: std::min(from_frame_length - args.from_begin_frame, to_frame_length - args.to_begin_frame);
+
+    if ((args.from_begin_frame + length) > from_frame_length || (args.to_begin_frame + length) > to_frame_length) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    if (args.from_channel >= from_format.channel_count() || args.to_channel >= to_format.channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_channel);
+    }
+
+    auto const from_channel =
+        make_abl_channel(from_buffer.audio_buffer_list(), dsp::sample_byte_count(*from_type), args.from_channel);
+    auto const to_channel =
+        make_abl_channel(to_buffer.audio_buffer_list(), dsp::sample_byte_count(*to_type), args.to_channel);
+
+    process_float_run(to_channel.data(args.to_begin_frame), *to_type, to_channel.stride(),
+                      from_channel.data(args.from_begin_frame), *from_type, from_channel.stride(), length, nullptr,
+                      kernel);
+
+    return pcm_buffer::copy_result(length);
+}
+}  // namespace yas::audio::pcm_buffer_utils
 
 pcm_buffer::pcm_buffer(audio::format const &format, std::pair<audio::abl_uptr, audio::abl_data_uptr> &&abl_pair,
                        uint32_t const frame_capacity)
@@ -403,24 +700,214 @@ void pcm_buffer::clear(uint32_t const begin_frame, uint32_t const length) {
 }
 
 bool pcm_buffer::is_empty() const {
-    uint32_t const frame_size = this->_format.frame_byte_count();
-    int8_t zero_data[frame_size];
-    memset(zero_data, 0, frame_size);
+    uint32_t const byte_count = this->_frame_length * this->_format.frame_byte_count();
+    if (byte_count == 0) {
+        return true;
+    }
 
-    auto buffer_each = make_fast_each(this->_format.buffer_count());
-    while (yas_each_next(buffer_each)) {
-        int8_t const *data = this->_data_ptr_at_index<int8_t>(yas_each_index(buffer_each));
+    auto each = make_fast_each(this->_format.buffer_count());
+    while (yas_each_next(each)) {
+        int8_t const *data = this->_data_ptr_at_index<int8_t>(yas_each_index(each));
 
-        auto frame_each = make_fast_each(this->_frame_length);
-        while (yas_each_next(frame_each)) {
-            if (memcmp(&data[yas_each_index(frame_each) * frame_size], zero_data, frame_size) != 0) {
-                return false;
-            }
+        // every byte is zero when the first one is and each byte equals the next.
+        if (data[0] != 0 || memcmp(data, &data[1], byte_count - 1) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pcm_buffer::is_silent(float const threshold) const {
+    auto const type = pcm_buffer_utils::dsp_sample_type(this->_format);
+    bool const is_float = type == dsp::sample_type::float32 || type == dsp::sample_type::float64;
+    uint32_t const sample_count = this->_frame_length * this->_format.stride();
+
+    auto each = make_fast_each(this->_format.buffer_count());
+    while (yas_each_next(each)) {
+        bool const is_silent = pcm_buffer_utils::each_float_run(
+            this->_data_ptr_at_index<int8_t>(yas_each_index(each)), type, 1, sample_count,
+            [threshold, is_float](float const *const data, uint32_t const length) {
+                // NaN samples are not reflected in the peak.
+                return dsp::peak(data, length) <= threshold && (!is_float || dsp::is_finite(data, length));
+            });
+
+        if (!is_silent) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pcm_buffer::is_finite() const {
+    auto const type = pcm_buffer_utils::dsp_sample_type(this->_format);
+    if (type != dsp::sample_type::float32 && type != dsp::sample_type::float64) {
+        return true;
+    }
+
+    uint32_t const sample_count = this->_frame_length * this->_format.stride();
+
+    auto each = make_fast_each(this->_format.buffer_count());
+    while (yas_each_next(each)) {
+        // float64 is checked as is not to overflow to infinity in float32.
+        bool const is_finite =
+            type == dsp::sample_type::float64
+                ? dsp::is_finite(this->_data_ptr_at_index<double>(yas_each_index(each)), sample_count)
+                : dsp::is_finite(this->_data_ptr_at_index<float>(yas_each_index(each)), sample_count);
+
+        if (!is_finite) {
+            return false;
         }
     }
     return true;
 }
 
+float pcm_buffer::peak(uint32_t const ch_idx) const {
+    auto const type = pcm_buffer_utils::dsp_sample_type(this->_format);
+    float peak = 0.0f;
+
+    pcm_buffer_utils::each_float_run(this->_data_ptr_at_channel<int8_t>(ch_idx), type, this->_format.stride(),
+                                     this->_frame_length, [&peak](float const *const data, uint32_t const length) {
+                                         peak = std::fmax(peak, dsp::peak(data, length));
+                                         return true;
+                                     });
+
+    return peak;
+}
+
+float pcm_buffer::rms(uint32_t const ch_idx) const {
+    auto const type = pcm_buffer_utils::dsp_sample_type(this->_format);
+    double sum = 0.0;
+
+    pcm_buffer_utils::each_float_run(this->_data_ptr_at_channel<int8_t>(ch_idx), type, this->_format.stride(),
+                                     this->_frame_length, [&sum](float const *const data, uint32_t const length) {
+                                         sum += dsp::sum_of_squares(data, length);
+                                         return true;
+                                     });
+
+    return this->_frame_length > 0 ? static_cast<float>(std::sqrt(sum / this->_frame_length)) : 0.0f;
+}
+
+float pcm_buffer::dc_offset(uint32_t const ch_idx) const {
+    auto const type = pcm_buffer_utils::dsp_sample_type(this->_format);
+    double sum = 0.0;
+
+    pcm_buffer_utils::each_float_run(this->_data_ptr_at_channel<int8_t>(ch_idx), type, this->_format.stride(),
+                                     this->_frame_length, [&sum](float const *const data, uint32_t const length) {
+                                         sum += dsp::sum(data, length);
+                                         return true;
+                                     });
+
+    return this->_frame_length > 0 ? static_cast<float>(sum / this->_frame_length) : 0.0f;
+}
+
+void pcm_buffer::apply_gain(float const gain) {
+    this->apply_gain(gain, {});
+}
+
+void pcm_buffer::apply_gain(float const gain, gain_options const &options) {
+    if (options.channel) {
+        this->apply_gain_ramp(gain, gain, options);
+        return;
+    }
+
+    uint32_t const length = pcm_buffer_utils::gain_length(options, this->_frame_length);
+
+    auto const type = pcm_buffer_utils::dsp_sample_type(this->_format);
+    uint32_t const stride = this->_format.stride();
+    uint32_t const frame_byte_count = dsp::sample_byte_count(type) * stride;
+
+    // every channel gets the same gain, so each buffer is processed as one run of samples.
+    auto each = make_fast_each(this->_format.buffer_count());
+    while (yas_each_next(each)) {
+        int8_t *const data = this->_data_ptr_at_index<int8_t>(yas_each_index(each));
+        pcm_buffer_utils::process_float_run(
+            &data[options.begin_frame * frame_byte_count], type, 1, nullptr, type, 0, length * stride, nullptr,
+            [gain](float const *, float *const dst, uint32_t const, uint32_t const length) {
+                dsp::scale(dst, length, gain);
+            });
+    }
+}
+
+void pcm_buffer::apply_gain_ramp(float const start_gain, float const end_gain) {
+    this->apply_gain_ramp(start_gain, end_gain, {});
+}
+
+void pcm_buffer::apply_gain_ramp(float const start_gain, float const end_gain, gain_options const &options) {
+    uint32_t const length = pcm_buffer_utils::gain_length(options, this->_frame_length);
+
+    auto const type = pcm_buffer_utils::dsp_sample_type(this->_format);
+    uint32_t const stride = this->_format.stride();
+    uint32_t const frame_byte_count = dsp::sample_byte_count(type) * stride;
+
+    auto kernel = [start_gain, end_gain, total_length = length](float const *, float *const dst,
+                                                                uint32_t const offset, uint32_t const length) {
+        dsp::scale_ramp(dst, length, pcm_buffer_utils::ramp_value(start_gain, end_gain, offset, total_length),
+                        pcm_buffer_utils::ramp_value(start_gain, end_gain, offset + length, total_length));
+    };
+
+    uint32_t const begin_ch_idx = options.channel.value_or(0);
+    uint32_t const end_ch_idx = options.channel ? (begin_ch_idx + 1) : this->_format.channel_count();
+
+    for (uint32_t ch_idx = begin_ch_idx; ch_idx < end_ch_idx; ++ch_idx) {
+        int8_t *const data = this->_data_ptr_at_channel<int8_t>(ch_idx);
+        pcm_buffer_utils::process_float_run(&data[options.begin_frame * frame_byte_count], type, stride, nullptr,
+                                            type, 0, length, nullptr, kernel);
+    }
+}
+
+pcm_buffer::copy_result pcm_buffer::mix_from(pcm_buffer const &from_buffer, float const gain) {
+    return this->mix_from(from_buffer, gain, {});
+}
+
+pcm_buffer::copy_result pcm_buffer::mix_from(pcm_buffer const &from_buffer, float const gain, copy_options args) {
+    return pcm_buffer_utils::process_from(
+        from_buffer, *this, args,
+        [gain](float const *const src, float *const dst, uint32_t const, uint32_t const length) {
+            dsp::mix(src, dst, length, gain);
+        });
+}
+
+pcm_buffer::copy_result pcm_buffer::mix_channel_from(pcm_buffer const &from_buffer, float const gain,
+                                                     copy_channel_options args) {
+    return pcm_buffer_utils::process_channel_from(
+        from_buffer, *this, args,
+        [gain](float const *const src, float *const dst, uint32_t const, uint32_t const length) {
+            dsp::mix(src, dst, length, gain);
+        });
+}
+
+pcm_buffer::copy_result pcm_buffer::crossfade_from(pcm_buffer const &from_buffer) {
+    return this->crossfade_from(from_buffer, {});
+}
+
+pcm_buffer::copy_result pcm_buffer::crossfade_from(pcm_buffer const &from_buffer, copy_options args) {
+    uint32_t const total_length = args.length ?: (from_buffer.frame_length() -
+                                                  std::min(args.from_begin_frame, from_buffer.frame_length()));
+
+    return pcm_buffer_utils::process_from(
+        from_buffer, *this, args,
+        [total_length](float const *const src, float *const dst, uint32_t const offset, uint32_t const length) {
+            dsp::crossfade(src, dst, length, pcm_buffer_utils::ramp_value(0.0f, 1.0f, offset, total_length),
+                           pcm_buffer_utils::ramp_value(0.0f, 1.0f, offset + length, total_length));
+        });
+}
+
+pcm_buffer::copy_result pcm_buffer::crossfade_channel_from(pcm_buffer const &from_buffer,
+                                                           copy_channel_options args) {
+    uint32_t const from_frame_length = from_buffer.frame_length();
+    uint32_t const to_frame_length = this->frame_length();
+    uint32_t const total_length =
+        args.length ?: std::min(from_frame_length - std::min(args.from_begin_frame, from_frame_length),
+                                to_frame_length - std::min(args.to_begin_frame, to_frame_length));
+
+    return pcm_buffer_utils::process_channel_from(
+        from_buffer, *this, args,
+        [total_length](float const *const src, float *const dst, uint32_t const offset, uint32_t const length) {
+            dsp::crossfade(src, dst, length, pcm_buffer_utils::ramp_value(0.0f, 1.0f, offset, total_length),
+                           pcm_buffer_utils::ramp_value(0.0f, 1.0f, offset + length, total_length));
+        });
+}
+
 pcm_buffer::copy_result pcm_buffer::copy_from(pcm_buffer const &from_buffer) {
     return this->copy_from(from_buffer, {});
 }
@@ -428,16 +915,18 @@ pcm_buffer::copy_result pcm_buffer::copy_from(pcm_buffer const &from_buffer) {
 pcm_buffer::copy_result pcm_buffer::copy_from(pcm_buffer const &from_buffer, copy_options args) {
     audio::format const &from_format = from_buffer.format();
 
-    if ((from_format.pcm_format() != this->format().pcm_format()) ||
-        (from_format.channel_count() != this->format().channel_count())) {
+    if (from_format.channel_count() != this->format().channel_count()) {
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
     }
 
     AudioBufferList const *const from_abl = from_buffer.audio_buffer_list();
     AudioBufferList *const to_abl = this->audio_buffer_list();
 
-    auto result = copy(from_abl, to_abl, from_format.sample_byte_count(), args.from_begin_frame, args.to_begin_frame,
-                       args.length);
+    auto result = (from_format.pcm_format() == this->format().pcm_format())
+                      ? copy(from_abl, to_abl, from_format.sample_byte_count(), args.from_begin_frame,
+                             args.to_begin_frame, args.length)
+                      : pcm_buffer_utils::convert(from_abl, from_format.pcm_format(), to_abl,
+                                                  this->format().pcm_format(), args);
 
     if (result && args.from_begin_frame == 0 && args.to_begin_frame == 0 && args.length == 0) {
         this->set_frame_length(result.value());
@@ -550,7 +1039,7 @@ pcm_buffer::copy_result pcm_buffer::copy_from(T const *const from_data, uint32_t
         return pcm_buffer::copy_result(to_result.error());
     }
 
-    abl_info to_info = to_result.value();
+    abl_info const &to_info = to_result.value();
 
     if ((to_begin_frame + copy_length) > to_info.frame_length) {
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
@@ -560,8 +1049,9 @@ pcm_buffer::copy_result pcm_buffer::copy_from(T const *const from_data, uint32_t
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
     }
 
-    uint32_t const &to_stride = to_info.strides[to_ch_idx];
-    void *const to_data = &(to_info.datas[to_ch_idx][to_begin_frame * sample_byte_count * to_stride]);
+    auto const to_channel = make_abl_channel(to_abl, sample_byte_count, to_ch_idx);
+    uint32_t const to_stride = to_channel.stride();
+    void *const to_data = to_channel.data(to_begin_frame);
     void const *const from_data_at_begin = &(from_data[from_begin_frame * sample_byte_count * from_stride]);
 
     copy(from_data_at_begin, from_stride, to_data, to_stride, copy_length, sample_byte_count);
@@ -600,8 +1090,13 @@ pcm_buffer::copy_result pcm_buffer::copy_to(T *const to_data, uint32_t const to_
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
     }
 
-    uint32_t const &from_stride = from_info.strides[from_ch_idx];
-    void const *from_data = &(from_info.datas[from_ch_idx][from_begin_frame * sample_byte_count * from_stride]);
+    if (from_info.channel_count <= from_ch_idx) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_channel);
+    }
+
+    auto const from_channel = make_abl_channel(from_abl, sample_byte_count, from_ch_idx);
+    uint32_t const from_stride = from_channel.stride();
+    void const *from_data = from_channel.data(from_begin_frame);
     void *to_data_at_begin = &(to_data[to_begin_frame * sample_byte_count * to_stride]);
 
     audio::copy(from_data, from_stride, to_data_at_begin, to_stride, copy_length, sample_byte_count);
@@ -674,8 +1169,8 @@ pcm_buffer::copy_result audio::copy(AudioBufferList const *const from_abl, Audio
         return pcm_buffer::copy_result(to_result.error());
     }
 
-    abl_info from_info = from_result.value();
-    abl_info to_info = to_result.value();
+    abl_info const &from_info = from_result.value();
+    abl_info const &to_info = to_result.value();
 
     uint32_t const copy_length = length ?: (from_info.frame_length - from_begin_frame);
 
@@ -688,13 +1183,53 @@ pcm_buffer::copy_result audio::copy(AudioBufferList const *const from_abl, Audio
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_channel);
     }
 
-    for (uint32_t ch_idx = 0; ch_idx < from_info.channel_count; ch_idx++) {
-        uint32_t const &from_stride = from_info.strides[ch_idx];
-        uint32_t const &to_stride = to_info.strides[ch_idx];
-        void const *from_data = &(from_info.datas[ch_idx][from_begin_frame * sample_byte_count * from_stride]);
-        void *to_data = &(to_info.datas[ch_idx][to_begin_frame * sample_byte_count * to_stride]);
+    auto from_channel = make_abl_channel(from_abl, sample_byte_count);
+    auto to_channel = make_abl_channel(to_abl, sample_byte_count);
+    uint32_t ch_idx = 0;
+
+    while (ch_idx < from_info.channel_count) {
+        uint32_t const from_stride = from_channel.stride();
+        uint32_t const to_stride = to_channel.stride();
+        uint32_t step = 0;
+
+        if (from_channel.is_buffer_head() && to_channel.is_buffer_head()) {
+            if (from_stride == to_stride) {
+                step = from_stride;
+                memcpy(to_channel.data(to_begin_frame), from_channel.data(from_begin_frame),
+                       copy_length * sample_byte_count * from_stride);
+            } else if (from_stride <= pcm_buffer_utils::group_channel_capacity &&
+                       to_channel.is_non_interleaved(from_stride)) {
+                step = from_stride;
+                void *to_datas[pcm_buffer_utils::group_channel_capacity];
+                for (uint32_t idx = 0; idx < step; ++idx) {
+                    abl_channel const channel{
+                        .abl = to_abl, .sample_byte_count = sample_byte_count, .buf_idx = to_channel.buf_idx + idx};
+                    to_datas[idx] = channel.data(to_begin_frame);
+                }
+                dsp::deinterleave(from_channel.data(from_begin_frame), to_datas, step, copy_length,
+                                  sample_byte_count);
+            } else if (to_stride <= pcm_buffer_utils::group_channel_capacity &&
+                       from_channel.is_non_interleaved(to_stride)) {
+                step = to_stride;
+                void const *from_datas[pcm_buffer_utils::group_channel_capacity];
+                for (uint32_t idx = 0; idx < step; ++idx) {
+                    abl_channel const channel{
+                        .abl = from_abl, .sample_byte_count = sample_byte_count, .buf_idx = from_channel.buf_idx + idx};
+                    from_datas[idx] = channel.data(from_begin_frame);
+                }
+                dsp::interleave(from_datas, to_channel.data(to_begin_frame), step, copy_length, sample_byte_count);
+            }
+        }
+
+        if (step == 0) {
+            step = 1;
+            copy(from_channel.data(from_begin_frame), from_stride, to_channel.data(to_begin_frame), to_stride,
+                 copy_length, sample_byte_count);
+        }
 
-        copy(from_data, from_stride, to_data, to_stride, copy_length, sample_byte_count);
+        from_channel.advance(step);
+        to_channel.advance(step);
+        ch_idx += step;
     }
 
     return pcm_buffer::copy_result(copy_length);
@@ -9,6 +9,7 @@
 #include <audio/yas_audio_types.h>
 #include <cpp_utils/yas_result.h>
 
+#include <optional>
 #include <ostream>
 
 namespace yas {
@@ -16,12 +17,17 @@ template <typename T, typename U>
 class result;
 }
 
+namespace yas::audio::dsp {
+class tpdf_dither;
+}
+
 namespace yas::audio {
 struct pcm_buffer final {
     struct copy_options {
         uint32_t const from_begin_frame = 0;
         uint32_t const to_begin_frame = 0;
         uint32_t const length = 0;
+        dsp::tpdf_dither *const dither = nullptr;  // used when narrowing to int16 from a different pcm_format
     };
 
     struct copy_channel_options {
@@ -32,6 +38,12 @@ struct pcm_buffer final {
         uint32_t const length = 0;
     };
 
+    struct gain_options {
+        uint32_t const begin_frame = 0;
+        uint32_t const length = 0;
+        std::optional<uint32_t> const channel = std::nullopt;  // every channel if not set
+    };
+
     enum class copy_error_t {
         invalid_argument,
         invalid_abl,
@@ -43,6 +55,8 @@ struct pcm_buffer final {
     using copy_result = result<uint32_t, copy_error_t>;
 
     pcm_buffer(audio::format const &format, AudioBufferList *abl);
+    // owns the abl but not the data it points to. the data must outlive the buffer.
+    pcm_buffer(audio::format const &format, abl_uptr &&abl, uint32_t const frame_capacity);
     pcm_buffer(audio::format const &format, uint32_t const frame_capacity);
     pcm_buffer(audio::format const &format, pcm_buffer const &from_buffer, channel_map_t const &channel_map);
 
@@ -70,11 +84,31 @@ struct pcm_buffer final {
     void clear(uint32_t const begin_frame, uint32_t const length);
 
     bool is_empty() const;
+    // analysis in float full scale. integer formats are normalized as by dsp::convert_to_float32.
+    // not silent if any sample is NaN or infinity.
+    [[nodiscard]] bool is_silent(float const threshold = 0.0f) const;
+    [[nodiscard]] bool is_finite() const;
+    [[nodiscard]] float peak(uint32_t const ch_idx) const;
+    [[nodiscard]] float rms(uint32_t const ch_idx) const;
+    [[nodiscard]] float dc_offset(uint32_t const ch_idx) const;
+
+    // processed in float32. integer formats are clamped when written back.
+    void apply_gain(float const gain);
+    void apply_gain(float const gain, gain_options const &);
+    void apply_gain_ramp(float const start_gain, float const end_gain);
+    void apply_gain_ramp(float const start_gain, float const end_gain, gain_options const &);
 
     pcm_buffer::copy_result copy_from(pcm_buffer const &);
     pcm_buffer::copy_result copy_from(pcm_buffer const &, copy_options);
     pcm_buffer::copy_result copy_channel_from(pcm_buffer const &);
     pcm_buffer::copy_result copy_channel_from(pcm_buffer const &, copy_channel_options);
+    pcm_buffer::copy_result mix_from(pcm_buffer const &, float const gain);
+    pcm_buffer::copy_result mix_from(pcm_buffer const &, float const gain, copy_options);
+    pcm_buffer::copy_result mix_channel_from(pcm_buffer const &, float const gain, copy_channel_options);
+    // fades linearly from the current data to the data of the from buffer over the copied range.
+    pcm_buffer::copy_result crossfade_from(pcm_buffer const &);
+    pcm_buffer::copy_result crossfade_from(pcm_buffer const &, copy_options);
+    pcm_buffer::copy_result crossfade_channel_from(pcm_buffer const &, copy_channel_options);
     pcm_buffer::copy_result copy_from(AudioBufferList const *const from_abl, uint32_t const from_begin_frame = 0,
                                       uint32_t const to_begin_frame = 0, uint32_t const length = 0);
     pcm_buffer::copy_result copy_to(AudioBufferList *const to_abl, uint32_t const from_begin_frame = 0,
@@ -103,7 +137,6 @@ struct pcm_buffer final {
                channel_map_t const &channel_map);
     pcm_buffer(audio::format const &format, AudioBufferList *ptr, uint32_t const frame_capacity);
     pcm_buffer(audio::format const &format, abl_uptr &&abl, abl_data_uptr &&data, uint32_t const frame_capacity);
-    pcm_buffer(audio::format const &format, abl_uptr &&abl, uint32_t const frame_capacity);
 
     pcm_buffer &operator=(pcm_buffer &&) = delete;
     pcm_buffer(pcm_buffer const &) = delete;
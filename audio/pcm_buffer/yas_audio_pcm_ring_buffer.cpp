@@ -0,0 +1,149 @@
+//
+//  yas_audio_pcm_ring_buffer.cpp
+//
+
+#include "yas_audio_pcm_ring_buffer.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::pcm_ring_buffer_utils {
+static uint32_t frame_capacity(uint32_t const frame_capacity) {
+    if (frame_capacity == 0 || frame_capacity > (1u << 31)) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid frame_capacity(" +
+                                    std::to_string(frame_capacity) + ").");
+    }
+
+    uint32_t result = 1;
+    while (result < frame_capacity) {
+        result <<= 1;
+    }
+    return result;
+}
+}  // namespace yas::audio::pcm_ring_buffer_utils
+
+pcm_ring_buffer::pcm_ring_buffer(audio::format const &format, uint32_t const frame_capacity)
+    : _buffer(format, pcm_ring_buffer_utils::frame_capacity(frame_capacity)),
+      _mask(this->_buffer.frame_capacity() - 1) {
+}
+
+audio::format const &pcm_ring_buffer::format() const {
+    return this->_buffer.format();
+}
+
+uint32_t pcm_ring_buffer::frame_capacity() const {
+    return this->_buffer.frame_capacity();
+}
+
+uint32_t pcm_ring_buffer::readable_frame_length() const {
+    uint64_t const read_frame = this->_read_frame.load(std::memory_order_acquire);
+    return static_cast<uint32_t>(this->_write_frame.load(std::memory_order_acquire) - read_frame);
+}
+
+uint32_t pcm_ring_buffer::writable_frame_length() const {
+    return this->frame_capacity() - this->readable_frame_length();
+}
+
+pcm_buffer::copy_result pcm_ring_buffer::write(pcm_buffer const &buffer, uint32_t const from_begin_frame) {
+    if (buffer.format().channel_count() != this->format().channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    if (from_begin_frame > buffer.frame_length()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    uint32_t const capacity = this->frame_capacity();
+    uint64_t const write_frame = this->_write_frame.load(std::memory_order_relaxed);
+    uint32_t const frame_length = buffer.frame_length() - from_begin_frame;
+
+    // the reader index is loaded again only when the cached one says there is not enough space.
+    if (capacity - (write_frame - this->_cached_read_frame) < frame_length) {
+        this->_cached_read_frame = this->_read_frame.load(std::memory_order_acquire);
+    }
+
+    uint32_t const length =
+        std::min(frame_length, static_cast<uint32_t>(capacity - (write_frame - this->_cached_read_frame)));
+
+    if (length == 0) {
+        return pcm_buffer::copy_result(0);
+    }
+
+    uint32_t const begin = static_cast<uint32_t>(write_frame) & this->_mask;
+    uint32_t const head_length = std::min(length, capacity - begin);
+
+    if (auto result = this->_buffer.copy_from(
+            buffer, {.from_begin_frame = from_begin_frame, .to_begin_frame = begin, .length = head_length});
+        !result) {
+        return result;
+    }
+
+    if (head_length < length) {
+        if (auto result = this->_buffer.copy_from(buffer, {.from_begin_frame = from_begin_frame + head_length,
+                                                           .to_begin_frame = 0,
+                                                           .length = length - head_length});
+            !result) {
+            return result;
+        }
+    }
+
+    this->_write_frame.store(write_frame + length, std::memory_order_release);
+
+    return pcm_buffer::copy_result(length);
+}
+
+pcm_buffer::copy_result pcm_ring_buffer::read(pcm_buffer &buffer) {
+    return this->read(buffer, buffer.frame_capacity());
+}
+
+pcm_buffer::copy_result pcm_ring_buffer::read(pcm_buffer &buffer, uint32_t const frame_length) {
+    if (buffer.format().channel_count() != this->format().channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    if (frame_length > buffer.frame_capacity()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    uint32_t const capacity = this->frame_capacity();
+    uint64_t const read_frame = this->_read_frame.load(std::memory_order_relaxed);
+
+    if (this->_cached_write_frame - read_frame < frame_length) {
+        this->_cached_write_frame = this->_write_frame.load(std::memory_order_acquire);
+    }
+
+    uint32_t const length = std::min(frame_length, static_cast<uint32_t>(this->_cached_write_frame - read_frame));
+
+    buffer.set_frame_length(length);
+
+    if (length == 0) {
+        return pcm_buffer::copy_result(0);
+    }
+
+    uint32_t const begin = static_cast<uint32_t>(read_frame) & this->_mask;
+    uint32_t const head_length = std::min(length, capacity - begin);
+
+    if (auto result = buffer.copy_from(this->_buffer, {.from_begin_frame = begin, .length = head_length}); !result) {
+        return result;
+    }
+
+    if (head_length < length) {
+        if (auto result = buffer.copy_from(
+                this->_buffer, {.from_begin_frame = 0, .to_begin_frame = head_length, .length = length - head_length});
+            !result) {
+            return result;
+        }
+    }
+
+    this->_read_frame.store(read_frame + length, std::memory_order_release);
+
+    return pcm_buffer::copy_result(length);
+}
+
+pcm_ring_buffer_ptr pcm_ring_buffer::make_shared(audio::format const &format, uint32_t const frame_capacity) {
+    return pcm_ring_buffer_ptr(new pcm_ring_buffer{format, frame_capacity});
+}
@@ -0,0 +1,50 @@
+//
+//  yas_audio_pcm_ring_buffer.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_pcm_buffer.h>
+
+#include <atomic>
+
+namespace yas::audio {
+// a wait-free queue of frames between one writing thread and one reading thread.
+// the frame capacity is rounded up to a power of two.
+struct pcm_ring_buffer final {
+    [[nodiscard]] audio::format const &format() const;
+    [[nodiscard]] uint32_t frame_capacity() const;
+
+    [[nodiscard]] uint32_t readable_frame_length() const;
+    [[nodiscard]] uint32_t writable_frame_length() const;
+
+    // writer thread. writes the frames of the buffer from the begin frame that fit and returns the written length.
+    pcm_buffer::copy_result write(pcm_buffer const &, uint32_t const from_begin_frame = 0);
+    // reader thread. reads up to the frame capacity of the buffer and sets its frame length to the read length.
+    pcm_buffer::copy_result read(pcm_buffer &);
+    // reader thread. reads up to the frame length not to exceed a render slice in a larger buffer.
+    pcm_buffer::copy_result read(pcm_buffer &, uint32_t const frame_length);
+
+    [[nodiscard]] static pcm_ring_buffer_ptr make_shared(audio::format const &, uint32_t const frame_capacity);
+
+   private:
+    // large enough for the 128 byte lines of apple silicon.
+    static std::size_t constexpr cache_line_size = 128;
+
+    pcm_buffer _buffer;
+    uint32_t const _mask;
+
+    alignas(cache_line_size) std::atomic<uint64_t> _write_frame{0};
+    uint64_t _cached_read_frame = 0;
+
+    alignas(cache_line_size) std::atomic<uint64_t> _read_frame{0};
+    uint64_t _cached_write_frame = 0;
+
+    pcm_ring_buffer(audio::format const &, uint32_t const frame_capacity);
+
+    pcm_ring_buffer(pcm_ring_buffer const &) = delete;
+    pcm_ring_buffer(pcm_ring_buffer &&) = delete;
+    pcm_ring_buffer &operator=(pcm_ring_buffer const &) = delete;
+    pcm_ring_buffer &operator=(pcm_ring_buffer &&) = delete;
+};
+}  // namespace yas::audio
@@ -0,0 +1,90 @@
+//
+//  yas_audio_pcm_span.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_types.h>
+
+#include <iterator>
+#include <type_traits>
+
+namespace yas::audio {
+class pcm_buffer;
+
+template <typename T>
+struct pcm_stride_iterator final {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    pcm_stride_iterator(T *const ptr, uint32_t const stride) noexcept;
+
+    T &operator*() const noexcept;
+    pcm_stride_iterator &operator++() noexcept;
+    pcm_stride_iterator operator++(int) noexcept;
+    bool operator==(pcm_stride_iterator const &) const noexcept;
+    bool operator!=(pcm_stride_iterator const &) const noexcept;
+
+   private:
+    T *_ptr;
+    uint32_t _stride;
+};
+
+template <typename T, bool Interleaved>
+struct pcm_channel_span final {
+    using iterator = std::conditional_t<Interleaved, pcm_stride_iterator<T>, T *>;
+
+    pcm_channel_span(T *const data, uint32_t const length, uint32_t const stride) noexcept;
+
+    [[nodiscard]] T *data() const noexcept;
+    [[nodiscard]] uint32_t size() const noexcept;
+    [[nodiscard]] uint32_t stride() const noexcept;
+
+    T &operator[](uint32_t const frame) const noexcept;
+
+    iterator begin() const noexcept;
+    iterator end() const noexcept;
+
+   private:
+    T *_data;
+    uint32_t _length;
+    uint32_t _stride;
+};
+
+// a typed view of a pcm_buffer. the pcm_format and the interleaving are checked once when the view is made,
+// so the accessors do no checks. frame_length is captured at construction.
+template <typename T, bool Interleaved>
+struct pcm_span final {
+    using value_type = std::remove_const_t<T>;
+    using buffer_type = std::conditional_t<std::is_const_v<T>, pcm_buffer const, pcm_buffer>;
+    using channel_type = pcm_channel_span<T, Interleaved>;
+
+    explicit pcm_span(buffer_type &);
+
+    [[nodiscard]] uint32_t channel_count() const noexcept;
+    [[nodiscard]] uint32_t frame_length() const noexcept;
+    [[nodiscard]] uint32_t stride() const noexcept;
+
+    [[nodiscard]] T *data_at_channel(uint32_t const ch_idx) const noexcept;
+    [[nodiscard]] channel_type channel(uint32_t const ch_idx) const noexcept;
+    [[nodiscard]] T &at(uint32_t const ch_idx, uint32_t const frame) const noexcept;
+
+    [[nodiscard]] static bool is_compatible(audio::format const &);
+
+   private:
+    AudioBuffer const *_buffers;
+    uint32_t _channel_count;
+    uint32_t _frame_length;
+};
+
+template <typename T>
+using interleaved_pcm_span = pcm_span<T, true>;
+template <typename T>
+using non_interleaved_pcm_span = pcm_span<T, false>;
+}  // namespace yas::audio
+
+#include <audio/yas_audio_pcm_span_private.h>
@@ -0,0 +1,173 @@
+//
+//  yas_audio_pcm_span_private.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_pcm_buffer.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace yas::audio::pcm_span_utils {
+template <typename T>
+constexpr pcm_format pcm_format_of() {
+    using value_type = std::remove_const_t<T>;
+
+    if constexpr (std::is_same_v<value_type, float>) {
+        return pcm_format::float32;
+    } else if constexpr (std::is_same_v<value_type, double>) {
+        return pcm_format::float64;
+    } else if constexpr (std::is_same_v<value_type, int16_t>) {
+        return pcm_format::int16;
+    } else if constexpr (std::is_same_v<value_type, int32_t>) {
+        return pcm_format::fixed824;
+    } else {
+        static_assert(std::is_same_v<value_type, float>, "unsupported sample type.");
+        return pcm_format::other;
+    }
+}
+}  // namespace yas::audio::pcm_span_utils
+
+namespace yas::audio {
+#pragma mark - pcm_stride_iterator
+
+template <typename T>
+pcm_stride_iterator<T>::pcm_stride_iterator(T *const ptr, uint32_t const stride) noexcept
+    : _ptr(ptr), _stride(stride) {
+}
+
+template <typename T>
+T &pcm_stride_iterator<T>::operator*() const noexcept {
+    return *this->_ptr;
+}
+
+template <typename T>
+pcm_stride_iterator<T> &pcm_stride_iterator<T>::operator++() noexcept {
+    this->_ptr += this->_stride;
+    return *this;
+}
+
+template <typename T>
+pcm_stride_iterator<T> pcm_stride_iterator<T>::operator++(int) noexcept {
+    auto result = *this;
+    this->_ptr += this->_stride;
+    return result;
+}
+
+template <typename T>
+bool pcm_stride_iterator<T>::operator==(pcm_stride_iterator const &rhs) const noexcept {
+    return this->_ptr == rhs._ptr;
+}
+
+template <typename T>
+bool pcm_stride_iterator<T>::operator!=(pcm_stride_iterator const &rhs) const noexcept {
+    return this->_ptr != rhs._ptr;
+}
+
+#pragma mark - pcm_channel_span
+
+template <typename T, bool Interleaved>
+pcm_channel_span<T, Interleaved>::pcm_channel_span(T *const data, uint32_t const length,
+                                                   uint32_t const stride) noexcept
+    : _data(data), _length(length), _stride(stride) {
+}
+
+template <typename T, bool Interleaved>
+T *pcm_channel_span<T, Interleaved>::data() const noexcept {
+    return this->_data;
+}
+
+template <typename T, bool Interleaved>
+uint32_t pcm_channel_span<T, Interleaved>::size() const noexcept {
+    return this->_length;
+}
+
+template <typename T, bool Interleaved>
+uint32_t pcm_channel_span<T, Interleaved>::stride() const noexcept {
+    if constexpr (Interleaved) {
+        return this->_stride;
+    } else {
+        return 1;
+    }
+}
+
+template <typename T, bool Interleaved>
+T &pcm_channel_span<T, Interleaved>::operator[](uint32_t const frame) const noexcept {
+    return this->_data[frame * this->stride()];
+}
+
+template <typename T, bool Interleaved>
+typename pcm_channel_span<T, Interleaved>::iterator pcm_channel_span<T, Interleaved>::begin() const noexcept {
+    if constexpr (Interleaved) {
+        return iterator{this->_data, this->_stride};
+    } else {
+        return this->_data;
+    }
+}
+
+template <typename T, bool Interleaved>
+typename pcm_channel_span<T, Interleaved>::iterator pcm_channel_span<T, Interleaved>::end() const noexcept {
+    if constexpr (Interleaved) {
+        return iterator{this->_data + this->_length * this->_stride, this->_stride};
+    } else {
+        return this->_data + this->_length;
+    }
+}
+
+#pragma mark - pcm_span
+
+template <typename T, bool Interleaved>
+pcm_span<T, Interleaved>::pcm_span(buffer_type &buffer)
+    : _buffers(buffer.audio_buffer_list()->mBuffers),
+      _channel_count(buffer.format().channel_count()),
+      _frame_length(buffer.frame_length()) {
+    if (!is_compatible(buffer.format())) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid format.");
+    }
+}
+
+template <typename T, bool Interleaved>
+uint32_t pcm_span<T, Interleaved>::channel_count() const noexcept {
+    return this->_channel_count;
+}
+
+template <typename T, bool Interleaved>
+uint32_t pcm_span<T, Interleaved>::frame_length() const noexcept {
+    return this->_frame_length;
+}
+
+template <typename T, bool Interleaved>
+uint32_t pcm_span<T, Interleaved>::stride() const noexcept {
+    if constexpr (Interleaved) {
+        return this->_channel_count;
+    } else {
+        return 1;
+    }
+}
+
+template <typename T, bool Interleaved>
+T *pcm_span<T, Interleaved>::data_at_channel(uint32_t const ch_idx) const noexcept {
+    if constexpr (Interleaved) {
+        return static_cast<T *>(this->_buffers[0].mData) + ch_idx;
+    } else {
+        return static_cast<T *>(this->_buffers[ch_idx].mData);
+    }
+}
+
+template <typename T, bool Interleaved>
+typename pcm_span<T, Interleaved>::channel_type pcm_span<T, Interleaved>::channel(
+    uint32_t const ch_idx) const noexcept {
+    return channel_type{this->data_at_channel(ch_idx), this->_frame_length, this->stride()};
+}
+
+template <typename T, bool Interleaved>
+T &pcm_span<T, Interleaved>::at(uint32_t const ch_idx, uint32_t const frame) const noexcept {
+    return this->data_at_channel(ch_idx)[frame * this->stride()];
+}
+
+template <typename T, bool Interleaved>
+bool pcm_span<T, Interleaved>::is_compatible(audio::format const &format) {
+    return format.pcm_format() == pcm_span_utils::pcm_format_of<T>() && format.is_interleaved() == Interleaved;
+}
+}  // namespace yas::audio
@@ -4,18 +4,23 @@
 
 #include "yas_audio_rendering_connection.h"
 
+#include "yas_audio_rendering_converter.h"
 #include "yas_audio_rendering_node.h"
 
 using namespace yas;
 using namespace yas::audio;
 
 rendering_connection::rendering_connection(uint32_t const src_bus_idx, rendering_node const *const src_node,
-                                           audio::format const format)
-    : source_bus_idx(src_bus_idx), source_node(src_node), format(std::move(format)) {
+                                           audio::format const format,
+                                           std::shared_ptr<rendering_converter> const &converter)
+    : source_bus_idx(src_bus_idx), source_node(src_node), format(std::move(format)), converter(converter) {
 }
 
 bool rendering_connection::render(pcm_buffer *const buffer, time const &time) const {
     if (buffer->format() != this->format) {
+        if (this->converter && this->converter->destination_format == buffer->format()) {
+            return this->converter->pull(buffer, time, *this);
+        }
         return false;
     }
 
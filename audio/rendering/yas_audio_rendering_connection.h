@@ -8,15 +8,20 @@
 #include <audio/yas_audio_pcm_buffer.h>
 #include <audio/yas_audio_time.h>
 
+#include <memory>
+
 namespace yas::audio {
 class rendering_node;
+class rendering_converter;
 
 struct rendering_connection {
     uint32_t const source_bus_idx;
     audio::format const format;
     rendering_node const *const source_node;
+    std::shared_ptr<rendering_converter> const converter;
 
-    rendering_connection(uint32_t const src_bus_idx, rendering_node const *const src_node, audio::format const format);
+    rendering_connection(uint32_t const src_bus_idx, rendering_node const *const src_node, audio::format const format,
+                         std::shared_ptr<rendering_converter> const &converter = nullptr);
 
     bool render(audio::pcm_buffer *const, audio::time const &) const;
 };
@@ -0,0 +1,222 @@
+//
+//  yas_audio_rendering_converter.cpp
+//
+
+#include "yas_audio_rendering_converter.h"
+
+#include <cpp_utils/yas_fast_each.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "yas_audio_dsp_convert.h"
+#include "yas_audio_dsp_mix.h"
+#include "yas_audio_rendering_connection.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::rendering_converter_utils {
+static uint32_t frame_capacity(uint32_t const frame_capacity, double const ratio) {
+    return static_cast<uint32_t>(std::ceil(static_cast<double>(frame_capacity) * std::max(1.0, ratio))) + 1;
+}
+
+static void const *channel_data(pcm_buffer const &buffer, uint32_t const ch_idx) {
+    auto const &format = buffer.format();
+    AudioBufferList const *const abl = buffer.audio_buffer_list();
+
+    if (format.is_interleaved()) {
+        return static_cast<uint8_t const *>(abl->mBuffers[0].mData) + ch_idx * format.sample_byte_count();
+    } else {
+        return abl->mBuffers[ch_idx].mData;
+    }
+}
+
+static void *channel_data(pcm_buffer *const buffer, uint32_t const ch_idx) {
+    return const_cast<void *>(channel_data(*static_cast<pcm_buffer const *>(buffer), ch_idx));
+}
+}  // namespace yas::audio::rendering_converter_utils
+
+rendering_converter::rendering_converter(audio::format const &source_format, audio::format const &destination_format,
+                                         uint32_t const frame_capacity)
+    : source_format(source_format),
+      destination_format(destination_format),
+      _frame_capacity(rendering_converter_utils::frame_capacity(
+          frame_capacity, destination_format.sample_rate() / source_format.sample_rate())),
+      _source_frame_capacity(rendering_converter_utils::frame_capacity(
+          frame_capacity, source_format.sample_rate() / destination_format.sample_rate())),
+      _resampler(source_format.sample_rate() != destination_format.sample_rate()
+                     ? std::make_optional<dsp::resampler>(source_format.sample_rate(), destination_format.sample_rate(),
+                                                          destination_format.channel_count(),
+                                                          this->_source_frame_capacity)
+                     : std::nullopt),
+      _source_buffer(source_format,
+                     this->_source_frame_capacity + (this->_resampler ? this->_resampler->tap_count() : 0)),
+      _source_data(source_format.channel_count() + 1, std::vector<float>(this->_source_buffer.frame_capacity())),
+      _destination_data(this->_resampler ? destination_format.channel_count() : 0,
+                        std::vector<float>(this->_frame_capacity)),
+      _mapped_ptrs(destination_format.channel_count()),
+      _destination_ptrs(destination_format.channel_count()) {
+    if (!is_convertible(source_format, destination_format)) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : not convertible. source(" +
+                                    to_string(source_format) + ") destination(" + to_string(destination_format) + ")");
+    }
+
+    auto each = make_fast_each(static_cast<uint32_t>(this->_destination_data.size()));
+    while (yas_each_next(each)) {
+        auto const &ch_idx = yas_each_index(each);
+        this->_destination_ptrs[ch_idx] = this->_destination_data[ch_idx].data();
+    }
+}
+
+uint32_t rendering_converter::frame_capacity() const {
+    return this->_frame_capacity;
+}
+
+bool rendering_converter::pull(pcm_buffer *const destination, audio::time const &time,
+                               rendering_connection const &source) {
+    if (destination->format() != this->destination_format) {
+        return false;
+    }
+
+    uint32_t const frame_length = destination->frame_length();
+    if (frame_length > this->_frame_capacity) {
+        return false;
+    }
+
+    uint32_t const source_length =
+        this->_resampler ? this->_resampler->required_input_frames(frame_length) : frame_length;
+    if (source_length > this->_source_buffer.frame_capacity()) {
+        return false;
+    }
+
+    this->_source_buffer.set_frame_length(source_length);
+    this->_source_buffer.clear();
+
+    if (source_length > 0) {
+        if (this->_resampler) {
+            if (!this->_source_sample_time.has_value()) {
+                this->_source_sample_time = std::llround(static_cast<double>(time.sample_time()) *
+                                                         this->source_format.sample_rate() /
+                                                         this->destination_format.sample_rate());
+            }
+
+            source.render(&this->_source_buffer,
+                          audio::time{*this->_source_sample_time, this->source_format.sample_rate()});
+
+            *this->_source_sample_time += source_length;
+        } else {
+            source.render(&this->_source_buffer, time);
+        }
+    }
+
+    this->_read_source(this->_source_buffer, source_length);
+
+    if (this->_resampler) {
+        this->_resampler->push(this->_mapped_ptrs.data(), source_length);
+        this->_resampler->pull(this->_destination_ptrs.data(), frame_length);
+    }
+
+    this->_write_destination(destination, frame_length);
+
+    return true;
+}
+
+bool rendering_converter::push(pcm_buffer const &source, pcm_buffer *const destination) {
+    if (source.format() != this->source_format || destination->format() != this->destination_format) {
+        return false;
+    }
+
+    uint32_t const source_length = source.frame_length();
+    if (source_length > this->_source_frame_capacity) {
+        return false;
+    }
+
+    this->_read_source(source, source_length);
+
+    if (this->_resampler) {
+        this->_resampler->push(this->_mapped_ptrs.data(), source_length);
+        uint32_t const capacity = std::min(this->_frame_capacity, destination->frame_capacity());
+        uint32_t const length = this->_resampler->pull(this->_destination_ptrs.data(), capacity);
+        destination->set_frame_length(length);
+        this->_write_destination(destination, length);
+    } else {
+        uint32_t const length = std::min(source_length, destination->frame_capacity());
+        destination->set_frame_length(length);
+        this->_write_destination(destination, length);
+    }
+
+    return true;
+}
+
+void rendering_converter::_read_source(pcm_buffer const &source, uint32_t const length) {
+    uint32_t const src_ch_count = this->source_format.channel_count();
+    uint32_t const dst_ch_count = this->destination_format.channel_count();
+    uint32_t const stride = this->source_format.stride();
+    pcm_format const pcm_format = this->source_format.pcm_format();
+
+    auto src_each = make_fast_each(src_ch_count);
+    while (yas_each_next(src_each)) {
+        auto const &ch_idx = yas_each_index(src_each);
+        dsp::convert_to_float32(rendering_converter_utils::channel_data(source, ch_idx), pcm_format, stride,
+                                this->_source_data[ch_idx].data(), length);
+    }
+
+    float *const extra_data = this->_source_data[src_ch_count].data();
+    std::fill_n(extra_data, length, 0.0f);
+
+    if (dst_ch_count == 1 && src_ch_count > 1) {
+        float const gain = 1.0f / static_cast<float>(src_ch_count);
+        auto mix_each = make_fast_each(src_ch_count);
+        while (yas_each_next(mix_each)) {
+            dsp::mix(this->_source_data[yas_each_index(mix_each)].data(), extra_data, length, gain);
+        }
+
+        this->_mapped_ptrs[0] = extra_data;
+    } else {
+        auto dst_each = make_fast_each(dst_ch_count);
+        while (yas_each_next(dst_each)) {
+            auto const &ch_idx = yas_each_index(dst_each);
+            if (src_ch_count == 1) {
+                this->_mapped_ptrs[ch_idx] = this->_source_data[0].data();
+            } else if (ch_idx < src_ch_count) {
+                this->_mapped_ptrs[ch_idx] = this->_source_data[ch_idx].data();
+            } else {
+                this->_mapped_ptrs[ch_idx] = extra_data;
+            }
+        }
+    }
+}
+
+void rendering_converter::_write_destination(pcm_buffer *const destination, uint32_t const length) {
+    float const *const *const data =
+        this->_resampler ? this->_destination_ptrs.data() : this->_mapped_ptrs.data();
+    uint32_t const stride = this->destination_format.stride();
+    pcm_format const pcm_format = this->destination_format.pcm_format();
+
+    auto each = make_fast_each(this->destination_format.channel_count());
+    while (yas_each_next(each)) {
+        auto const &ch_idx = yas_each_index(each);
+        dsp::convert_from_float32(data[ch_idx], rendering_converter_utils::channel_data(destination, ch_idx),
+                                  pcm_format, stride, length);
+    }
+}
+
+bool rendering_converter::is_convertible(audio::format const &source_format, audio::format const &destination_format) {
+    if (source_format.channel_count() == 0 || destination_format.channel_count() == 0) {
+        return false;
+    }
+
+    if (!dsp::is_convertible_pcm_format(source_format.pcm_format()) ||
+        !dsp::is_convertible_pcm_format(destination_format.pcm_format())) {
+        return false;
+    }
+
+    if (source_format.sample_rate() == destination_format.sample_rate()) {
+        return true;
+    }
+
+    return dsp::resampler::is_supported(source_format.sample_rate(), destination_format.sample_rate());
+}
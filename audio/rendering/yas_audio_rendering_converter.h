@@ -0,0 +1,52 @@
+//
+//  yas_audio_rendering_converter.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_dsp_resampler.h>
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_time.h>
+
+#include <optional>
+#include <vector>
+
+namespace yas::audio {
+class rendering_connection;
+
+struct rendering_converter final {
+    rendering_converter(audio::format const &source_format, audio::format const &destination_format,
+                        uint32_t const frame_capacity);
+
+    audio::format const source_format;
+    audio::format const destination_format;
+
+    [[nodiscard]] uint32_t frame_capacity() const;
+
+    bool pull(pcm_buffer *const destination, audio::time const &, rendering_connection const &source);
+    bool push(pcm_buffer const &source, pcm_buffer *const destination);
+
+    [[nodiscard]] static bool is_convertible(audio::format const &source_format,
+                                             audio::format const &destination_format);
+
+   private:
+    uint32_t const _frame_capacity;
+    uint32_t const _source_frame_capacity;
+    std::optional<dsp::resampler> _resampler;
+    pcm_buffer _source_buffer;
+    std::vector<std::vector<float>> _source_data;
+    std::vector<std::vector<float>> _destination_data;
+    std::vector<float const *> _mapped_ptrs;
+    std::vector<float *> _destination_ptrs;
+    std::optional<int64_t> _source_sample_time = std::nullopt;
+
+    void _read_source(pcm_buffer const &source, uint32_t const length);
+    void _write_destination(pcm_buffer *const destination, uint32_t const length);
+
+    rendering_converter(rendering_converter const &) = delete;
+    rendering_converter(rendering_converter &&) = delete;
+    rendering_converter &operator=(rendering_converter const &) = delete;
+    rendering_converter &operator=(rendering_converter &&) = delete;
+};
+}  // namespace yas::audio
@@ -8,6 +8,8 @@
 #include <audio/yas_audio_graph_node.h>
 #include <cpp_utils/yas_stl_utils.h>
 
+#include "yas_audio_rendering_converter.h"
+
 using namespace yas;
 using namespace yas::audio;
 
@@ -49,7 +51,19 @@ std::vector<std::unique_ptr<rendering_node>> make_rendering_nodes(renderable_gra
     return result;
 }
 
-std::unique_ptr<rendering_output_node> make_rendering_output_node(renderable_graph_node_ptr const &output_node) {
+std::shared_ptr<rendering_converter> make_rendering_converter(std::optional<audio::format> const &source_format,
+                                                              std::optional<audio::format> const &destination_format,
+                                                              uint32_t const frame_capacity) {
+    if (!source_format || !destination_format || *source_format == *destination_format ||
+        !rendering_converter::is_convertible(*source_format, *destination_format)) {
+        return nullptr;
+    }
+
+    return std::make_shared<rendering_converter>(*source_format, *destination_format, frame_capacity);
+}
+
+std::unique_ptr<rendering_output_node> make_rendering_output_node(renderable_graph_node_ptr const &output_node,
+                                                                  rendering_graph_args const &args) {
     if (output_node->input_connections().empty()) {
         return nullptr;
     }
@@ -69,11 +83,15 @@ std::unique_ptr<rendering_output_node> make_rendering_output_node(renderable_gra
         return nullptr;
     }
 
+    auto const converter = make_rendering_converter(connection->format(), args.output_format, args.frame_capacity);
+    rendering_node const *const source_node = nodes.at(0).get();
+
     return std::make_unique<rendering_output_node>(
-        std::move(nodes), rendering_connection{connection->source_bus(), nodes.at(0).get(), connection->format()});
+        std::move(nodes), rendering_connection{connection->source_bus(), source_node, connection->format(), converter});
 }
 
-std::unique_ptr<rendering_input_node> make_rendering_input_node(renderable_graph_node_ptr const &input_node) {
+std::unique_ptr<rendering_input_node> make_rendering_input_node(renderable_graph_node_ptr const &input_node,
+                                                                rendering_graph_args const &args) {
     if (input_node->output_connections().empty()) {
         return nullptr;
     }
@@ -89,7 +107,8 @@ std::unique_ptr<rendering_input_node> make_rendering_input_node(renderable_graph
 
     if (dst_node->is_input_renderable()) {
         dst_node->prepare_rendering();
-        return std::make_unique<rendering_input_node>(connection->format(), dst_node->render_handler());
+        auto const converter = make_rendering_converter(args.input_format, connection->format(), args.frame_capacity);
+        return std::make_unique<rendering_input_node>(connection->format(), dst_node->render_handler(), converter);
     } else {
         return nullptr;
     }
@@ -97,8 +116,9 @@ std::unique_ptr<rendering_input_node> make_rendering_input_node(renderable_graph
 }  // namespace yas::audio
 
 rendering_graph::rendering_graph(renderable_graph_node_ptr const &output_node,
-                                 renderable_graph_node_ptr const &input_node)
-    : _output_node(make_rendering_output_node(output_node)), _input_node(make_rendering_input_node(input_node)) {
+                                 renderable_graph_node_ptr const &input_node, rendering_graph_args const &args)
+    : _output_node(make_rendering_output_node(output_node, args)),
+      _input_node(make_rendering_input_node(input_node, args)) {
 }
 
 rendering_output_node const *rendering_graph::output_node() const {
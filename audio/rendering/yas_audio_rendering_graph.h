@@ -8,10 +8,18 @@
 #include <audio/yas_audio_rendering_node.h>
 
 #include <memory>
+#include <optional>
 
 namespace yas::audio {
+struct rendering_graph_args {
+    std::optional<audio::format> output_format = std::nullopt;
+    std::optional<audio::format> input_format = std::nullopt;
+    uint32_t frame_capacity = 4096;
+};
+
 struct rendering_graph {
-    rendering_graph(renderable_graph_node_ptr const &output_node, renderable_graph_node_ptr const &input_node);
+    rendering_graph(renderable_graph_node_ptr const &output_node, renderable_graph_node_ptr const &input_node,
+                    rendering_graph_args const &args = {});
 
     [[nodiscard]] rendering_output_node const *output_node() const;
     [[nodiscard]] rendering_input_node const *input_node() const;
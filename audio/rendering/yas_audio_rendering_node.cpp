@@ -4,7 +4,10 @@
 
 #include "yas_audio_rendering_node.h"
 
+#include <cmath>
+
 #include "yas_audio_rendering_connection.h"
+#include "yas_audio_rendering_converter.h"
 
 using namespace yas;
 using namespace yas::audio;
@@ -54,8 +57,12 @@ bool rendering_output_node::render(pcm_buffer *const buffer, time const &time) c
 
 #pragma mark - rendering_input_node
 
-rendering_input_node::rendering_input_node(audio::format const &format, node_render_f const &handler)
-    : format(format), _render_handler(handler) {
+rendering_input_node::rendering_input_node(audio::format const &format, node_render_f const &handler,
+                                           std::shared_ptr<rendering_converter> const &converter)
+    : format(format),
+      converter(converter),
+      _render_handler(handler),
+      _converted_buffer(converter ? std::make_unique<pcm_buffer>(format, converter->frame_capacity()) : nullptr) {
 }
 
 bool rendering_input_node::render(pcm_buffer *const buffer, time const &time) const {
@@ -64,7 +71,24 @@ bool rendering_input_node::render(pcm_buffer *const buffer, time const &time) co
     }
 
     if (this->format != buffer->format()) {
-        return false;
+        if (!this->converter || this->converter->source_format != buffer->format()) {
+            return false;
+        }
+
+        pcm_buffer *const converted_buffer = this->_converted_buffer.get();
+
+        if (!this->converter->push(*buffer, converted_buffer)) {
+            return false;
+        }
+
+        double const rate = this->format.sample_rate() / buffer->format().sample_rate();
+        audio::time const converted_time{std::llround(static_cast<double>(time.sample_time()) * rate),
+                                         this->format.sample_rate()};
+
+        this->_render_handler(
+            {.buffer = converted_buffer, .bus_idx = 0, .time = converted_time, .source_connections = {}});
+
+        return true;
     }
 
     this->_render_handler({.buffer = buffer, .bus_idx = 0, .time = time, .source_connections = {}});
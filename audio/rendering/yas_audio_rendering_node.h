@@ -40,9 +40,11 @@ struct rendering_output_node {
 };
 
 struct rendering_input_node {
-    rendering_input_node(audio::format const &, node_render_f const &);
+    rendering_input_node(audio::format const &, node_render_f const &,
+                         std::shared_ptr<rendering_converter> const &converter = nullptr);
 
     audio::format const format;
+    std::shared_ptr<rendering_converter> const converter;
 
     bool render(pcm_buffer *const, audio::time const &) const;
 
@@ -53,5 +55,6 @@ struct rendering_input_node {
     rendering_input_node &operator=(rendering_input_node &&) = delete;
 
     node_render_f _render_handler;
+    std::unique_ptr<pcm_buffer> const _converted_buffer;
 };
 }  // namespace yas::audio
@@ -0,0 +1,43 @@
+//
+//  yas_audio_shared_memory_device.cpp
+//
+
+#include "yas_audio_shared_memory_device.h"
+
+#include "yas_audio_shared_memory_io_core.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+shared_memory_device::shared_memory_device(shared_memory_ring_ptr const &ring) : _ring(ring) {
+}
+
+std::optional<format> shared_memory_device::input_format() const {
+    return this->_ring->format();
+}
+
+std::optional<format> shared_memory_device::output_format() const {
+    return std::nullopt;
+}
+
+io_core_ptr shared_memory_device::make_io_core() const {
+    return shared_memory_io_core::make_shared(this->_ring);
+}
+
+std::optional<interruptor_ptr> const &shared_memory_device::interruptor() const {
+    static std::optional<interruptor_ptr> const _null_interruptor = std::nullopt;
+    return _null_interruptor;
+}
+
+observing::endable shared_memory_device::observe_io_device(
+    observing::caller<io_device::method>::handler_f &&handler) {
+    return this->_notifier->observe(std::move(handler));
+}
+
+shared_memory_ring_ptr const &shared_memory_device::ring() const {
+    return this->_ring;
+}
+
+shared_memory_device_ptr shared_memory_device::make_shared(shared_memory_ring_ptr const &ring) {
+    return shared_memory_device_ptr{new shared_memory_device{ring}};
+}
@@ -0,0 +1,33 @@
+//
+//  yas_audio_shared_memory_device.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_io_device.h>
+#include <audio/yas_audio_shared_memory_ring.h>
+
+namespace yas::audio {
+// an input device that reads the frames another process writes to a shared_memory_ring.
+struct shared_memory_device : io_device {
+    [[nodiscard]] std::optional<audio::format> input_format() const override;
+    [[nodiscard]] std::optional<audio::format> output_format() const override;
+
+    [[nodiscard]] io_core_ptr make_io_core() const override;
+
+    [[nodiscard]] std::optional<interruptor_ptr> const &interruptor() const override;
+
+    [[nodiscard]] observing::endable observe_io_device(observing::caller<io_device::method>::handler_f &&) override;
+
+    [[nodiscard]] shared_memory_ring_ptr const &ring() const;
+
+    [[nodiscard]] static shared_memory_device_ptr make_shared(shared_memory_ring_ptr const &);
+
+   private:
+    shared_memory_ring_ptr const _ring;
+
+    observing::notifier_ptr<io_device::method> const _notifier = observing::notifier<io_device::method>::make_shared();
+
+    shared_memory_device(shared_memory_ring_ptr const &);
+};
+}  // namespace yas::audio
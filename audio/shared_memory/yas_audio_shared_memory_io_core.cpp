@@ -0,0 +1,120 @@
+//
+//  yas_audio_shared_memory_io_core.cpp
+//
+
+#include "yas_audio_shared_memory_io_core.h"
+
+#include <future>
+
+#include "yas_audio_shared_memory_ring.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+shared_memory_io_core::shared_memory_io_core(shared_memory_ring_ptr const &ring) : _ring(ring) {
+}
+
+shared_memory_io_core::~shared_memory_io_core() {
+    this->stop();
+}
+
+void shared_memory_io_core::set_render_handler(std::optional<io_render_f> handler) {
+    this->_render_handler = std::move(handler);
+}
+
+void shared_memory_io_core::set_maximum_frames_per_slice(uint32_t const frames) {
+    this->_maximum_frames = frames;
+}
+
+bool shared_memory_io_core::start() {
+    if (this->_thread) {
+        return false;
+    }
+
+    auto kernel = this->_make_kernel();
+
+    if (!kernel) {
+        return false;
+    }
+
+    if (this->_render_thread_policy.prefaults_buffers) {
+        kernel->prefault_buffers();
+    }
+
+    this->_is_cancelled = false;
+
+    std::promise<std::vector<render_thread_policy::error_t>> applied;
+    auto applied_future = applied.get_future();
+
+    this->_thread = std::thread{[kernel = std::move(kernel), ring = this->_ring, &is_cancelled = this->_is_cancelled,
+                                 policy = this->_render_thread_policy, applied = std::move(applied)]() mutable {
+        // applied before the first slice not to render without the policy.
+        applied.set_value(policy.apply(pthread_self()));
+
+        if (policy.prefaults_buffers) {
+            prefault_thread_stack();
+        }
+
+        auto const &input_buffer = kernel->input_buffer;
+        double const sample_rate = input_buffer->format().sample_rate();
+        int64_t sample_time = 0;
+
+        while (!is_cancelled) {
+            // renders the frames as soon as they are written not to add the latency of a full slice.
+            if (!ring->wait_readable(1)) {
+                continue;
+            }
+
+            kernel->reset_buffers();
+
+            if (!ring->read(*input_buffer)) {
+                break;
+            }
+
+            // counts the read frames when the writer does not send times.
+            kernel->input_time = ring->read_time().value_or(time{sample_time, sample_rate});
+            sample_time += input_buffer->frame_length();
+
+            kernel->render_handler({.output_buffer = nullptr,
+                                    .output_time = null_time_opt,
+                                    .input_buffer = input_buffer.get(),
+                                    .input_time = kernel->input_time});
+        }
+    }};
+
+    this->_render_thread_policy_errors = applied_future.get();
+
+    return true;
+}
+
+void shared_memory_io_core::stop() {
+    if (auto &thread = this->_thread) {
+        this->_is_cancelled = true;
+        this->_ring->interrupt_wait();
+
+        thread->join();
+
+        this->_thread = std::nullopt;
+    }
+}
+
+void shared_memory_io_core::set_render_thread_policy(render_thread_policy const &policy) {
+    this->_render_thread_policy = policy;
+}
+
+std::vector<render_thread_policy::error_t> shared_memory_io_core::render_thread_policy_errors() const {
+    return this->_render_thread_policy_errors;
+}
+
+io_kernel_ptr shared_memory_io_core::_make_kernel() const {
+    if (!this->_render_handler) {
+        return nullptr;
+    }
+
+    return io_kernel::make_shared(this->_render_handler.value(), this->_ring->format(), std::nullopt,
+                                  this->_maximum_frames);
+}
+
+shared_memory_io_core_ptr shared_memory_io_core::make_shared(shared_memory_ring_ptr const &ring) {
+    return shared_memory_io_core_ptr{new shared_memory_io_core{ring}};
+}
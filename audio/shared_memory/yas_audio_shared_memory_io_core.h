@@ -0,0 +1,41 @@
+//
+//  yas_audio_shared_memory_io_core.h
+//
+
+#pragma once
+
+#include "yas_audio_io_core.h"
+
+#include <atomic>
+#include <thread>
+
+namespace yas::audio {
+struct shared_memory_io_core : io_core {
+    ~shared_memory_io_core();
+
+    void set_render_handler(std::optional<io_render_f>) override;
+    void set_maximum_frames_per_slice(uint32_t const) override;
+
+    [[nodiscard]] bool start() override;
+    void stop() override;
+
+    void set_render_thread_policy(render_thread_policy const &) override;
+    [[nodiscard]] std::vector<render_thread_policy::error_t> render_thread_policy_errors() const override;
+
+    static shared_memory_io_core_ptr make_shared(shared_memory_ring_ptr const &);
+
+   private:
+    shared_memory_ring_ptr const _ring;
+    std::optional<std::thread> _thread = std::nullopt;
+    std::atomic<bool> _is_cancelled{false};
+
+    std::optional<io_render_f> _render_handler = std::nullopt;
+    uint32_t _maximum_frames = 4096;
+    render_thread_policy _render_thread_policy;
+    std::vector<render_thread_policy::error_t> _render_thread_policy_errors;
+
+    shared_memory_io_core(shared_memory_ring_ptr const &);
+
+    io_kernel_ptr _make_kernel() const;
+};
+}  // namespace yas::audio
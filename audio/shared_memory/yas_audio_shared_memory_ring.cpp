@@ -0,0 +1,479 @@
+//
+//  yas_audio_shared_memory_ring.cpp
+//
+
+#include "yas_audio_shared_memory_ring.h"
+
+#include <cpp_utils/yas_result.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <new>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::shared_memory_ring_utils {
+static uint32_t constexpr magic = 0x79617372;
+static std::size_t constexpr cache_line_size = 128;
+static uint32_t constexpr time_record_count = 256;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+enum time_flag : uint32_t {
+    sample_time_valid = 1 << 0,
+    host_time_valid = 1 << 1,
+};
+
+struct time_record {
+    uint64_t frame;
+    int64_t sample_time;
+    uint64_t host_time;
+    uint32_t flags;
+};
+
+static std::optional<audio::time> to_time(uint32_t const flags, uint64_t const host_time, int64_t const sample_time,
+                                          double const sample_rate) {
+    bool const is_sample_time_valid = flags & sample_time_valid;
+    bool const is_host_time_valid = flags & host_time_valid;
+
+    if (is_sample_time_valid && is_host_time_valid) {
+        return audio::time{host_time, sample_time, sample_rate};
+    } else if (is_sample_time_valid) {
+        return audio::time{sample_time, sample_rate};
+    } else if (is_host_time_valid) {
+        return audio::time{host_time};
+    } else {
+        return std::nullopt;
+    }
+}
+
+static std::string shared_memory_name(std::string const &name) {
+    return "/" + name;
+}
+
+static std::string semaphore_name(std::string const &name) {
+    return "/" + name + "_s";
+}
+
+static bool is_valid_name(std::string const &name) {
+    return !name.empty() && name.size() <= shared_memory_ring::max_name_length &&
+           name.find('/') == std::string::npos;
+}
+
+static uint32_t frame_capacity(uint32_t const frame_capacity) {
+    uint32_t result = 1;
+    while (result < frame_capacity) {
+        result <<= 1;
+    }
+    return result;
+}
+}  // namespace yas::audio::shared_memory_ring_utils
+
+// lives at the top of the shared memory. the samples follow it, laid out as the buffers of the format.
+struct shared_memory_ring::header {
+    std::atomic<uint32_t> magic;
+    uint32_t frame_capacity;
+    AudioStreamBasicDescription stream_description;
+
+    alignas(shared_memory_ring_utils::cache_line_size) std::atomic<uint64_t> write_frame;
+    std::atomic<uint64_t> time_write_index;
+
+    alignas(shared_memory_ring_utils::cache_line_size) std::atomic<uint64_t> read_frame;
+    std::atomic<uint64_t> time_read_index;
+    std::atomic<uint32_t> is_reader_waiting;
+
+    alignas(shared_memory_ring_utils::cache_line_size) shared_memory_ring_utils::time_record
+        time_records[shared_memory_ring_utils::time_record_count];
+
+    static std::size_t data_offset() {
+        std::size_t const line = shared_memory_ring_utils::cache_line_size;
+        return (sizeof(header) + line - 1) / line * line;
+    }
+
+    static std::size_t buffer_byte_count(AudioStreamBasicDescription const &asbd, uint32_t const frame_capacity) {
+        return static_cast<std::size_t>(frame_capacity) * asbd.mBytesPerFrame;
+    }
+
+    uint8_t *data() {
+        return reinterpret_cast<uint8_t *>(this) + data_offset();
+    }
+};
+
+struct shared_memory_ring::mapping {
+    shared_memory_ring::header *memory;
+    std::size_t byte_count;
+    sem_t *semaphore;
+    bool is_creator;
+};
+
+shared_memory_ring::shared_memory_ring(std::string const &name, audio::format const &format, mapping &&mapping)
+    : _name(name),
+      _is_creator(mapping.is_creator),
+      _header(mapping.memory),
+      _byte_count(mapping.byte_count),
+      _semaphore(mapping.semaphore),
+      _abl(allocate_audio_buffer_list(format.buffer_count(), format.stride(), 0).first),
+      _buffer(format, [this, &format] {
+          std::size_t const buffer_byte_count =
+              header::buffer_byte_count(format.stream_description(), this->_header->frame_capacity);
+          for (uint32_t buf_idx = 0; buf_idx < this->_abl->mNumberBuffers; ++buf_idx) {
+              this->_abl->mBuffers[buf_idx].mData = this->_header->data() + buffer_byte_count * buf_idx;
+              this->_abl->mBuffers[buf_idx].mDataByteSize = static_cast<uint32_t>(buffer_byte_count);
+          }
+          return this->_abl.get();
+      }()),
+      _mask(this->_header->frame_capacity - 1) {
+}
+
+shared_memory_ring::~shared_memory_ring() {
+    munmap(this->_header, this->_byte_count);
+    sem_close(this->_semaphore);
+
+    if (this->_is_creator) {
+        shm_unlink(shared_memory_ring_utils::shared_memory_name(this->_name).c_str());
+        sem_unlink(shared_memory_ring_utils::semaphore_name(this->_name).c_str());
+    }
+}
+
+std::string const &shared_memory_ring::name() const {
+    return this->_name;
+}
+
+audio::format const &shared_memory_ring::format() const {
+    return this->_buffer.format();
+}
+
+uint32_t shared_memory_ring::frame_capacity() const {
+    return this->_buffer.frame_capacity();
+}
+
+uint32_t shared_memory_ring::readable_frame_length() const {
+    uint64_t const read_frame = this->_header->read_frame.load(std::memory_order_acquire);
+    return static_cast<uint32_t>(this->_header->write_frame.load(std::memory_order_acquire) - read_frame);
+}
+
+uint32_t shared_memory_ring::writable_frame_length() const {
+    return this->frame_capacity() - this->readable_frame_length();
+}
+
+pcm_buffer::copy_result shared_memory_ring::write(pcm_buffer const &buffer, std::optional<audio::time> const &time) {
+    if (buffer.format().channel_count() != this->format().channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    header &header = *this->_header;
+    uint32_t const capacity = this->frame_capacity();
+    uint64_t const write_frame = header.write_frame.load(std::memory_order_relaxed);
+    uint32_t const frame_length = buffer.frame_length();
+
+    if (capacity - (write_frame - this->_cached_read_frame) < frame_length) {
+        this->_cached_read_frame = header.read_frame.load(std::memory_order_acquire);
+    }
+
+    uint32_t const length =
+        std::min(frame_length, static_cast<uint32_t>(capacity - (write_frame - this->_cached_read_frame)));
+
+    if (length == 0) {
+        return pcm_buffer::copy_result(0);
+    }
+
+    // the time is dropped when the records are full. the reader then counts frames from the previous one.
+    if (time.has_value()) {
+        uint64_t const time_write_index = header.time_write_index.load(std::memory_order_relaxed);
+        if (time_write_index - header.time_read_index.load(std::memory_order_acquire) <
+            shared_memory_ring_utils::time_record_count) {
+            auto const &time_value = time.value();
+            header.time_records[time_write_index % shared_memory_ring_utils::time_record_count] = {
+                .frame = write_frame,
+                .sample_time = time_value.is_sample_time_valid() ? time_value.sample_time() : 0,
+                .host_time = time_value.is_host_time_valid() ? time_value.host_time() : 0,
+                .flags = (time_value.is_sample_time_valid() ? shared_memory_ring_utils::sample_time_valid : 0u) |
+                         (time_value.is_host_time_valid() ? shared_memory_ring_utils::host_time_valid : 0u)};
+            header.time_write_index.store(time_write_index + 1, std::memory_order_release);
+        }
+    }
+
+    uint32_t const begin = static_cast<uint32_t>(write_frame) & this->_mask;
+    uint32_t const head_length = std::min(length, capacity - begin);
+
+    if (auto result = this->_buffer.copy_from(buffer, {.to_begin_frame = begin, .length = head_length}); !result) {
+        return result;
+    }
+
+    if (head_length < length) {
+        if (auto result = this->_buffer.copy_from(
+                buffer, {.from_begin_frame = head_length, .to_begin_frame = 0, .length = length - head_length});
+            !result) {
+            return result;
+        }
+    }
+
+    header.write_frame.store(write_frame + length, std::memory_order_release);
+
+    // pairs with the fence in wait_readable so that either the reader sees the frames or the writer sees it waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (header.is_reader_waiting.exchange(0, std::memory_order_relaxed)) {
+        sem_post(this->_semaphore);
+    }
+
+    return pcm_buffer::copy_result(length);
+}
+
+pcm_buffer::copy_result shared_memory_ring::read(pcm_buffer &buffer) {
+    if (buffer.format().channel_count() != this->format().channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    header &header = *this->_header;
+    uint32_t const capacity = this->frame_capacity();
+    uint64_t const read_frame = header.read_frame.load(std::memory_order_relaxed);
+    uint32_t const frame_capacity = buffer.frame_capacity();
+
+    if (this->_cached_write_frame - read_frame < frame_capacity) {
+        this->_cached_write_frame = header.write_frame.load(std::memory_order_acquire);
+    }
+
+    uint32_t const length = std::min(frame_capacity, static_cast<uint32_t>(this->_cached_write_frame - read_frame));
+
+    buffer.set_frame_length(length);
+
+    if (length == 0) {
+        return pcm_buffer::copy_result(0);
+    }
+
+    this->_update_anchor_time(read_frame);
+
+    uint32_t const begin = static_cast<uint32_t>(read_frame) & this->_mask;
+    uint32_t const head_length = std::min(length, capacity - begin);
+
+    if (auto result = buffer.copy_from(this->_buffer, {.from_begin_frame = begin, .length = head_length}); !result) {
+        return result;
+    }
+
+    if (head_length < length) {
+        if (auto result = buffer.copy_from(
+                this->_buffer, {.from_begin_frame = 0, .to_begin_frame = head_length, .length = length - head_length});
+            !result) {
+            return result;
+        }
+    }
+
+    header.read_frame.store(read_frame + length, std::memory_order_release);
+
+    return pcm_buffer::copy_result(length);
+}
+
+std::optional<audio::time> const &shared_memory_ring::read_time() const {
+    return this->_read_time;
+}
+
+bool shared_memory_ring::wait_readable(uint32_t const frame_length) {
+    header &header = *this->_header;
+    uint32_t const length = std::min(frame_length, this->frame_capacity());
+
+    while (true) {
+        if (this->_is_wait_interrupted.exchange(false)) {
+            return false;
+        }
+
+        if (this->readable_frame_length() >= length) {
+            return true;
+        }
+
+        header.is_reader_waiting.store(1, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (this->readable_frame_length() >= length) {
+            header.is_reader_waiting.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        while (sem_wait(this->_semaphore) != 0 && errno == EINTR) {
+        }
+    }
+}
+
+void shared_memory_ring::interrupt_wait() {
+    this->_is_wait_interrupted = true;
+    sem_post(this->_semaphore);
+}
+
+void shared_memory_ring::_update_anchor_time(uint64_t const read_frame) {
+    header &header = *this->_header;
+    uint64_t time_read_index = header.time_read_index.load(std::memory_order_relaxed);
+    uint64_t const time_write_index = header.time_write_index.load(std::memory_order_acquire);
+    double const sample_rate = this->format().sample_rate();
+
+    while (time_read_index < time_write_index) {
+        auto const &record = header.time_records[time_read_index % shared_memory_ring_utils::time_record_count];
+        if (record.frame > read_frame) {
+            break;
+        }
+
+        this->_anchor_time = shared_memory_ring_utils::to_time(record.flags, record.host_time, record.sample_time,
+                                                              sample_rate);
+        this->_anchor_frame = record.frame;
+
+        ++time_read_index;
+    }
+
+    header.time_read_index.store(time_read_index, std::memory_order_release);
+
+    if (auto const &anchor_time = this->_anchor_time) {
+        uint64_t const offset = read_frame - this->_anchor_frame;
+        uint32_t const flags =
+            (anchor_time->is_sample_time_valid() ? shared_memory_ring_utils::sample_time_valid : 0u) |
+            (anchor_time->is_host_time_valid() ? shared_memory_ring_utils::host_time_valid : 0u);
+        this->_read_time = shared_memory_ring_utils::to_time(
+            flags, anchor_time->host_time() + host_time_for_seconds(static_cast<double>(offset) / sample_rate),
+            anchor_time->sample_time() + static_cast<int64_t>(offset), sample_rate);
+    } else {
+        this->_read_time = std::nullopt;
+    }
+}
+
+shared_memory_ring::make_created_result_t shared_memory_ring::make_created(create_args args) {
+    if (!shared_memory_ring_utils::is_valid_name(args.name) || args.frame_capacity == 0 ||
+        args.frame_capacity > (1u << 31) || args.format.is_broken()) {
+        return make_created_result_t{create_error_t::invalid_argument};
+    }
+
+    uint32_t const frame_capacity = shared_memory_ring_utils::frame_capacity(args.frame_capacity);
+    auto const &asbd = args.format.stream_description();
+    std::size_t const byte_count =
+        header::data_offset() + header::buffer_byte_count(asbd, frame_capacity) * args.format.buffer_count();
+
+    auto const shm_name = shared_memory_ring_utils::shared_memory_name(args.name);
+    auto const sem_name = shared_memory_ring_utils::semaphore_name(args.name);
+
+    // fails if the name exists unless replaced not to take over the ring of another writer.
+    if (args.replaces_existing) {
+        shm_unlink(shm_name.c_str());
+        sem_unlink(sem_name.c_str());
+    }
+
+    int const fd = shm_open(shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return make_created_result_t{create_error_t::create_failed};
+    }
+
+    void *memory = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(byte_count)) == 0) {
+        memory = mmap(nullptr, byte_count, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (memory == MAP_FAILED) {
+        shm_unlink(shm_name.c_str());
+        return make_created_result_t{create_error_t::create_failed};
+    }
+
+    sem_t *const semaphore = sem_open(sem_name.c_str(), O_CREAT | O_EXCL, S_IRUSR | S_IWUSR, 0);
+    if (semaphore == SEM_FAILED) {
+        munmap(memory, byte_count);
+        shm_unlink(shm_name.c_str());
+        return make_created_result_t{create_error_t::create_failed};
+    }
+
+    auto *const memory_header = new (memory) header{};
+    memory_header->frame_capacity = frame_capacity;
+    memory_header->stream_description = asbd;
+    memory_header->magic.store(shared_memory_ring_utils::magic, std::memory_order_release);
+
+    return make_created_result_t{shared_memory_ring_ptr{new shared_memory_ring{
+        args.name, args.format,
+        {.memory = memory_header, .byte_count = byte_count, .semaphore = semaphore, .is_creator = true}}}};
+}
+
+shared_memory_ring::make_opened_result_t shared_memory_ring::make_opened(open_args args) {
+    if (!shared_memory_ring_utils::is_valid_name(args.name)) {
+        return make_opened_result_t{open_error_t::invalid_argument};
+    }
+
+    int const fd = shm_open(shared_memory_ring_utils::shared_memory_name(args.name).c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        return make_opened_result_t{open_error_t::open_failed};
+    }
+
+    struct stat file_stat;
+    void *memory = MAP_FAILED;
+    std::size_t byte_count = 0;
+    if (fstat(fd, &file_stat) == 0 && static_cast<std::size_t>(file_stat.st_size) >= header::data_offset()) {
+        byte_count = static_cast<std::size_t>(file_stat.st_size);
+        memory = mmap(nullptr, byte_count, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (memory == MAP_FAILED) {
+        return make_opened_result_t{open_error_t::open_failed};
+    }
+
+    auto *const memory_header = static_cast<header *>(memory);
+    uint32_t const frame_capacity = memory_header->frame_capacity;
+
+    if (memory_header->magic.load(std::memory_order_acquire) != shared_memory_ring_utils::magic ||
+        frame_capacity == 0 || (frame_capacity & (frame_capacity - 1)) != 0) {
+        munmap(memory, byte_count);
+        return make_opened_result_t{open_error_t::invalid_memory};
+    }
+
+    audio::format const format{memory_header->stream_description};
+    std::size_t const required_byte_count =
+        header::data_offset() +
+        header::buffer_byte_count(memory_header->stream_description, frame_capacity) * format.buffer_count();
+
+    if (format.is_broken() || byte_count < required_byte_count) {
+        munmap(memory, byte_count);
+        return make_opened_result_t{open_error_t::invalid_memory};
+    }
+
+    sem_t *const semaphore = sem_open(shared_memory_ring_utils::semaphore_name(args.name).c_str(), 0);
+    if (semaphore == SEM_FAILED) {
+        munmap(memory, byte_count);
+        return make_opened_result_t{open_error_t::open_failed};
+    }
+
+    auto ring = shared_memory_ring_ptr{new shared_memory_ring{
+        args.name, format,
+        {.memory = memory_header, .byte_count = byte_count, .semaphore = semaphore, .is_creator = false}}};
+    ring->_cached_write_frame = memory_header->write_frame.load(std::memory_order_acquire);
+    return make_opened_result_t{std::move(ring)};
+}
+
+std::string yas::to_string(shared_memory_ring::create_error_t const &error) {
+    switch (error) {
+        case shared_memory_ring::create_error_t::invalid_argument:
+            return "invalid_argument";
+        case shared_memory_ring::create_error_t::create_failed:
+            return "create_failed";
+    }
+}
+
+std::string yas::to_string(shared_memory_ring::open_error_t const &error) {
+    switch (error) {
+        case shared_memory_ring::open_error_t::invalid_argument:
+            return "invalid_argument";
+        case shared_memory_ring::open_error_t::open_failed:
+            return "open_failed";
+        case shared_memory_ring::open_error_t::invalid_memory:
+            return "invalid_memory";
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, yas::audio::shared_memory_ring::create_error_t const &value) {
+    os << to_string(value);
+    return os;
+}
+
+std::ostream &operator<<(std::ostream &os, yas::audio::shared_memory_ring::open_error_t const &value) {
+    os << to_string(value);
+    return os;
+}
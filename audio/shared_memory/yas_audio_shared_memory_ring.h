@@ -0,0 +1,114 @@
+//
+//  yas_audio_shared_memory_ring.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+#include <audio/yas_audio_time.h>
+#include <semaphore.h>
+
+#include <atomic>
+#include <ostream>
+#include <string>
+
+namespace yas {
+template <typename T, typename U>
+class result;
+}
+
+namespace yas::audio {
+// a pcm_ring_buffer placed in posix shared memory. one process creates it and writes, another opens it and reads.
+struct shared_memory_ring final {
+    struct create_args {
+        std::string name;
+        audio::format format;
+        uint32_t frame_capacity;
+        // removes the ring of the name left by a writer that did not exit cleanly. a live ring is replaced too.
+        bool replaces_existing = false;
+    };
+
+    struct open_args {
+        std::string name;
+    };
+
+    enum class create_error_t : uint32_t {
+        invalid_argument,
+        create_failed,
+    };
+
+    enum class open_error_t : uint32_t {
+        invalid_argument,
+        open_failed,
+        invalid_memory,
+    };
+
+    using make_created_result_t = result<audio::shared_memory_ring_ptr, create_error_t>;
+    using make_opened_result_t = result<audio::shared_memory_ring_ptr, open_error_t>;
+
+    static std::size_t constexpr max_name_length = 24;
+
+    ~shared_memory_ring();
+
+    [[nodiscard]] std::string const &name() const;
+    [[nodiscard]] audio::format const &format() const;
+    [[nodiscard]] uint32_t frame_capacity() const;
+
+    [[nodiscard]] uint32_t readable_frame_length() const;
+    [[nodiscard]] uint32_t writable_frame_length() const;
+
+    // writer process. the time is of the first frame of the buffer.
+    pcm_buffer::copy_result write(pcm_buffer const &, std::optional<audio::time> const &time = std::nullopt);
+
+    // reader process. reads up to the frame capacity of the buffer and sets its frame length to the read length.
+    pcm_buffer::copy_result read(pcm_buffer &);
+    // the time of the first frame of the last read. derived from the nearest time written before it.
+    [[nodiscard]] std::optional<audio::time> const &read_time() const;
+
+    // reader process. blocks until the frames are readable. returns false when interrupted.
+    bool wait_readable(uint32_t const frame_length);
+    void interrupt_wait();
+
+    [[nodiscard]] static make_created_result_t make_created(create_args);
+    [[nodiscard]] static make_opened_result_t make_opened(open_args);
+
+   private:
+    struct header;
+    struct mapping;
+
+    std::string const _name;
+    bool const _is_creator;
+    header *const _header;
+    std::size_t const _byte_count;
+    sem_t *const _semaphore;
+    abl_uptr const _abl;
+    pcm_buffer _buffer;
+    uint32_t const _mask;
+
+    uint64_t _cached_read_frame = 0;
+    uint64_t _cached_write_frame = 0;
+    std::optional<audio::time> _anchor_time = std::nullopt;
+    uint64_t _anchor_frame = 0;
+    std::optional<audio::time> _read_time = std::nullopt;
+    std::atomic<bool> _is_wait_interrupted{false};
+
+    shared_memory_ring(std::string const &name, audio::format const &, mapping &&);
+
+    void _update_anchor_time(uint64_t const read_frame);
+
+    shared_memory_ring(shared_memory_ring const &) = delete;
+    shared_memory_ring(shared_memory_ring &&) = delete;
+    shared_memory_ring &operator=(shared_memory_ring const &) = delete;
+    shared_memory_ring &operator=(shared_memory_ring &&) = delete;
+};
+}  // namespace yas::audio
+
+namespace yas {
+std::string to_string(audio::shared_memory_ring::create_error_t const &);
+std::string to_string(audio::shared_memory_ring::open_error_t const &);
+}  // namespace yas
+
+std::ostream &operator<<(std::ostream &, yas::audio::shared_memory_ring::create_error_t const &);
+std::ostream &operator<<(std::ostream &, yas::audio::shared_memory_ring::open_error_t const &);
@@ -0,0 +1,51 @@
+//
+//  yas_audio_each_block.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_types.h>
+
+#include <type_traits>
+
+namespace yas::audio {
+class pcm_buffer;
+
+// walks the channels of a pcm_buffer in runs of frames without allocation.
+// the runs of a channel start at multiples of block_length, which is rounded up to the simd width.
+// a block_length of 0 hands out each channel as a single run.
+template <typename T>
+struct each_block final {
+    each_block(AudioBuffer const *const buffers, uint32_t const channel_count, uint32_t const stride,
+               uint32_t const frame_length, uint32_t const block_length) noexcept;
+
+    bool next() noexcept;
+
+    [[nodiscard]] T *data() const noexcept;
+    [[nodiscard]] uint32_t length() const noexcept;
+    [[nodiscard]] uint32_t stride() const noexcept;
+    [[nodiscard]] uint32_t channel() const noexcept;
+    [[nodiscard]] uint32_t frame() const noexcept;
+
+   private:
+    AudioBuffer const *_buffers;
+    uint32_t _channel_count;
+    uint32_t _stride;
+    uint32_t _frame_length;
+    uint32_t _block_length;
+
+    T *_channel_data = nullptr;
+    uint32_t _ch_idx = 0;
+    uint32_t _frame_idx = 0;
+    uint32_t _length = 0;
+    bool _is_first = true;
+};
+
+template <typename T>
+each_block<T> make_each_block(pcm_buffer &buffer, uint32_t const block_length = 0);
+
+template <typename T>
+each_block<T const> make_each_block(pcm_buffer const &buffer, uint32_t const block_length = 0);
+}  // namespace yas::audio
+
+#include <audio/yas_audio_each_block_private.h>
@@ -0,0 +1,117 @@
+//
+//  yas_audio_each_block_private.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_pcm_span.h>
+#include <audio/yas_audio_simd.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace yas::audio::each_block_utils {
+static uint32_t constexpr round_up_block_length(uint32_t const block_length, uint32_t const frame_length) {
+    if (block_length == 0) {
+        return std::max(frame_length, uint32_t(1));
+    }
+
+    uint32_t const rem = block_length % simd::float4_count;
+    return rem == 0 ? block_length : block_length + simd::float4_count - rem;
+}
+
+template <typename T, typename Buffer>
+each_block<T> make_each_block(Buffer &buffer, uint32_t const block_length) {
+    auto const &format = buffer.format();
+
+    if (format.pcm_format() != pcm_span_utils::pcm_format_of<T>()) {
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+
+    uint32_t const frame_length = buffer.frame_length();
+
+    return each_block<T>{buffer.audio_buffer_list()->mBuffers, format.channel_count(), format.stride(), frame_length,
+                         round_up_block_length(block_length, frame_length)};
+}
+}  // namespace yas::audio::each_block_utils
+
+namespace yas::audio {
+template <typename T>
+each_block<T>::each_block(AudioBuffer const *const buffers, uint32_t const channel_count, uint32_t const stride,
+                          uint32_t const frame_length, uint32_t const block_length) noexcept
+    : _buffers(buffers),
+      _channel_count(channel_count),
+      _stride(stride),
+      _frame_length(frame_length),
+      _block_length(block_length) {
+}
+
+template <typename T>
+bool each_block<T>::next() noexcept {
+    if (this->_ch_idx >= this->_channel_count || this->_frame_length == 0) {
+        return false;
+    }
+
+    if (this->_is_first) {
+        this->_is_first = false;
+    } else {
+        this->_frame_idx += this->_block_length;
+
+        if (this->_frame_idx >= this->_frame_length) {
+            this->_frame_idx = 0;
+
+            if (++this->_ch_idx >= this->_channel_count) {
+                return false;
+            }
+
+            this->_channel_data = nullptr;
+        }
+    }
+
+    if (!this->_channel_data) {
+        AudioBuffer const &buffer = this->_buffers[this->_ch_idx / this->_stride];
+        this->_channel_data = static_cast<T *>(buffer.mData) + this->_ch_idx % this->_stride;
+    }
+
+    this->_length = std::min(this->_block_length, this->_frame_length - this->_frame_idx);
+
+    return true;
+}
+
+template <typename T>
+T *each_block<T>::data() const noexcept {
+    return this->_channel_data + this->_frame_idx * this->_stride;
+}
+
+template <typename T>
+uint32_t each_block<T>::length() const noexcept {
+    return this->_length;
+}
+
+template <typename T>
+uint32_t each_block<T>::stride() const noexcept {
+    return this->_stride;
+}
+
+template <typename T>
+uint32_t each_block<T>::channel() const noexcept {
+    return this->_ch_idx;
+}
+
+template <typename T>
+uint32_t each_block<T>::frame() const noexcept {
+    return this->_frame_idx;
+}
+
+template <typename T>
+each_block<T> make_each_block(pcm_buffer &buffer, uint32_t const block_length) {
+    return each_block_utils::make_each_block<T>(buffer, block_length);
+}
+
+template <typename T>
+each_block<T const> make_each_block(pcm_buffer const &buffer, uint32_t const block_length) {
+    return each_block_utils::make_each_block<T const>(buffer, block_length);
+}
+}  // namespace yas::audio
@@ -0,0 +1,88 @@
+//
+//  yas_audio_file_device.cpp
+//
+
+#include "yas_audio_file_device.h"
+
+#include "yas_audio_file_io_core.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+file_device::file_device(args &&args) : _args(std::move(args)) {
+    if (!this->_args.file || !this->_args.file->is_opened()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : file is not opened.");
+    }
+
+    if (auto const &output_format = this->_args.output_format;
+        output_format && output_format->sample_rate() != this->_args.file->processing_format().sample_rate()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : sample rates are not equal.");
+    }
+
+    if (this->_args.output_sink && (!this->_args.output_sink.value() || !this->_args.output_format)) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : output_sink without output.");
+    }
+
+    if (this->_args.read_ahead_frame_capacity == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : read_ahead_frame_capacity is zero.");
+    }
+}
+
+std::optional<format> file_device::input_format() const {
+    return this->_args.file->processing_format();
+}
+
+std::optional<format> file_device::output_format() const {
+    return this->_args.output_format;
+}
+
+io_core_ptr file_device::make_io_core() const {
+    return file_io_core::make_shared(this->_weak_device.lock());
+}
+
+std::optional<interruptor_ptr> const &file_device::interruptor() const {
+    static std::optional<interruptor_ptr> const _null_interruptor = std::nullopt;
+    return _null_interruptor;
+}
+
+observing::endable file_device::observe_io_device(observing::caller<io_device::method>::handler_f &&handler) {
+    return this->_notifier->observe(std::move(handler));
+}
+
+file_device::args const &file_device::file_args() const {
+    return this->_args;
+}
+
+file_device_statistics file_device::statistics() const {
+    return {.slice_count = this->_slice_count.load(),
+            .read_frame_count = this->_read_frame_count.load(),
+            .underrun_count = this->_underrun_count.load(),
+            .underrun_frame_count = this->_underrun_frame_count.load(),
+            .dropped_output_frame_count = this->_dropped_output_frame_count.load()};
+}
+
+void file_device::reset_statistics() {
+    this->_slice_count = 0;
+    this->_read_frame_count = 0;
+    this->_underrun_count = 0;
+    this->_underrun_frame_count = 0;
+    this->_dropped_output_frame_count = 0;
+}
+
+void file_device::record_slice(uint32_t const read_frame_count, uint32_t const underrun_frame_count,
+                               uint32_t const dropped_output_frame_count) {
+    this->_slice_count.fetch_add(1, std::memory_order_relaxed);
+    this->_read_frame_count.fetch_add(read_frame_count, std::memory_order_relaxed);
+    this->_dropped_output_frame_count.fetch_add(dropped_output_frame_count, std::memory_order_relaxed);
+
+    if (underrun_frame_count > 0) {
+        this->_underrun_count.fetch_add(1, std::memory_order_relaxed);
+        this->_underrun_frame_count.fetch_add(underrun_frame_count, std::memory_order_relaxed);
+    }
+}
+
+file_device_ptr file_device::make_shared(args args) {
+    auto shared = file_device_ptr{new file_device{std::move(args)}};
+    shared->_weak_device = shared;
+    return shared;
+}
@@ -0,0 +1,75 @@
+//
+//  yas_audio_file_device.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_file.h>
+#include <audio/yas_audio_io_device.h>
+#include <audio/yas_audio_offline_device.h>
+
+#include <atomic>
+
+namespace yas::audio {
+struct file_device_statistics {
+    uint64_t slice_count = 0;
+    uint64_t read_frame_count = 0;            // delivered to the input buffers from the file
+    uint64_t underrun_count = 0;              // slices the read-ahead had not filled at their deadlines
+    uint64_t underrun_frame_count = 0;        // the frames of the underruns filled with silence
+    uint64_t dropped_output_frame_count = 0;  // real_time. the output frames the writer had no room for
+};
+
+// an input device that streams an opened file. a reader thread reads ahead of the render thread into a ring.
+// the output is written to the sink or discarded. the io stops rendering at the end of the file unless looping.
+struct file_device : io_device {
+    enum class pacing {
+        real_time,  // renders each slice at its deadline like virtual_device. the render thread never waits
+        free_run,   // renders as fast as the file is read
+    };
+
+    struct args {
+        audio::file_ptr file;  // the input format is the processing format of the file
+        std::optional<audio::format> output_format = std::nullopt;
+        // finished when the rendering ends. written on a writer thread in real_time not to block the render thread.
+        std::optional<offline_sink_ptr> output_sink = std::nullopt;
+        file_device::pacing pacing = pacing::real_time;
+        bool is_looping = false;
+        uint32_t read_ahead_frame_capacity = 65536;
+        // called on the control executor when the end of the file or the sink aborts the rendering.
+        std::function<void(void)> completion = nullptr;
+    };
+
+    [[nodiscard]] std::optional<audio::format> input_format() const override;
+    [[nodiscard]] std::optional<audio::format> output_format() const override;
+
+    [[nodiscard]] io_core_ptr make_io_core() const override;
+
+    [[nodiscard]] std::optional<interruptor_ptr> const &interruptor() const override;
+
+    [[nodiscard]] observing::endable observe_io_device(observing::caller<io_device::method>::handler_f &&) override;
+
+    [[nodiscard]] args const &file_args() const;
+    [[nodiscard]] file_device_statistics statistics() const;
+    void reset_statistics();
+
+    // called from the render thread of the io_core.
+    void record_slice(uint32_t const read_frame_count, uint32_t const underrun_frame_count,
+                      uint32_t const dropped_output_frame_count);
+
+    [[nodiscard]] static file_device_ptr make_shared(args);
+
+   private:
+    std::weak_ptr<file_device> _weak_device;
+    args const _args;
+
+    std::atomic<uint64_t> _slice_count{0};
+    std::atomic<uint64_t> _read_frame_count{0};
+    std::atomic<uint64_t> _underrun_count{0};
+    std::atomic<uint64_t> _underrun_frame_count{0};
+    std::atomic<uint64_t> _dropped_output_frame_count{0};
+
+    observing::notifier_ptr<io_device::method> const _notifier = observing::notifier<io_device::method>::make_shared();
+
+    file_device(args &&);
+};
+}  // namespace yas::audio
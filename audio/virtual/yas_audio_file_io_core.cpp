@@ -0,0 +1,420 @@
+//
+//  yas_audio_file_io_core.cpp
+//
+
+#include "yas_audio_file_io_core.h"
+
+#include <cpp_utils/yas_result.h>
+#include <mach/mach_time.h>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+
+#include "yas_audio_executor.h"
+#include "yas_audio_file_device.h"
+#include "yas_audio_pcm_ring_buffer.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+// reads the file ahead of the render thread into the ring on its own thread.
+struct file_io_core::reader {
+    pcm_ring_buffer_ptr const ring;
+
+    reader(file_ptr const &file, uint32_t const frame_capacity, bool const is_looping)
+        : ring(pcm_ring_buffer::make_shared(file->processing_format(), frame_capacity)),
+          _file(file),
+          _buffer(file->processing_format(), std::min(ring->frame_capacity() / 2, uint32_t(4096))),
+          _is_looping(is_looping) {
+        this->_file->set_file_frame_position(0);
+        this->_thread = std::thread{[this] { this->_run(); }};
+    }
+
+    ~reader() {
+        this->stop();
+    }
+
+    // true when the rest of the file is in the ring.
+    bool is_ended() const {
+        return this->_is_ended.load(std::memory_order_acquire);
+    }
+
+    // render thread in free_run. wakes the reader after reading from the ring.
+    void notify() {
+        { std::lock_guard<std::mutex> lock(this->_mutex); }
+        this->_condition.notify_all();
+    }
+
+    // render thread in free_run. returns when the frames are readable, the file is ended or stopped.
+    void wait_readable(uint32_t const frame_length) {
+        std::unique_lock<std::mutex> lock(this->_mutex);
+        this->_condition.wait(lock, [this, frame_length] {
+            return this->_is_stopped || this->is_ended() || this->ring->readable_frame_length() >= frame_length;
+        });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+
+            if (this->_is_stopped) {
+                return;
+            }
+
+            this->_is_stopped = true;
+        }
+
+        this->_condition.notify_all();
+
+        this->_thread.join();
+    }
+
+   private:
+    file_ptr const _file;
+    pcm_buffer _buffer;
+    bool const _is_looping;
+    std::atomic<bool> _is_ended{false};
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _is_stopped = false;
+    std::thread _thread;
+
+    void _run() {
+        auto &buffer = this->_buffer;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(this->_mutex);
+
+                // the render thread in real_time does not notify not to lock. the ring is polled for it.
+                this->_condition.wait_for(lock, std::chrono::milliseconds(5), [this, &buffer] {
+                    return this->_is_stopped || this->ring->writable_frame_length() >= buffer.frame_capacity();
+                });
+
+                if (this->_is_stopped) {
+                    return;
+                }
+
+                if (this->ring->writable_frame_length() < buffer.frame_capacity()) {
+                    continue;
+                }
+            }
+
+            auto const result = this->_file->read_into_buffer(buffer);
+
+            if (result && buffer.frame_length() == 0 && this->_is_looping && this->_file->file_frame_position() > 0) {
+                this->_file->set_file_frame_position(0);
+                continue;
+            }
+
+            if (!result || buffer.frame_length() == 0) {
+                this->_is_ended.store(true, std::memory_order_release);
+                this->notify();
+                return;
+            }
+
+            this->ring->write(buffer);
+            this->notify();
+        }
+    }
+};
+
+// writes the output into the sink on its own thread not to block the render thread in real_time.
+struct file_io_core::writer {
+    pcm_ring_buffer_ptr const ring;
+
+    writer(offline_sink_ptr const &sink, audio::format const &format, uint32_t const frame_capacity)
+        : ring(pcm_ring_buffer::make_shared(format, frame_capacity)),
+          _sink(sink),
+          _buffer(format, std::min(ring->frame_capacity() / 2, uint32_t(4096))) {
+        this->_thread = std::thread{[this] { this->_run(); }};
+    }
+
+    ~writer() {
+        this->finish(true);
+    }
+
+    // true after the sink aborted. the frames written after it are discarded.
+    bool is_aborted() const {
+        return this->_is_aborted.load(std::memory_order_acquire);
+    }
+
+    // writes the frames in the ring into the sink, finishes the sink and joins the thread.
+    void finish(bool const cancelled) {
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+
+            if (this->_is_finishing) {
+                return;
+            }
+
+            this->_is_finishing = true;
+            this->_is_cancelled = cancelled;
+        }
+
+        this->_condition.notify_all();
+
+        this->_thread.join();
+    }
+
+   private:
+    offline_sink_ptr const _sink;
+    pcm_buffer _buffer;
+    std::atomic<bool> _is_aborted{false};
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _is_finishing = false;
+    bool _is_cancelled = false;
+    std::thread _thread;
+
+    void _run() {
+        auto &buffer = this->_buffer;
+        double const sample_rate = buffer.format().sample_rate();
+        int64_t sample_time = 0;
+
+        while (true) {
+            bool is_finishing = false;
+
+            {
+                std::unique_lock<std::mutex> lock(this->_mutex);
+
+                // the render thread does not notify not to lock. the ring is polled for it.
+                this->_condition.wait_for(lock, std::chrono::milliseconds(5), [this, &buffer] {
+                    return this->_is_finishing || this->ring->readable_frame_length() >= buffer.frame_capacity();
+                });
+
+                is_finishing = this->_is_finishing;
+            }
+
+            if (!is_finishing && this->ring->readable_frame_length() < buffer.frame_capacity()) {
+                continue;
+            }
+
+            this->ring->read(buffer);
+
+            if (buffer.frame_length() == 0) {
+                break;
+            }
+
+            if (!this->is_aborted() &&
+                this->_sink->write(buffer, time{sample_time, sample_rate}) == continuation::abort) {
+                this->_is_aborted.store(true, std::memory_order_release);
+            }
+
+            sample_time += buffer.frame_length();
+        }
+
+        this->_sink->finish(this->_is_cancelled);
+    }
+};
+
+file_io_core::file_io_core(file_device_ptr const &device) : _device(device) {
+}
+
+file_io_core::~file_io_core() {
+    this->stop();
+}
+
+void file_io_core::set_render_handler(std::optional<io_render_f> handler) {
+    this->_render_handler = std::move(handler);
+}
+
+void file_io_core::set_maximum_frames_per_slice(uint32_t const frames) {
+    this->_maximum_frames = frames;
+}
+
+bool file_io_core::start() {
+    if (this->_thread) {
+        return false;
+    }
+
+    auto kernel = this->_make_kernel();
+
+    if (!kernel) {
+        return false;
+    }
+
+    if (this->_render_thread_policy.prefaults_buffers) {
+        kernel->prefault_buffers();
+    }
+
+    auto const &args = this->_device->file_args();
+
+    // the ring holds a slice and a read of the reader at least not to wait for each other in free_run.
+    this->_reader = std::make_shared<reader>(
+        args.file, std::max(args.read_ahead_frame_capacity, this->_maximum_frames * 2), args.is_looping);
+    this->_is_cancelled = false;
+
+    std::promise<std::vector<render_thread_policy::error_t>> applied;
+    auto applied_future = applied.get_future();
+
+    // the sink in real_time is written on the writer not to block the render thread. the ring has the same capacity.
+    std::shared_ptr<writer> writer = nullptr;
+    if (args.output_sink && kernel->output_buffer && args.pacing == file_device::pacing::real_time) {
+        writer = std::make_shared<file_io_core::writer>(
+            args.output_sink.value(), kernel->output_buffer->format(),
+            std::max(args.read_ahead_frame_capacity, this->_maximum_frames * 2));
+    }
+
+    this->_thread = std::thread{[kernel = std::move(kernel), device = this->_device, reader = this->_reader,
+                                 writer = std::move(writer), &is_cancelled = this->_is_cancelled,
+                                 policy = this->_render_thread_policy, applied = std::move(applied)]() mutable {
+        // applied before the first slice not to render without the policy.
+        applied.set_value(policy.apply(pthread_self()));
+
+        if (policy.prefaults_buffers) {
+            prefault_thread_stack();
+        }
+
+        auto const &args = device->file_args();
+        auto const &input_buffer = kernel->input_buffer;
+        auto const &output_buffer = kernel->output_buffer;
+        auto const &ring = reader->ring;
+        bool const is_paced = args.pacing == file_device::pacing::real_time;
+        uint32_t const slice_frames = input_buffer->frame_capacity();
+        double const sample_rate = input_buffer->format().sample_rate();
+        uint64_t const period = host_time_for_seconds(static_cast<double>(slice_frames) / sample_rate);
+
+        uint64_t deadline = mach_absolute_time() + period;
+        int64_t sample_time = 0;
+        bool is_finished = false;
+
+        while (!is_cancelled) {
+            if (is_paced) {
+                mach_wait_until(deadline);
+            } else {
+                reader->wait_readable(slice_frames);
+
+                if (is_cancelled) {
+                    break;
+                }
+            }
+
+            // loaded before reading so that the ring has the rest of the file if ended.
+            bool const is_ended = reader->is_ended();
+
+            kernel->reset_buffers();
+            ring->read(*input_buffer);
+
+            uint32_t const read_length = input_buffer->frame_length();
+            bool const is_last = is_ended && ring->readable_frame_length() == 0;
+            uint32_t slice_length = slice_frames;
+            uint32_t underrun_length = 0;
+
+            if (is_last) {
+                slice_length = read_length;
+            } else if (read_length < slice_frames) {
+                // the frames after the read ones are already cleared.
+                underrun_length = slice_frames - read_length;
+                input_buffer->set_frame_length(slice_frames);
+            }
+
+            if (slice_length > 0) {
+                std::optional<time> const slice_time =
+                    is_paced ? time{deadline, sample_time, sample_rate} : time{sample_time, sample_rate};
+
+                kernel->input_time = slice_time;
+
+                if (output_buffer) {
+                    output_buffer->set_frame_length(slice_length);
+                }
+
+                kernel->render_handler({.output_buffer = output_buffer.get(),
+                                        .output_time = output_buffer ? slice_time : null_time_opt,
+                                        .input_buffer = input_buffer.get(),
+                                        .input_time = kernel->input_time});
+
+                if (!is_paced) {
+                    reader->notify();
+                }
+
+                uint32_t dropped_output_length = 0;
+
+                if (writer) {
+                    // the frames that do not fit are dropped not to wait for the sink.
+                    auto const result = writer->ring->write(*output_buffer);
+                    dropped_output_length = slice_length - (result ? result.value() : 0);
+                }
+
+                device->record_slice(read_length, underrun_length, dropped_output_length);
+
+                if (writer) {
+                    if (writer->is_aborted()) {
+                        is_finished = true;
+                        break;
+                    }
+                } else if (args.output_sink && args.output_sink.value()->write(*output_buffer, slice_time.value()) ==
+                                                   continuation::abort) {
+                    is_finished = true;
+                    break;
+                }
+
+                sample_time += slice_length;
+            }
+
+            if (is_last) {
+                is_finished = true;
+                break;
+            }
+
+            if (is_paced) {
+                deadline += period;
+
+                // restarts the deadlines after an overrun instead of skipping the file.
+                if (uint64_t const now = mach_absolute_time(); now > deadline) {
+                    deadline = now;
+                }
+            }
+        }
+
+        if (writer) {
+            writer->finish(!is_finished);
+        } else if (args.output_sink) {
+            args.output_sink.value()->finish(!is_finished);
+        }
+
+        if (is_finished && args.completion) {
+            control_executor()->perform([completion = args.completion] { completion(); });
+        }
+    }};
+
+    this->_render_thread_policy_errors = applied_future.get();
+
+    return true;
+}
+
+void file_io_core::stop() {
+    if (auto &thread = this->_thread) {
+        this->_is_cancelled = true;
+        this->_reader->stop();
+
+        thread->join();
+
+        this->_thread = std::nullopt;
+        this->_reader = nullptr;
+    }
+}
+
+void file_io_core::set_render_thread_policy(render_thread_policy const &policy) {
+    this->_render_thread_policy = policy;
+}
+
+std::vector<render_thread_policy::error_t> file_io_core::render_thread_policy_errors() const {
+    return this->_render_thread_policy_errors;
+}
+
+io_kernel_ptr file_io_core::_make_kernel() const {
+    if (!this->_render_handler || this->_maximum_frames == 0) {
+        return nullptr;
+    }
+
+    return io_kernel::make_shared(this->_render_handler.value(), this->_device->input_format(),
+                                  this->_device->output_format(), this->_maximum_frames);
+}
+
+file_io_core_ptr file_io_core::make_shared(file_device_ptr const &device) {
+    return file_io_core_ptr{new file_io_core{device}};
+}
@@ -0,0 +1,45 @@
+//
+//  yas_audio_file_io_core.h
+//
+
+#pragma once
+
+#include "yas_audio_io_core.h"
+
+#include <atomic>
+#include <thread>
+
+namespace yas::audio {
+struct file_io_core : io_core {
+    ~file_io_core();
+
+    void set_render_handler(std::optional<io_render_f>) override;
+    void set_maximum_frames_per_slice(uint32_t const) override;
+
+    [[nodiscard]] bool start() override;
+    void stop() override;
+
+    void set_render_thread_policy(render_thread_policy const &) override;
+    [[nodiscard]] std::vector<render_thread_policy::error_t> render_thread_policy_errors() const override;
+
+    static file_io_core_ptr make_shared(file_device_ptr const &);
+
+   private:
+    struct reader;
+    struct writer;
+
+    file_device_ptr const _device;
+    std::shared_ptr<reader> _reader = nullptr;
+    std::optional<std::thread> _thread = std::nullopt;
+    std::atomic<bool> _is_cancelled{false};
+
+    std::optional<io_render_f> _render_handler = std::nullopt;
+    uint32_t _maximum_frames = 512;
+    render_thread_policy _render_thread_policy;
+    std::vector<render_thread_policy::error_t> _render_thread_policy_errors;
+
+    file_io_core(file_device_ptr const &);
+
+    io_kernel_ptr _make_kernel() const;
+};
+}  // namespace yas::audio
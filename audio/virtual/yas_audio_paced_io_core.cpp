@@ -0,0 +1,145 @@
+//
+//  yas_audio_paced_io_core.cpp
+//
+
+#include "yas_audio_paced_io_core.h"
+
+#include <audio/yas_audio_io_device.h>
+#include <mach/mach.h>
+#include <mach/mach_time.h>
+#include <pthread.h>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::paced_io_core_utils {
+// asks the scheduler to run the thread once per period like a hardware io thread. it keeps running without it.
+static void set_time_constraint_policy(uint64_t const period) {
+    uint64_t const constraint = std::min(period, host_time_for_seconds(0.05));
+
+    thread_time_constraint_policy_data_t policy{.period = static_cast<uint32_t>(period),
+                                                .computation = static_cast<uint32_t>(constraint / 2),
+                                                .constraint = static_cast<uint32_t>(constraint),
+                                                .preemptible = 1};
+
+    thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_TIME_CONSTRAINT_POLICY,
+                      reinterpret_cast<thread_policy_t>(&policy), THREAD_TIME_CONSTRAINT_POLICY_COUNT);
+}
+}  // namespace yas::audio::paced_io_core_utils
+
+paced_io_core::paced_io_core(io_device_ptr const &device, make_pacer_f &&make_pacer)
+    : _device(device), _make_pacer(std::move(make_pacer)) {
+}
+
+paced_io_core::~paced_io_core() {
+    this->stop();
+}
+
+void paced_io_core::set_render_handler(std::optional<io_render_f> handler) {
+    this->_render_handler = std::move(handler);
+}
+
+void paced_io_core::set_maximum_frames_per_slice(uint32_t const frames) {
+    this->_maximum_frames = frames;
+}
+
+bool paced_io_core::start() {
+    if (this->_thread) {
+        return false;
+    }
+
+    auto kernel = this->_make_kernel();
+
+    if (!kernel) {
+        return false;
+    }
+
+    this->_is_cancelled = false;
+
+    this->_thread = std::thread{[kernel = std::move(kernel), pacer = this->_make_pacer(this->_maximum_frames),
+                                 maximum_frames = this->_maximum_frames, &is_cancelled = this->_is_cancelled] {
+        auto const &buffer = kernel->output_buffer ? kernel->output_buffer : kernel->input_buffer;
+        double const sample_rate = buffer->format().sample_rate();
+        auto const duration = [sample_rate](uint32_t const frame_length) {
+            return host_time_for_seconds(static_cast<double>(frame_length) / sample_rate);
+        };
+
+        paced_io_core_utils::set_time_constraint_policy(duration(maximum_frames));
+
+        uint32_t frame_length = pacer->next_frame_length();
+        uint64_t deadline = mach_absolute_time() + duration(frame_length);
+        int64_t sample_time = 0;
+
+        while (!is_cancelled) {
+            auto const late_duration = pacer->late_duration();
+
+            mach_wait_until(deadline + late_duration.value_or(0));
+
+            uint64_t const wake_time = mach_absolute_time();
+            pacer->did_wake(wake_time, sample_rate);
+
+            slice_result result{.jitter = wake_time > deadline ? wake_time - deadline : 0,
+                                .is_late = late_duration.has_value()};
+
+            kernel->reset_buffers();
+
+            if (kernel->output_buffer) {
+                kernel->output_buffer->set_frame_length(frame_length);
+            }
+
+            if (kernel->input_buffer) {
+                kernel->input_buffer->set_frame_length(frame_length);
+            }
+
+            std::optional<time> const slice_time{std::in_place, deadline, sample_time, sample_rate};
+
+            if (kernel->input_buffer) {
+                kernel->input_time = slice_time;
+            }
+
+            kernel->render_handler({.output_buffer = kernel->output_buffer.get(),
+                                    .output_time = kernel->output_buffer ? slice_time : null_time_opt,
+                                    .input_buffer = kernel->input_buffer.get(),
+                                    .input_time = kernel->input_time});
+
+            sample_time += frame_length;
+            frame_length = pacer->next_frame_length();
+            deadline += duration(frame_length);
+
+            if (uint64_t const finish_time = mach_absolute_time(); finish_time > deadline) {
+                uint64_t const period = duration(frame_length);
+                result.dropped_slice_count = (finish_time - deadline) / period + 1;
+                result.dropped_frame_count = frame_length * result.dropped_slice_count;
+                deadline += period * result.dropped_slice_count;
+                sample_time += result.dropped_frame_count;
+            }
+
+            pacer->did_render(result);
+        }
+    }};
+
+    return true;
+}
+
+void paced_io_core::stop() {
+    if (auto &thread = this->_thread) {
+        this->_is_cancelled = true;
+
+        thread->join();
+
+        this->_thread = std::nullopt;
+    }
+}
+
+io_kernel_ptr paced_io_core::_make_kernel() const {
+    if (!this->_render_handler || this->_maximum_frames == 0) {
+        return nullptr;
+    }
+
+    return io_kernel::make_shared(this->_render_handler.value(), this->_device->input_format(),
+                                  this->_device->output_format(), this->_maximum_frames);
+}
+
+paced_io_core_ptr paced_io_core::make_shared(io_device_ptr const &device, make_pacer_f &&make_pacer) {
+    return paced_io_core_ptr{new paced_io_core{device, std::move(make_pacer)}};
+}
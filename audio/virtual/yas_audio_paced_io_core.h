@@ -0,0 +1,60 @@
+//
+//  yas_audio_paced_io_core.h
+//
+
+#pragma once
+
+#include "yas_audio_io_core.h"
+
+#include <atomic>
+#include <thread>
+
+namespace yas::audio {
+// renders each slice on a thread at its real-time deadline for the devices without hardware.
+// the slices whose deadlines passed while rendering are dropped like an overloaded hardware device.
+struct paced_io_core final : io_core {
+    struct slice_result {
+        uint64_t jitter = 0;  // host time from the deadline to the wake
+        bool is_late = false;
+        uint64_t dropped_slice_count = 0;
+        uint64_t dropped_frame_count = 0;
+    };
+
+    // made by the device at every start and called only from the render thread.
+    struct pacer {
+        virtual ~pacer() = default;
+
+        // not more than the maximum frames per slice.
+        virtual uint32_t next_frame_length() = 0;
+        // the host time to wake past the deadline if the slice is late.
+        virtual std::optional<uint64_t> late_duration() = 0;
+        virtual void did_wake(uint64_t const host_time, double const sample_rate) = 0;
+        virtual void did_render(slice_result const &) = 0;
+    };
+
+    using make_pacer_f = std::function<std::unique_ptr<pacer>(uint32_t const maximum_frames)>;
+
+    ~paced_io_core();
+
+    void set_render_handler(std::optional<io_render_f>) override;
+    void set_maximum_frames_per_slice(uint32_t const) override;
+
+    [[nodiscard]] bool start() override;
+    void stop() override;
+
+    static paced_io_core_ptr make_shared(io_device_ptr const &, make_pacer_f &&);
+
+   private:
+    io_device_ptr const _device;
+    make_pacer_f const _make_pacer;
+    std::optional<std::thread> _thread = std::nullopt;
+    std::atomic<bool> _is_cancelled{false};
+
+    std::optional<io_render_f> _render_handler = std::nullopt;
+    uint32_t _maximum_frames = 512;
+
+    paced_io_core(io_device_ptr const &, make_pacer_f &&);
+
+    io_kernel_ptr _make_kernel() const;
+};
+}  // namespace yas::audio
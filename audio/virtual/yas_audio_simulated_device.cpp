@@ -0,0 +1,216 @@
+//
+//  yas_audio_simulated_device.cpp
+//
+
+#include "yas_audio_simulated_device.h"
+
+#include <mach/mach_time.h>
+
+#include <cmath>
+#include <random>
+
+#include "yas_audio_paced_io_core.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+struct simulated_device::interruptor_impl : audio::interruptor {
+    bool is_interrupting() const override {
+        return this->_is_interrupting;
+    }
+
+    observing::endable observe_interruption(observing::caller<interruption_method>::handler_f &&handler) override {
+        return this->_notifier->observe(std::move(handler));
+    }
+
+    void set_interrupting(bool const is_interrupting) {
+        if (this->_is_interrupting != is_interrupting) {
+            this->_is_interrupting = is_interrupting;
+            this->_notifier->notify(is_interrupting ? interruption_method::began : interruption_method::ended);
+        }
+    }
+
+   private:
+    bool _is_interrupting = false;
+    observing::notifier_ptr<interruption_method> const _notifier =
+        observing::notifier<interruption_method>::make_shared();
+};
+
+struct simulated_device::pacer_impl : paced_io_core::pacer {
+    pacer_impl(simulated_device_ptr const &device, uint32_t const maximum_frames)
+        : _device(device),
+          _engine(device->_args.seed),
+          _frames_distribution(device->_args.minimum_frames_per_slice > 0 ?
+                                   std::min(device->_args.minimum_frames_per_slice, maximum_frames) :
+                                   maximum_frames,
+                               maximum_frames),
+          _late_distribution(device->_args.late_probability),
+          _late_duration_distribution(0.0, device->_args.maximum_late_duration) {
+    }
+
+    uint32_t next_frame_length() override {
+        return this->_frames_distribution(this->_engine);
+    }
+
+    std::optional<uint64_t> late_duration() override {
+        // the late duration is drawn every slice so that the frame lengths depend only on the seed.
+        bool const is_late = this->_late_distribution(this->_engine);
+        double const late_duration = this->_late_duration_distribution(this->_engine);
+
+        if (is_late) {
+            return host_time_for_seconds(late_duration);
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    void did_wake(uint64_t const host_time, double const sample_rate) override {
+        if (this->_is_first_slice) {
+            this->_device->_record_recovery(host_time, sample_rate);
+            this->_is_first_slice = false;
+        }
+    }
+
+    void did_render(paced_io_core::slice_result const &result) override {
+        this->_device->_record_slice(result.is_late, result.dropped_frame_count);
+    }
+
+   private:
+    simulated_device_ptr const _device;
+    std::mt19937 _engine;
+    std::uniform_int_distribution<uint32_t> _frames_distribution;
+    std::bernoulli_distribution _late_distribution;
+    std::uniform_real_distribution<double> _late_duration_distribution;
+    bool _is_first_slice = true;
+};
+
+simulated_device::simulated_device(args &&args)
+    : _args(std::move(args)),
+      _interruptor_impl(std::make_shared<interruptor_impl>()),
+      _interruptor(this->_interruptor_impl) {
+    if (!this->_args.input_format && !this->_args.output_format) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : format is null.");
+    }
+
+    if (this->_args.late_probability < 0.0 || this->_args.late_probability > 1.0 ||
+        this->_args.maximum_late_duration < 0.0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid late arguments.");
+    }
+}
+
+std::optional<format> simulated_device::input_format() const {
+    return this->_args.input_format;
+}
+
+std::optional<format> simulated_device::output_format() const {
+    return this->_args.output_format;
+}
+
+io_core_ptr simulated_device::make_io_core() const {
+    auto const device = this->_weak_device.lock();
+    return paced_io_core::make_shared(device, [device](uint32_t const maximum_frames) {
+        return std::make_unique<pacer_impl>(device, maximum_frames);
+    });
+}
+
+std::optional<interruptor_ptr> const &simulated_device::interruptor() const {
+    return this->_interruptor;
+}
+
+observing::endable simulated_device::observe_io_device(observing::caller<io_device::method>::handler_f &&handler) {
+    return this->_notifier->observe(std::move(handler));
+}
+
+simulated_device::args const &simulated_device::fault_args() const {
+    return this->_args;
+}
+
+simulated_device_statistics simulated_device::statistics() const {
+    uint64_t const recovery_count = this->_recovery_count.load();
+    double const total_recovery_duration = seconds_for_host_time(this->_total_recovery_duration.load());
+
+    return {.slice_count = this->_slice_count.load(),
+            .late_slice_count = this->_late_slice_count.load(),
+            .glitched_frame_count = this->_glitched_frame_count.load(),
+            .recovery_count = recovery_count,
+            .max_recovery_duration = seconds_for_host_time(this->_max_recovery_duration.load()),
+            .mean_recovery_duration = recovery_count > 0 ? total_recovery_duration / recovery_count : 0.0};
+}
+
+void simulated_device::reset_statistics() {
+    this->_slice_count = 0;
+    this->_late_slice_count = 0;
+    this->_glitched_frame_count = 0;
+    this->_recovery_count = 0;
+    this->_max_recovery_duration = 0;
+    this->_total_recovery_duration = 0;
+}
+
+void simulated_device::change_formats(std::optional<format> const &input_format,
+                                      std::optional<format> const &output_format) {
+    if (!input_format && !output_format) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : format is null.");
+    }
+
+    this->_args.input_format = input_format;
+    this->_args.output_format = output_format;
+
+    this->_begin_recovery();
+    this->_notifier->notify(io_device::method::updated);
+}
+
+void simulated_device::begin_interruption() {
+    this->_interruptor_impl->set_interrupting(true);
+}
+
+void simulated_device::end_interruption() {
+    if (this->_interruptor_impl->is_interrupting()) {
+        this->_begin_recovery();
+        this->_interruptor_impl->set_interrupting(false);
+    }
+}
+
+void simulated_device::lose() {
+    this->_notifier->notify(io_device::method::lost);
+}
+
+void simulated_device::_record_recovery(uint64_t const host_time, double const sample_rate) {
+    uint64_t const fault_host_time = this->_fault_host_time.exchange(0);
+
+    if (fault_host_time == 0) {
+        return;
+    }
+
+    uint64_t const duration = host_time > fault_host_time ? host_time - fault_host_time : 0;
+
+    this->_recovery_count.fetch_add(1, std::memory_order_relaxed);
+    this->_total_recovery_duration.fetch_add(duration, std::memory_order_relaxed);
+
+    if (duration > this->_max_recovery_duration.load(std::memory_order_relaxed)) {
+        this->_max_recovery_duration.store(duration, std::memory_order_relaxed);
+    }
+
+    // the frames that should have been rendered while the io was recovering.
+    auto const frame_count = static_cast<uint64_t>(std::ceil(seconds_for_host_time(duration) * sample_rate));
+    this->_glitched_frame_count.fetch_add(frame_count, std::memory_order_relaxed);
+}
+
+void simulated_device::_record_slice(bool const is_late, uint64_t const glitched_frame_count) {
+    this->_slice_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (is_late) {
+        this->_late_slice_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    this->_glitched_frame_count.fetch_add(glitched_frame_count, std::memory_order_relaxed);
+}
+
+void simulated_device::_begin_recovery() {
+    this->_fault_host_time = mach_absolute_time();
+}
+
+simulated_device_ptr simulated_device::make_shared(args args) {
+    auto shared = simulated_device_ptr{new simulated_device{std::move(args)}};
+    shared->_weak_device = shared;
+    return shared;
+}
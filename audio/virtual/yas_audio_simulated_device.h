@@ -0,0 +1,80 @@
+//
+//  yas_audio_simulated_device.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_io_device.h>
+
+#include <atomic>
+
+namespace yas::audio {
+struct simulated_device_statistics {
+    uint64_t slice_count = 0;
+    uint64_t late_slice_count = 0;
+    uint64_t glitched_frame_count = 0;
+    uint64_t recovery_count = 0;
+    double max_recovery_duration = 0.0;   // seconds
+    double mean_recovery_duration = 0.0;  // seconds
+};
+
+// a paced device like virtual_device that injects faults for robustness tests.
+// the faults on the render thread follow the seed. the others are injected by calling the methods below.
+struct simulated_device : io_device {
+    struct args {
+        std::optional<audio::format> input_format = std::nullopt;
+        std::optional<audio::format> output_format = std::nullopt;
+        uint32_t seed = 0;
+        uint32_t minimum_frames_per_slice = 0;  // every slice has the maximum frames if 0
+        double late_probability = 0.0;
+        double maximum_late_duration = 0.0;  // seconds
+    };
+
+    [[nodiscard]] std::optional<audio::format> input_format() const override;
+    [[nodiscard]] std::optional<audio::format> output_format() const override;
+
+    [[nodiscard]] io_core_ptr make_io_core() const override;
+
+    [[nodiscard]] std::optional<interruptor_ptr> const &interruptor() const override;
+
+    [[nodiscard]] observing::endable observe_io_device(observing::caller<io_device::method>::handler_f &&) override;
+
+    [[nodiscard]] args const &fault_args() const;
+    [[nodiscard]] simulated_device_statistics statistics() const;
+    void reset_statistics();
+
+    void change_formats(std::optional<audio::format> const &input_format,
+                        std::optional<audio::format> const &output_format);
+    void begin_interruption();
+    void end_interruption();
+    void lose();
+
+    [[nodiscard]] static simulated_device_ptr make_shared(args);
+
+   private:
+    struct interruptor_impl;
+    struct pacer_impl;
+
+    std::weak_ptr<simulated_device> _weak_device;
+    args _args;
+    std::shared_ptr<interruptor_impl> const _interruptor_impl;
+    std::optional<interruptor_ptr> const _interruptor;
+
+    std::atomic<uint64_t> _fault_host_time{0};
+    std::atomic<uint64_t> _slice_count{0};
+    std::atomic<uint64_t> _late_slice_count{0};
+    std::atomic<uint64_t> _glitched_frame_count{0};
+    std::atomic<uint64_t> _recovery_count{0};
+    std::atomic<uint64_t> _max_recovery_duration{0};
+    std::atomic<uint64_t> _total_recovery_duration{0};
+
+    observing::notifier_ptr<io_device::method> const _notifier = observing::notifier<io_device::method>::make_shared();
+
+    explicit simulated_device(args &&);
+
+    void _begin_recovery();
+    // called from the render thread of the io_core. the recovery is recorded at the first slice of the io_core.
+    void _record_recovery(uint64_t const host_time, double const sample_rate);
+    void _record_slice(bool const is_late, uint64_t const glitched_frame_count);
+};
+}  // namespace yas::audio
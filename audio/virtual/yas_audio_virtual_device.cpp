@@ -0,0 +1,104 @@
+//
+//  yas_audio_virtual_device.cpp
+//
+
+#include "yas_audio_virtual_device.h"
+
+#include "yas_audio_paced_io_core.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+struct virtual_device::pacer_impl : paced_io_core::pacer {
+    pacer_impl(virtual_device_ptr const &device, uint32_t const maximum_frames)
+        : _device(device), _maximum_frames(maximum_frames) {
+    }
+
+    uint32_t next_frame_length() override {
+        return this->_maximum_frames;
+    }
+
+    std::optional<uint64_t> late_duration() override {
+        return std::nullopt;
+    }
+
+    void did_wake(uint64_t const, double const) override {
+    }
+
+    void did_render(paced_io_core::slice_result const &result) override {
+        this->_device->_record_slice(result.jitter, result.dropped_slice_count);
+    }
+
+   private:
+    virtual_device_ptr const _device;
+    uint32_t const _maximum_frames;
+};
+
+virtual_device::virtual_device(std::optional<format> const &input_format, std::optional<format> const &output_format)
+    : _input_format(input_format), _output_format(output_format) {
+    if (!input_format && !output_format) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : format is null.");
+    }
+
+    if (input_format && output_format && input_format->sample_rate() != output_format->sample_rate()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : sample rates are not equal.");
+    }
+}
+
+std::optional<format> virtual_device::input_format() const {
+    return this->_input_format;
+}
+
+std::optional<format> virtual_device::output_format() const {
+    return this->_output_format;
+}
+
+io_core_ptr virtual_device::make_io_core() const {
+    auto const device = this->_weak_device.lock();
+    return paced_io_core::make_shared(device, [device](uint32_t const maximum_frames) {
+        return std::make_unique<pacer_impl>(device, maximum_frames);
+    });
+}
+
+std::optional<interruptor_ptr> const &virtual_device::interruptor() const {
+    static std::optional<interruptor_ptr> const _null_interruptor = std::nullopt;
+    return _null_interruptor;
+}
+
+observing::endable virtual_device::observe_io_device(observing::caller<io_device::method>::handler_f &&handler) {
+    return this->_notifier->observe(std::move(handler));
+}
+
+virtual_device_statistics virtual_device::statistics() const {
+    uint64_t const slice_count = this->_slice_count.load();
+    double const total_jitter = seconds_for_host_time(this->_total_jitter.load());
+
+    return {.slice_count = slice_count,
+            .deadline_miss_count = this->_deadline_miss_count.load(),
+            .max_jitter = seconds_for_host_time(this->_max_jitter.load()),
+            .mean_jitter = slice_count > 0 ? total_jitter / slice_count : 0.0};
+}
+
+void virtual_device::reset_statistics() {
+    this->_slice_count = 0;
+    this->_deadline_miss_count = 0;
+    this->_max_jitter = 0;
+    this->_total_jitter = 0;
+}
+
+void virtual_device::_record_slice(uint64_t const jitter_host_time, uint64_t const missed_slice_count) {
+    this->_slice_count.fetch_add(1, std::memory_order_relaxed);
+    this->_deadline_miss_count.fetch_add(missed_slice_count, std::memory_order_relaxed);
+    this->_total_jitter.fetch_add(jitter_host_time, std::memory_order_relaxed);
+
+    if (jitter_host_time > this->_max_jitter.load(std::memory_order_relaxed)) {
+        this->_max_jitter.store(jitter_host_time, std::memory_order_relaxed);
+    }
+}
+
+virtual_device_ptr virtual_device::make_shared(std::optional<format> const &input_format,
+                                               std::optional<format> const &output_format) {
+    auto shared = virtual_device_ptr{new virtual_device{input_format, output_format}};
+    shared->_weak_device = shared;
+    return shared;
+}
@@ -0,0 +1,57 @@
+//
+//  yas_audio_virtual_device.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_io_device.h>
+
+#include <atomic>
+
+namespace yas::audio {
+struct virtual_device_statistics {
+    uint64_t slice_count = 0;
+    uint64_t deadline_miss_count = 0;
+    double max_jitter = 0.0;   // seconds
+    double mean_jitter = 0.0;  // seconds
+};
+
+// a device without hardware that renders each slice at its real-time deadline.
+// the slice period is the maximum frames per slice at the sample rate of the formats.
+struct virtual_device : io_device {
+    [[nodiscard]] std::optional<audio::format> input_format() const override;
+    [[nodiscard]] std::optional<audio::format> output_format() const override;
+
+    [[nodiscard]] io_core_ptr make_io_core() const override;
+
+    [[nodiscard]] std::optional<interruptor_ptr> const &interruptor() const override;
+
+    [[nodiscard]] observing::endable observe_io_device(observing::caller<io_device::method>::handler_f &&) override;
+
+    [[nodiscard]] virtual_device_statistics statistics() const;
+    void reset_statistics();
+
+    [[nodiscard]] static virtual_device_ptr make_shared(std::optional<audio::format> const &input_format,
+                                                        std::optional<audio::format> const &output_format);
+
+   private:
+    struct pacer_impl;
+
+    std::weak_ptr<virtual_device> _weak_device;
+    std::optional<audio::format> const _input_format;
+    std::optional<audio::format> const _output_format;
+
+    std::atomic<uint64_t> _slice_count{0};
+    std::atomic<uint64_t> _deadline_miss_count{0};
+    std::atomic<uint64_t> _max_jitter{0};
+    std::atomic<uint64_t> _total_jitter{0};
+
+    observing::notifier_ptr<io_device::method> const _notifier = observing::notifier<io_device::method>::make_shared();
+
+    virtual_device(std::optional<audio::format> const &input_format,
+                   std::optional<audio::format> const &output_format);
+
+    // called from the render thread of the io_core.
+    void _record_slice(uint64_t const jitter_host_time, uint64_t const missed_slice_count);
+};
+}  // namespace yas::audio
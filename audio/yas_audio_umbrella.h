@@ -5,18 +5,40 @@
 #pragma once
 
 #include <audio/yas_audio_debug.h>
+#include <audio/yas_audio_dsp_analysis.h>
+#include <audio/yas_audio_dsp_convert.h>
+#include <audio/yas_audio_dsp_interleave.h>
+#include <audio/yas_audio_dsp_mix.h>
+#include <audio/yas_audio_dsp_resampler.h>
+#include <audio/yas_audio_each_block.h>
 #include <audio/yas_audio_each_data.h>
 #include <audio/yas_audio_exception.h>
+#include <audio/yas_audio_executor.h>
 #include <audio/yas_audio_file.h>
+#include <audio/yas_audio_file_device.h>
+#include <audio/yas_audio_file_stream.h>
+#include <audio/yas_audio_file_stream_pool.h>
 #include <audio/yas_audio_file_utils.h>
+#include <audio/yas_audio_file_writer.h>
 #include <audio/yas_audio_format.h>
 #include <audio/yas_audio_io.h>
+#include <audio/yas_audio_mapped_file.h>
 #include <audio/yas_audio_math.h>
+#include <audio/yas_audio_native_file.h>
 #include <audio/yas_audio_offline_device.h>
+#include <audio/yas_audio_offline_file_sink.h>
+#include <audio/yas_audio_offline_scheduler.h>
 #include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_pcm_ring_buffer.h>
+#include <audio/yas_audio_pcm_span.h>
+#include <audio/yas_audio_render_thread_policy.h>
 #include <audio/yas_audio_renewable_device.h>
+#include <audio/yas_audio_shared_memory_device.h>
+#include <audio/yas_audio_shared_memory_ring.h>
+#include <audio/yas_audio_simulated_device.h>
 #include <audio/yas_audio_time.h>
 #include <audio/yas_audio_types.h>
+#include <audio/yas_audio_virtual_device.h>
 #include <cpp_utils/yas_cf_utils.h>
 #include <cpp_utils/yas_exception.h>
 #include <cpp_utils/yas_result.h>
@@ -42,8 +64,13 @@
 #include <audio/yas_audio_graph_avf_au.h>
 #include <audio/yas_audio_graph_avf_au_mixer.h>
 #include <audio/yas_audio_graph_connection.h>
+#include <audio/yas_audio_graph_file_player.h>
 #include <audio/yas_audio_graph_io.h>
+#include <audio/yas_audio_graph_mixer.h>
 #include <audio/yas_audio_graph_node.h>
+#include <audio/yas_audio_graph_resampler.h>
 #include <audio/yas_audio_graph_route.h>
+#include <audio/yas_audio_graph_shared_memory_sink.h>
 #include <audio/yas_audio_graph_tap.h>
+#include <audio/yas_audio_rendering_converter.h>
 #include <audio/yas_audio_rendering_graph.h>
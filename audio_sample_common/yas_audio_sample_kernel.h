@@ -5,7 +5,6 @@
 #pragma once
 
 #include <audio/yas_audio_umbrella.h>
-#include <Accelerate/Accelerate.h>
 
 namespace yas::audio::sample {
     class kernel;
@@ -61,12 +60,7 @@ struct kernel {
                 if (input_buffer->frame_length() >= frame_length) {
                     output_buffer->copy_from(*input_buffer);
 
-                    float const throughVol = through_volume();
-
-                    auto each = audio::make_each_data<float>(*output_buffer);
-                    while (yas_each_data_next_ch(each)) {
-                        cblas_sscal(frame_length, throughVol, yas_each_data_ptr(each), 1);
-                    }
+                    output_buffer->apply_gain(through_volume());
                 }
             }
 
@@ -79,9 +73,9 @@ struct kernel {
                 _phase = audio::math::fill_sine(&_sine_data[0], frame_length, start_phase,
                                                 freq / sample_rate * audio::math::two_pi);
 
-                auto each = audio::make_each_data<float>(*output_buffer);
-                while (yas_each_data_next_ch(each)) {
-                    cblas_saxpy(frame_length, sine_vol, &_sine_data[0], 1, yas_each_data_ptr(each), 1);
+                auto each = audio::make_each_block<float>(*output_buffer);
+                while (each.next()) {
+                    audio::dsp::mix(&_sine_data[0], each.data(), each.length(), sine_vol);
                 }
             }
         }
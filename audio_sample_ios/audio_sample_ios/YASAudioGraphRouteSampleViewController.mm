@@ -239,11 +239,10 @@ struct route_vc_cpp {
         double const start_phase = phase;
         double const phase_per_frame = 1000.0 / buffer->format().sample_rate() * audio::math::two_pi;
 
-        auto each = audio::make_each_data<float>(*buffer);
-        auto const length = buffer->frame_length();
+        auto each = audio::make_each_block<float>(*buffer);
 
-        while (yas_each_data_next_ch(each)) {
-            phase = audio::math::fill_sine(yas_each_data_ptr(each), length, start_phase, phase_per_frame);
+        while (each.next()) {
+            phase = audio::math::fill_sine(each.data(), each.length(), start_phase, phase_per_frame);
         }
     };
 
@@ -36,13 +36,12 @@ struct input_tap_vc_cpp {
         input_tap->set_render_handler([input_level = input_level](audio::node_input_render_args const &args) mutable {
             auto const &buffer = args.buffer;
 
-            auto each = audio::make_each_data<float>(*buffer);
             int const frame_length = buffer->frame_length();
             float level = 0;
 
-            while (yas_each_data_next_ch(each)) {
-                auto const *const ptr = yas_each_data_ptr(each);
-                level = std::max(fabsf(ptr[cblas_isamax(frame_length, ptr, 1)]), level);
+            uint32_t const channel_count = buffer->format().channel_count();
+            for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                level = std::max(buffer->peak(ch_idx), level);
             }
 
             double const sample_rate = buffer->format().sample_rate();
@@ -3,7 +3,6 @@
 //
 
 #import "YASAudioRouteSampleViewController.h"
-#import <Accelerate/Accelerate.h>
 #import <audio/yas_audio_umbrella.h>
 #import <cpp_utils/yas_objc_ptr.h>
 #import <objc_utils/yas_objc_macros.h>
@@ -192,14 +191,12 @@ struct graph_io_vc_cpp {
         buffer->clear();
 
         double const start_phase = next_phase;
-        auto const frame_length = buffer->frame_length();
         double const phase_per_frame = 1000.0 / buffer->format().sample_rate() * audio::math::two_pi;
-        auto each = audio::make_each_data<float>(*buffer);
-        while (yas_each_data_next_ch(each)) {
-            auto *const ptr = yas_each_data_ptr(each);
-            next_phase = audio::math::fill_sine(ptr, frame_length, start_phase, phase_per_frame);
-            cblas_sscal(buffer->frame_length(), 0.1, ptr, 1);
+        auto each = audio::make_each_block<float>(*buffer);
+        while (each.next()) {
+            next_phase = audio::math::fill_sine(each.data(), each.length(), start_phase, phase_per_frame);
         }
+        buffer->apply_gain(0.1f);
     };
 
     self->_cpp->tap->set_render_handler(render_handler);
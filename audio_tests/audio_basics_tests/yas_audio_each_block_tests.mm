@@ -0,0 +1,157 @@
+//
+//  yas_audio_each_block_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::each_block {
+static uint32_t constexpr measure_length = 512;
+}  // namespace yas::test::each_block
+
+@interface yas_audio_each_block_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_each_block_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_each_channel {
+    audio::pcm_buffer buffer{test::make_format(audio::pcm_format::float32, 3, false), 10};
+
+    std::vector<uint32_t> channels;
+
+    auto each = audio::make_each_block<float>(buffer);
+    while (each.next()) {
+        XCTAssertEqual(each.data(), buffer.data_ptr_at_channel<float>(each.channel()));
+        XCTAssertEqual(each.frame(), 0);
+        XCTAssertEqual(each.length(), 10);
+        XCTAssertEqual(each.stride(), 1);
+        channels.push_back(each.channel());
+    }
+
+    XCTAssertTrue(channels == (std::vector<uint32_t>{0, 1, 2}));
+    XCTAssertFalse(each.next());
+}
+
+- (void)test_each_block {
+    audio::pcm_buffer buffer{test::make_format(audio::pcm_format::float32, 2, false), 10};
+
+    std::vector<std::pair<uint32_t, uint32_t>> blocks;
+
+    // rounded up to the simd width
+    auto each = audio::make_each_block<float>(std::as_const(buffer), 3);
+    while (each.next()) {
+        XCTAssertEqual(each.data(), buffer.data_ptr_at_channel<float>(each.channel()) + each.frame());
+        blocks.emplace_back(each.frame(), each.length());
+    }
+
+    XCTAssertEqual(blocks.size(), 6);
+    XCTAssertTrue(blocks.at(0) == std::make_pair(uint32_t(0), uint32_t(4)));
+    XCTAssertTrue(blocks.at(1) == std::make_pair(uint32_t(4), uint32_t(4)));
+    XCTAssertTrue(blocks.at(2) == std::make_pair(uint32_t(8), uint32_t(2)));
+    XCTAssertTrue(blocks.at(3) == std::make_pair(uint32_t(0), uint32_t(4)));
+}
+
+- (void)test_each_block_interleaved {
+    audio::pcm_buffer buffer{test::make_format(audio::pcm_format::int16, 2, true), 5};
+    test::fill_test_values_to_buffer(buffer);
+
+    std::vector<int16_t> values;
+
+    auto each = audio::make_each_block<int16_t>(std::as_const(buffer), 4);
+    while (each.next()) {
+        XCTAssertEqual(each.stride(), 2);
+        for (uint32_t idx = 0; idx < each.length(); ++idx) {
+            values.push_back(each.data()[idx * each.stride()]);
+        }
+    }
+
+    int16_t const *const data = buffer.data_ptr_at_index<int16_t>(0);
+    XCTAssertTrue(values == (std::vector<int16_t>{data[0], data[2], data[4], data[6], data[8], data[1], data[3],
+                                                   data[5], data[7], data[9]}));
+}
+
+- (void)test_empty {
+    audio::pcm_buffer buffer{test::make_format(audio::pcm_format::float32, 2, false), 4};
+    buffer.set_frame_length(0);
+
+    auto each = audio::make_each_block<float>(buffer);
+    XCTAssertFalse(each.next());
+}
+
+- (void)test_invalid_pcm_format {
+    audio::pcm_buffer buffer{test::make_format(audio::pcm_format::float32, 2, false), 4};
+
+    XCTAssertThrows(audio::make_each_block<int16_t>(buffer));
+}
+
+- (void)test_without_allocation {
+    audio::pcm_buffer buffer{test::make_format(audio::pcm_format::float32, 8, false), 64};
+
+    uint32_t block_count = 0;
+    std::size_t allocation_count = 0;
+
+    {
+        test::allocation_counter counter;
+
+        auto each = audio::make_each_block<float>(buffer, 16);
+        while (each.next()) {
+            ++block_count;
+        }
+
+        allocation_count = counter.count();
+    }
+
+    XCTAssertEqual(block_count, 32);
+    XCTAssertEqual(allocation_count, 0);
+}
+
+- (void)test_measure_each_data {
+    auto buffer = std::make_shared<audio::pcm_buffer>(
+        test::make_format(audio::pcm_format::float32, 2, false), test::each_block::measure_length);
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            auto each = audio::make_each_data<float>(*buffer);
+            while (yas_each_data_next(each)) {
+                yas_each_data_value(each) *= 0.5f;
+            }
+        }
+    }];
+}
+
+- (void)test_measure_each_block {
+    auto buffer = std::make_shared<audio::pcm_buffer>(
+        test::make_format(audio::pcm_format::float32, 2, false), test::each_block::measure_length);
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            auto each = audio::make_each_block<float>(*buffer, 64);
+            while (each.next()) {
+                float *const data = each.data();
+                uint32_t const length = each.length();
+                uint32_t const simd_length = length - length % audio::simd::float4_count;
+                audio::simd::float4 const half = audio::simd::splat(0.5f);
+
+                uint32_t frame = 0;
+                for (; frame < simd_length; frame += audio::simd::float4_count) {
+                    audio::simd::store(&data[frame], audio::simd::mul(audio::simd::load(&data[frame]), half));
+                }
+                for (; frame < length; ++frame) {
+                    data[frame] *= 0.5f;
+                }
+            }
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,154 @@
+//
+//  yas_audio_executor_tests.mm
+//
+
+#import <atomic>
+#import <future>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_executor_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_executor_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    audio::set_control_executor(nullptr);
+
+    [super tearDown];
+}
+
+- (void)test_main_executor {
+    auto const executor = audio::main_executor::make_shared();
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"perform"];
+    bool is_main_thread = false;
+
+    executor->perform([expectation, &is_main_thread] {
+        is_main_thread = [NSThread isMainThread];
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    XCTAssertTrue(is_main_thread);
+}
+
+- (void)test_thread_pool_executor_serial {
+    auto const executor = audio::thread_pool_executor::make_shared();
+
+    XCTAssertEqual(executor->thread_count(), 1);
+
+    std::vector<uint32_t> performed;
+    std::promise<bool> promise;
+
+    for (uint32_t idx = 0; idx < 100; ++idx) {
+        executor->perform([&performed, idx] { performed.push_back(idx); });
+    }
+    executor->perform([&promise] { promise.set_value([NSThread isMainThread]); });
+
+    XCTAssertFalse(promise.get_future().get());
+
+    XCTAssertEqual(performed.size(), 100);
+    XCTAssertTrue(std::is_sorted(performed.begin(), performed.end()));
+
+    XCTAssertThrows(audio::thread_pool_executor::make_shared(0));
+}
+
+- (void)test_thread_pool_executor_drain {
+    std::atomic<uint32_t> count{0};
+
+    {
+        auto const executor = audio::thread_pool_executor::make_shared(4);
+
+        XCTAssertEqual(executor->thread_count(), 4);
+
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            executor->perform([&count] { ++count; });
+        }
+    }
+
+    XCTAssertEqual(count, 1000);
+}
+
+- (void)test_thread_pool_executor_released_in_handler {
+    auto executor = audio::thread_pool_executor::make_shared();
+    auto holder = std::make_shared<audio::thread_pool_executor_ptr>(executor);
+    std::promise<void> opened;
+    std::promise<void> released;
+    std::promise<void> performed;
+
+    executor->perform([future = opened.get_future().share()] { future.wait(); });
+    executor->perform([holder, &released] {
+        // the last reference is released on the thread of the executor.
+        holder->reset();
+        released.set_value();
+    });
+    executor->perform([&performed] { performed.set_value(); });
+
+    executor = nullptr;
+    opened.set_value();
+
+    released.get_future().get();
+    XCTAssertTrue(performed.get_future().wait_for(std::chrono::seconds(1)) == std::future_status::ready);
+}
+
+- (void)test_control_executor {
+    XCTAssertTrue(std::dynamic_pointer_cast<audio::main_executor>(audio::control_executor()) != nullptr);
+
+    auto const executor = audio::thread_pool_executor::make_shared();
+    audio::set_control_executor(executor);
+
+    XCTAssertEqual(audio::control_executor(), executor);
+
+    audio::set_control_executor(nullptr);
+
+    XCTAssertTrue(std::dynamic_pointer_cast<audio::main_executor>(audio::control_executor()) != nullptr);
+}
+
+- (void)test_offline_completion_without_run_loop {
+    audio::set_control_executor(audio::thread_pool_executor::make_shared());
+
+    auto const format = audio::format({.sample_rate = 44100, .channel_count = 2});
+    std::promise<bool> promise;
+    std::atomic<bool> is_main_thread{true};
+
+    auto const device = audio::offline_device::make_shared(
+        format,
+        [count = uint32_t(0)](audio::offline_render_args) mutable {
+            return ++count < 4 ? audio::continuation::keep : audio::continuation::abort;
+        },
+        [&promise, &is_main_thread](bool const cancelled) {
+            is_main_thread = [NSThread isMainThread];
+            promise.set_value(cancelled);
+        });
+
+    auto const io_core = device->make_io_core();
+    io_core->set_render_handler([](audio::io_render_args) {});
+    io_core->set_maximum_frames_per_slice(512);
+
+    XCTAssertTrue(io_core->start());
+
+    XCTAssertFalse(promise.get_future().get());
+    XCTAssertFalse(is_main_thread);
+}
+
+- (void)test_measure_thread_pool_executor {
+    auto const executor = audio::thread_pool_executor::make_shared();
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            std::promise<void> promise;
+            executor->perform([&promise] { promise.set_value(); });
+            promise.get_future().get();
+        }
+    }];
+}
+
+@end
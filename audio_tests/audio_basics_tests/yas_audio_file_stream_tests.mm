@@ -0,0 +1,238 @@
+//
+//  yas_audio_file_stream_tests.mm
+//
+
+#import <thread>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::file_stream {
+static std::string const dir_name = "yas_audio_file_stream_test_files";
+
+static bool is_cleared(audio::pcm_buffer const &buffer, uint32_t const begin_frame) {
+    for (uint32_t ch_idx = 0; ch_idx < buffer.format().channel_count(); ++ch_idx) {
+        float const *const data = buffer.data_ptr_at_channel<float>(ch_idx);
+        for (uint32_t idx = begin_frame; idx < buffer.frame_length(); ++idx) {
+            if (data[idx] != 0.0f) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// waits until the read-ahead is filled or has the rest of the file.
+static void wait_read_ahead(audio::file_stream_ptr const &stream) {
+    for (uint32_t count = 0; count < 1000 && stream->read_ahead_ratio(); ++count) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+}  // namespace yas::test::file_stream
+
+@interface yas_audio_file_stream_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_file_stream_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::setup_test_directory(test::file_stream::dir_name);
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared_failed {
+    auto const url = test::write_test_file(test::file_stream::dir_name, "failed.wav", audio::file_type::wave,
+                                           test::make_file_format(1, 32, true), 100);
+    auto const file = audio::file::make_opened({.file_url = url}).value();
+    auto const pool = audio::file_stream_pool::make_shared({});
+
+    XCTAssertThrows(audio::file_stream::make_shared({.file = file}));
+    XCTAssertThrows(audio::file_stream::make_shared({.file = nullptr, .pool = pool}));
+    XCTAssertThrows(audio::file_stream::make_shared({.file = file, .pool = pool, .read_ahead_frame_capacity = 1}));
+}
+
+- (void)test_render_to_end {
+    auto const url = test::write_test_file(test::file_stream::dir_name, "render.wav", audio::file_type::wave,
+                                           test::make_file_format(2, 32, true), 1000);
+    auto const pool = audio::file_stream_pool::make_shared({});
+    auto const stream = audio::file_stream::make_shared(
+        {.file = audio::file::make_opened({.file_url = url}).value(), .pool = pool, .read_ahead_frame_capacity = 4096});
+
+    XCTAssertEqual(pool->stream_count(), 1);
+    XCTAssertEqual(stream->format(),
+                   audio::format({.sample_rate = test::sample_rate, .channel_count = 2}));
+
+    audio::pcm_buffer buffer{stream->format(), 600};
+
+    stream->render(buffer);
+
+    XCTAssertEqual(buffer.frame_length(), 600);
+    XCTAssertTrue(test::file_stream::is_cleared(buffer, 0));
+    XCTAssertEqual(stream->statistics().render_count, 0);
+
+    test::file_stream::wait_read_ahead(stream);
+
+    XCTAssertTrue(stream->is_ended());
+
+    stream->play();
+    stream->render(buffer);
+
+    XCTAssertEqual(buffer.frame_length(), 600);
+    XCTAssertTrue(test::is_filled_file_values(buffer, 0, 600));
+
+    stream->render(buffer);
+
+    XCTAssertEqual(buffer.frame_length(), 600);
+    XCTAssertTrue(test::is_filled_file_values(buffer, 600, 400));
+    XCTAssertTrue(test::file_stream::is_cleared(buffer, 400));
+
+    auto const statistics = stream->statistics();
+
+    XCTAssertEqual(statistics.render_count, 2);
+    XCTAssertEqual(statistics.rendered_frame_count, 1000);
+    XCTAssertEqual(statistics.underrun_count, 0);
+    XCTAssertEqual(statistics.prefetch_frame_length, 400);
+    XCTAssertEqual(statistics.minimum_prefetch_frame_length, 400);
+}
+
+- (void)test_seek {
+    auto const url = test::write_test_file(test::file_stream::dir_name, "seek.wav", audio::file_type::wave,
+                                           test::make_file_format(1, 32, true), 1000);
+    auto const pool = audio::file_stream_pool::make_shared({});
+    auto const stream =
+        audio::file_stream::make_shared({.file = audio::file::make_opened({.file_url = url}).value(), .pool = pool});
+
+    audio::pcm_buffer buffer{stream->format(), 100};
+
+    stream->seek(300);
+    test::file_stream::wait_read_ahead(stream);
+    stream->play();
+    stream->render(buffer);
+
+    XCTAssertTrue(test::is_filled_file_values(buffer, 300, 100));
+
+    stream->seek(-100);
+
+    XCTAssertFalse(stream->is_ended());
+
+    test::file_stream::wait_read_ahead(stream);
+    stream->render(buffer);
+
+    XCTAssertTrue(test::is_filled_file_values(buffer, 0, 100));
+    XCTAssertEqual(stream->statistics().underrun_count, 0);
+}
+
+- (void)test_seek_while_rendering {
+    auto const url = test::write_test_file(test::file_stream::dir_name, "seek_rendering.wav", audio::file_type::wave,
+                                           test::make_file_format(1, 32, true), 1000);
+    auto const pool = audio::file_stream_pool::make_shared({.interval = std::chrono::milliseconds{1000}});
+    auto const stream =
+        audio::file_stream::make_shared({.file = audio::file::make_opened({.file_url = url}).value(), .pool = pool});
+
+    audio::pcm_buffer buffer{stream->format(), 100};
+
+    test::file_stream::wait_read_ahead(stream);
+    stream->play();
+
+    stream->seek(500);
+    // the read-ahead before the seek is not rendered.
+    stream->render(buffer);
+
+    XCTAssertEqual(buffer.frame_length(), 100);
+    XCTAssertFalse(test::is_filled_file_values(buffer, 0, 1));
+}
+
+- (void)test_looping {
+    auto const url = test::write_test_file(test::file_stream::dir_name, "looping.wav", audio::file_type::wave,
+                                           test::make_file_format(1, 32, true), 300);
+    auto const pool = audio::file_stream_pool::make_shared({});
+    auto const stream = audio::file_stream::make_shared({.file = audio::file::make_opened({.file_url = url}).value(),
+                                                         .pool = pool,
+                                                         .read_ahead_frame_capacity = 2048,
+                                                         .is_looping = true});
+
+    audio::pcm_buffer buffer{stream->format(), 500};
+
+    test::file_stream::wait_read_ahead(stream);
+
+    XCTAssertFalse(stream->is_ended());
+
+    stream->play();
+    stream->render(buffer);
+
+    XCTAssertTrue(test::is_filled_file_values(buffer, 0, 300));
+
+    float const *const data = buffer.data_ptr_at_channel<float>(0);
+    XCTAssertEqual(data[300], test::file_value(0, 0));
+    XCTAssertEqual(data[499], test::file_value(199, 0));
+}
+
+- (void)test_release_stream {
+    auto const url = test::write_test_file(test::file_stream::dir_name, "release.wav", audio::file_type::wave,
+                                           test::make_file_format(1, 32, true), 100);
+    auto const pool = audio::file_stream_pool::make_shared({});
+
+    {
+        auto const file = audio::file::make_opened({.file_url = url}).value();
+        auto const stream = audio::file_stream::make_shared({.file = file, .pool = pool});
+
+        XCTAssertEqual(pool->stream_count(), 1);
+    }
+
+    // a worker reading the stream holds it until the read returns.
+    for (uint32_t count = 0; count < 1000 && pool->stream_count() > 0; ++count) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    XCTAssertEqual(pool->stream_count(), 0);
+}
+
+// the renders run faster than the real time, so the workers are waited for at every refill length. the read-ahead has
+// the capacity less a chunk when the wait returns and the renders between the waits do not underrun.
+- (void)test_measure_many_streams {
+    uint32_t const stream_count = 64;
+    uint32_t const slice_length = 512;
+    uint32_t const refill_frame_length = 32768;
+    auto const url = test::write_test_file(test::file_stream::dir_name, "measure.wav", audio::file_type::wave,
+                                           test::make_file_format(2, 32, true), 48000 * 10);
+
+    [self measureBlock:^{
+        auto const pool = audio::file_stream_pool::make_shared({.worker_count = 4});
+        std::vector<audio::file_stream_ptr> streams;
+        for (uint32_t idx = 0; idx < stream_count; ++idx) {
+            streams.emplace_back(audio::file_stream::make_shared(
+                {.file = audio::file::make_opened({.file_url = url, .mapped = true}).value(), .pool = pool}));
+            test::file_stream::wait_read_ahead(streams.back());
+            streams.back()->play();
+        }
+
+        audio::pcm_buffer buffer{streams.front()->format(), slice_length};
+
+        for (uint32_t frame = 0; frame < 48000 * 10; frame += slice_length) {
+            if (frame % refill_frame_length == 0) {
+                for (auto const &stream : streams) {
+                    test::file_stream::wait_read_ahead(stream);
+                }
+            }
+
+            for (auto const &stream : streams) {
+                buffer.set_frame_length(slice_length);
+                stream->render(buffer);
+            }
+        }
+
+        uint64_t underrun_count = 0;
+        for (auto const &stream : streams) {
+            underrun_count += stream->statistics().underrun_count;
+        }
+        XCTAssertEqual(underrun_count, 0);
+    }];
+}
+
+@end
@@ -149,6 +149,7 @@ static void setupDirectory() {
 
         XCTAssertEqual(file->url(), file_url);
         XCTAssertEqual(file->file_type(), audio::file_type::wave);
+        XCTAssertTrue(file->is_native());
         auto const &file_format = file->file_format();
         XCTAssertEqual(file_format.buffer_count(), 1);
         XCTAssertEqual(file_format.channel_count(), 2);
@@ -165,6 +166,7 @@ static void setupDirectory() {
 
         XCTAssertEqual(file->url(), file_url);
         XCTAssertEqual(file->file_type(), audio::file_type::wave);
+        XCTAssertTrue(file->is_native());
         auto const &file_format = file->file_format();
         XCTAssertEqual(file_format.buffer_count(), 1);
         XCTAssertEqual(file_format.channel_count(), 2);
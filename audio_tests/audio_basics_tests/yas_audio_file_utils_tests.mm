@@ -125,6 +125,9 @@ using namespace yas;
     XCTAssertEqual(audio::to_file_type(kAudioFileMPEG4Type), audio::file_type::mpeg4);
     XCTAssertEqual(audio::to_file_type(kAudioFileM4AType), audio::file_type::apple_m4a);
     XCTAssertEqual(audio::to_file_type(kAudioFileWAVEType), audio::file_type::wave);
+    XCTAssertEqual(audio::to_file_type(kAudioFileRF64Type), audio::file_type::rf64);
+    XCTAssertEqual(audio::to_file_type('BW64'), audio::file_type::bw64);
+    XCTAssertEqual(audio::to_file_type(kAudioFileWave64Type), audio::file_type::wave64);
 
     XCTAssertThrows(audio::to_file_type(0));
 }
@@ -142,6 +145,9 @@ using namespace yas;
     XCTAssertEqual(audio::to_file_type(to_string(audio::file_type::mpeg4)), audio::file_type::mpeg4);
     XCTAssertEqual(audio::to_file_type(to_string(audio::file_type::apple_m4a)), audio::file_type::apple_m4a);
     XCTAssertEqual(audio::to_file_type(to_string(audio::file_type::wave)), audio::file_type::wave);
+    XCTAssertEqual(audio::to_file_type(to_string(audio::file_type::rf64)), audio::file_type::rf64);
+    XCTAssertEqual(audio::to_file_type(to_string(audio::file_type::bw64)), audio::file_type::bw64);
+    XCTAssertEqual(audio::to_file_type(to_string(audio::file_type::wave64)), audio::file_type::wave64);
 
     XCTAssertThrows(audio::to_file_type(""));
 }
@@ -158,6 +164,9 @@ using namespace yas;
     XCTAssertEqual(to_string(audio::file_type::mpeg4), "public.mpeg-4");
     XCTAssertEqual(to_string(audio::file_type::apple_m4a), "com.apple.m4a-audio");
     XCTAssertEqual(to_string(audio::file_type::wave), "com.microsoft.waveform-audio");
+    XCTAssertEqual(to_string(audio::file_type::rf64), "org.ebu.rf64-audio");
+    XCTAssertEqual(to_string(audio::file_type::bw64), "org.itu.bw64-audio");
+    XCTAssertEqual(to_string(audio::file_type::wave64), "com.sony.wave64-audio");
 }
 
 @end
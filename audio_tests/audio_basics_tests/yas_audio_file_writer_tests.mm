@@ -0,0 +1,165 @@
+//
+//  yas_audio_file_writer_tests.mm
+//
+
+#import <thread>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::file_writer {
+static std::string const dir_name = "yas_audio_file_writer_test_files";
+}  // namespace yas::test::file_writer
+
+@interface yas_audio_file_writer_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_file_writer_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::setup_test_directory(test::file_writer::dir_name);
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared_failed {
+    XCTAssertThrows(audio::file_writer::make_shared({}));
+}
+
+- (void)test_push_and_finish {
+    auto const file = test::make_created_test_file(test::file_writer::dir_name, "push.wav",
+                                                   audio::wave_file_settings(test::sample_rate, 2, 16));
+    auto const writer = audio::file_writer::make_shared({.file = file,
+                                                         .queue_frame_capacity = 4096,
+                                                         .write_frame_length = 1000,
+                                                         .sync_policy = audio::file_writer::sync::finished,
+                                                         .interval = std::chrono::milliseconds{1}});
+
+    audio::pcm_buffer buffer{file->processing_format(), 256};
+    uint32_t const push_count = 100;
+
+    std::thread render_thread{[&writer, &buffer] {
+        for (uint32_t idx = 0; idx < push_count; ++idx) {
+            test::fill_file_values(buffer, idx * 256);
+            while (!writer->push(buffer)) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+    }};
+
+    render_thread.join();
+    writer->finish();
+
+    XCTAssertTrue(writer->is_finished());
+    XCTAssertFalse(writer->write_error());
+    XCTAssertFalse(writer->push(buffer));
+
+    auto const statistics = writer->statistics();
+
+    XCTAssertEqual(statistics.pushed_frame_count, push_count * 256);
+    XCTAssertEqual(statistics.written_frame_count, push_count * 256);
+    XCTAssertEqual(statistics.queue_frame_length, 0);
+    XCTAssertEqual(statistics.sync_count, 1);
+    XCTAssertGreaterThan(statistics.maximum_queue_frame_length, 0);
+
+    file->close();
+
+    auto const reading_file = audio::file::make_opened({.file_url = file->url()}).value();
+
+    XCTAssertEqual(reading_file->file_length(), push_count * 256);
+
+    audio::pcm_buffer reading_buffer{reading_file->processing_format(), push_count * 256};
+
+    XCTAssertTrue(reading_file->read_into_buffer(reading_buffer));
+    XCTAssertTrue(test::is_filled_file_values(reading_buffer, 0));
+}
+
+- (void)test_drop {
+    auto const file = test::make_created_test_file(test::file_writer::dir_name, "drop.wav",
+                                                   audio::wave_file_settings(test::sample_rate, 1, 16));
+    auto const writer = audio::file_writer::make_shared(
+        {.file = file, .queue_frame_capacity = 1024, .interval = std::chrono::milliseconds{1000}});
+
+    audio::pcm_buffer buffer{file->processing_format(), 1000};
+    test::fill_file_values(buffer, 0);
+
+    XCTAssertTrue(writer->push(buffer));
+    // dropped as a whole.
+    XCTAssertFalse(writer->push(buffer));
+
+    auto const statistics = writer->statistics();
+
+    XCTAssertEqual(statistics.pushed_frame_count, 1000);
+    XCTAssertEqual(statistics.dropped_frame_count, 1000);
+    XCTAssertEqual(statistics.queue_frame_length, 1000);
+    XCTAssertEqual(statistics.maximum_queue_frame_length, 1000);
+
+    // the frames short of a block are written when finished.
+    writer->finish();
+
+    XCTAssertEqual(writer->statistics().written_frame_count, 1000);
+    XCTAssertEqual(file->file_length(), 1000);
+}
+
+- (void)test_periodic_sync {
+    auto const file = test::make_created_test_file(test::file_writer::dir_name, "sync.wav",
+                                                   audio::wave_file_settings(test::sample_rate, 1, 16));
+    auto const writer = audio::file_writer::make_shared({.file = file,
+                                                         .sync_policy = audio::file_writer::sync::periodic,
+                                                         .sync_interval = std::chrono::milliseconds{1},
+                                                         .interval = std::chrono::milliseconds{1}});
+
+    audio::pcm_buffer buffer{file->processing_format(), 100};
+    test::fill_file_values(buffer, 0);
+
+    XCTAssertTrue(writer->push(buffer));
+
+    // the frames short of a block are written before syncing.
+    for (uint32_t count = 0; count < 1000 && writer->statistics().written_frame_count < 100; ++count) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    uint64_t const sync_count = writer->statistics().sync_count;
+
+    for (uint32_t count = 0; count < 1000 && writer->statistics().sync_count == sync_count; ++count) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // the sizes are in the header after syncing.
+    XCTAssertEqual(writer->statistics().written_frame_count, 100);
+    XCTAssertGreaterThan(writer->statistics().sync_count, sync_count);
+    XCTAssertEqual(audio::native_file::make_opened(file->url())->file_length(), 100);
+
+    writer->finish();
+}
+
+- (void)test_measure_push_multichannel {
+    uint32_t const channel_count = 64;
+    uint32_t const slice_length = 512;
+
+    [self measureBlock:^{
+        auto const file = test::make_created_test_file(test::file_writer::dir_name, "measure.wav",
+                                                       audio::wave_file_settings(test::sample_rate, channel_count, 16));
+        auto const writer = audio::file_writer::make_shared({.file = file, .queue_frame_capacity = 96000});
+
+        audio::pcm_buffer buffer{file->processing_format(), slice_length};
+        test::fill_file_values(buffer, 0);
+
+        for (uint32_t frame = 0; frame < 96000 * 10; frame += slice_length) {
+            while (!writer->push(buffer)) {
+                std::this_thread::yield();
+            }
+        }
+
+        writer->finish();
+
+        XCTAssertEqual(writer->statistics().written_frame_count, writer->statistics().pushed_frame_count);
+    }];
+}
+
+@end
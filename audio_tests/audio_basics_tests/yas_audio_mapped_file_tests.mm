@@ -0,0 +1,199 @@
+//
+//  yas_audio_mapped_file_tests.mm
+//
+
+#import <cmath>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::mapped_file {
+static std::string const dir_name = "yas_audio_mapped_file_test_files";
+// over 2^31 bytes of float32 stereo samples.
+static uint32_t const large_frame_length = 270000000;
+}  // namespace yas::test::mapped_file
+
+@interface yas_audio_mapped_file_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_mapped_file_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::setup_test_directory(test::mapped_file::dir_name);
+}
+
+- (void)tearDown {
+    // the large files are not left in the temporary directory.
+    test::remove_test_files(test::mapped_file::dir_name);
+
+    [super tearDown];
+}
+
+- (void)test_make_view {
+    auto const url = test::write_test_file(test::mapped_file::dir_name, "view.wav", audio::file_type::wave,
+                                           test::make_file_format(2, 32, true, false), 1000);
+    auto const mapped_file = audio::mapped_file::make_opened(url);
+
+    XCTAssertTrue(mapped_file);
+    XCTAssertEqual(mapped_file->file_length(), 1000);
+
+    auto view = mapped_file->make_view(100, 300);
+
+    XCTAssertTrue(view.has_value());
+    XCTAssertEqual(view->format().channel_count(), 2);
+    XCTAssertTrue(view->format().is_interleaved());
+    XCTAssertEqual(view->frame_length(), 300);
+    XCTAssertTrue(test::is_filled_file_values(*view, 100));
+
+    XCTAssertTrue(mapped_file->make_view(999, 1));
+    XCTAssertFalse(mapped_file->make_view(999, 2));
+    XCTAssertFalse(mapped_file->make_view(-1, 1));
+    XCTAssertFalse(mapped_file->make_view(0, 0));
+}
+
+- (void)test_read_into_buffer {
+    auto const url = test::write_test_file(test::mapped_file::dir_name, "read.wav", audio::file_type::wave,
+                                           test::make_file_format(3, 24, false, false), 1000);
+    auto const mapped_file = audio::mapped_file::make_opened(url);
+
+    XCTAssertTrue(mapped_file);
+
+    // packed 24 bit is not viewable as a pcm_buffer.
+    XCTAssertEqual(mapped_file->file_format().pcm_format(), audio::pcm_format::other);
+    XCTAssertFalse(mapped_file->make_view(0, 1));
+
+    audio::pcm_buffer buffer{audio::format({.sample_rate = test::sample_rate, .channel_count = 3}), 500};
+
+    XCTAssertTrue(mapped_file->read_into_buffer(buffer, 100, 500));
+    XCTAssertEqual(buffer.frame_length(), 500);
+    XCTAssertTrue(test::is_filled_file_values(buffer, 100));
+
+    XCTAssertTrue(mapped_file->read_into_buffer(buffer, 800, 500));
+    XCTAssertEqual(buffer.frame_length(), 200);
+    XCTAssertTrue(test::is_filled_file_values(buffer, 800));
+
+    XCTAssertTrue(mapped_file->read_into_buffer(buffer, 1000, 500));
+    XCTAssertEqual(buffer.frame_length(), 0);
+
+    XCTAssertFalse(mapped_file->read_into_buffer(buffer, 0, 501));
+}
+
+- (void)test_make_opened_failed {
+    // the samples in the other endianness are read through native_file.
+    auto const url = test::write_test_file(test::mapped_file::dir_name, "big_endian.aiff", audio::file_type::aiff,
+                                           test::make_file_format(1, 16, false, true), 100);
+
+    XCTAssertFalse(audio::mapped_file::make_opened(url));
+    XCTAssertFalse(audio::native_file::make_opened(url, true)->mapping());
+    auto const none_url = test::temporary_test_dir_url(test::mapped_file::dir_name).appending("none.wav");
+    XCTAssertFalse(audio::mapped_file::make_opened(none_url));
+}
+
+- (void)test_file_mapped {
+    auto const url = test::write_test_file(test::mapped_file::dir_name, "file.wav", audio::file_type::wave,
+                                           test::make_file_format(2, 16, false, false), 1000);
+
+    XCTAssertFalse(audio::file::make_opened({.file_url = url}).value()->mapping());
+
+    auto const file = audio::file::make_opened({.file_url = url, .mapped = true}).value();
+
+    XCTAssertTrue(file->is_native());
+    XCTAssertTrue(file->mapping());
+
+    audio::pcm_buffer buffer{file->processing_format(), 600};
+
+    file->set_file_frame_position(200);
+    XCTAssertTrue(file->read_into_buffer(buffer));
+    XCTAssertEqual(buffer.frame_length(), 600);
+    XCTAssertEqual(file->file_frame_position(), 800);
+    XCTAssertTrue(test::is_filled_file_values(buffer, 200));
+
+    XCTAssertTrue(file->read_into_buffer(buffer));
+    XCTAssertEqual(buffer.frame_length(), 200);
+    XCTAssertTrue(test::is_filled_file_values(buffer, 800));
+}
+
+- (void)test_measure_read_deinterleaving {
+    auto const url = test::write_test_file(test::mapped_file::dir_name, "measure_read.wav", audio::file_type::wave,
+                                           test::make_file_format(2, 32, true, false), 48000 * 60);
+
+    [self measureBlock:^{
+        auto const file = audio::file::make_opened({.file_url = url, .mapped = true}).value();
+        file->mapping()->set_access(audio::mapped_file::access::sequential);
+        audio::pcm_buffer buffer{file->processing_format(), 4096};
+        while (file->read_into_buffer(buffer) && buffer.frame_length() > 0) {
+        }
+    }];
+}
+
+// each iteration maps the file again, so the pages are faulted in on the first touch.
+- (void)test_measure_view {
+    auto const url = test::write_test_file(test::mapped_file::dir_name, "measure_view.wav", audio::file_type::wave,
+                                           test::make_file_format(1, 32, true, false), 48000 * 60);
+
+    [self measureBlock:^{
+        auto const mapped_file = audio::mapped_file::make_opened(url);
+        mapped_file->set_access(audio::mapped_file::access::sequential);
+        float sum = 0.0f;
+
+        for (int64_t frame = 0; frame < mapped_file->file_length(); frame += 4096) {
+            uint32_t const length = static_cast<uint32_t>(std::min<int64_t>(4096, mapped_file->file_length() - frame));
+            mapped_file->prefetch(frame + length, 4096);
+            auto const view = mapped_file->make_view(frame, length);
+            float const *const data = view->data_ptr_at_index<float>(0);
+            for (uint32_t idx = 0; idx < length; ++idx) {
+                sum += data[idx];
+            }
+        }
+
+        XCTAssertTrue(std::isfinite(sum));
+    }];
+}
+
+// the written pages are in the page cache, so the reads are warm.
+- (void)test_measure_read_large_file {
+    auto const url =
+        test::write_test_file(test::mapped_file::dir_name, "measure_read_large.wav", audio::file_type::wave,
+                              test::make_file_format(2, 32, true, false), test::mapped_file::large_frame_length);
+
+    [self measureBlock:^{
+        auto const mapped_file = audio::mapped_file::make_opened(url);
+        mapped_file->set_access(audio::mapped_file::access::sequential);
+        audio::pcm_buffer buffer{audio::format({.sample_rate = test::sample_rate, .channel_count = 2}), 4096};
+        int64_t read_length = 0;
+
+        while (mapped_file->read_into_buffer(buffer, read_length, 4096) && buffer.frame_length() > 0) {
+            read_length += buffer.frame_length();
+        }
+
+        XCTAssertEqual(read_length, test::mapped_file::large_frame_length);
+    }];
+}
+
+- (void)test_measure_view_large_file {
+    auto const url =
+        test::write_test_file(test::mapped_file::dir_name, "measure_view_large.wav", audio::file_type::wave,
+                              test::make_file_format(2, 32, true, false), test::mapped_file::large_frame_length);
+
+    [self measureBlock:^{
+        auto const mapped_file = audio::mapped_file::make_opened(url);
+        mapped_file->set_access(audio::mapped_file::access::sequential);
+        float sum = 0.0f;
+
+        for (int64_t frame = 0; frame < mapped_file->file_length(); frame += 4096) {
+            uint32_t const length = static_cast<uint32_t>(std::min<int64_t>(4096, mapped_file->file_length() - frame));
+            auto const view = mapped_file->make_view(frame, length);
+            float const *const data = view->data_ptr_at_index<float>(0);
+            for (uint32_t idx = 0; idx < length * 2; ++idx) {
+                sum += data[idx];
+            }
+        }
+
+        XCTAssertTrue(std::isfinite(sum));
+    }];
+}
+
+@end
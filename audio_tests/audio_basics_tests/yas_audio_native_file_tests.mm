@@ -0,0 +1,317 @@
+//
+//  yas_audio_native_file_tests.mm
+//
+
+#import <unistd.h>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::native_file {
+static std::string const dir_name = "yas_audio_native_file_test_files";
+
+// reads the file with ExtAudioFile in float32 and returns true if the values are equal.
+static bool is_readable_by_ext_audio_file(yas::url const &url, uint32_t const channel_count,
+                                          uint32_t const frame_length) {
+    ExtAudioFileRef ext_audio_file = nullptr;
+    if (!audio::ext_audio_file_utils::open(&ext_audio_file, url.cf_url())) {
+        return false;
+    }
+
+    audio::pcm_buffer buffer{audio::format({.sample_rate = sample_rate, .channel_count = channel_count}),
+                             frame_length};
+    bool result = audio::ext_audio_file_utils::set_client_format(buffer.format().stream_description(), ext_audio_file);
+
+    UInt32 io_frames = frame_length;
+    result = result && ExtAudioFileRead(ext_audio_file, &io_frames, buffer.audio_buffer_list()) == noErr &&
+             io_frames == frame_length;
+    audio::ext_audio_file_utils::dispose(ext_audio_file);
+
+    return result && test::is_filled_file_values(buffer, 0);
+}
+}  // namespace yas::test::native_file
+
+@interface yas_audio_native_file_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_native_file_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::setup_test_directory(test::native_file::dir_name);
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_write_and_read {
+    struct encoding {
+        uint32_t bit_depth;
+        bool is_float;
+        bool is_big_endian;
+    };
+
+    audio::file_type const file_types[] = {audio::file_type::wave, audio::file_type::aiff, audio::file_type::aifc,
+                                           audio::file_type::core_audio_format};
+    encoding const encodings[] = {{16, false, false}, {24, false, false}, {32, false, false}, {32, true, false},
+                                  {64, true, false},  {16, false, true},  {24, false, true},  {32, true, true}};
+    audio::pcm_format const pcm_formats[] = {audio::pcm_format::float32, audio::pcm_format::float64,
+                                             audio::pcm_format::int16, audio::pcm_format::fixed824};
+    uint32_t const frame_length = 2501;
+
+    for (auto const &file_type : file_types) {
+        for (auto const &encoding : encodings) {
+            for (uint32_t const channel_count : {1, 3}) {
+                auto const file_format = test::make_file_format(channel_count, encoding.bit_depth, encoding.is_float,
+                                                                encoding.is_big_endian);
+                auto const file_encoding = audio::native_file_utils::to_encoding(file_format.stream_description());
+                XCTAssertTrue(file_encoding);
+
+                auto const url = test::temporary_test_dir_url(test::native_file::dir_name).appending("write_and_read");
+
+                if (!audio::native_file_utils::is_supported(file_type, *file_encoding)) {
+                    XCTAssertFalse(audio::native_file::make_created(url, file_type, file_format));
+                    continue;
+                }
+
+                test::write_file_values(url, file_type, file_format, frame_length, audio::pcm_format::float64);
+
+                XCTAssertTrue(test::native_file::is_readable_by_ext_audio_file(url, channel_count, frame_length));
+
+                for (auto const &pcm_format : pcm_formats) {
+                    for (bool const interleaved : {false, true}) {
+                        auto const file = audio::native_file::make_opened(url);
+                        XCTAssertTrue(file);
+
+                        auto const &header = file->header();
+                        XCTAssertEqual(header.file_type, file_type);
+                        XCTAssertEqual(header.channel_count, channel_count);
+                        XCTAssertEqual(header.sample_rate, test::sample_rate);
+                        XCTAssertTrue(header.encoding == *file_encoding);
+                        XCTAssertEqual(file->file_length(), frame_length);
+                        XCTAssertEqual(file->file_format().stream_description().mBitsPerChannel, encoding.bit_depth);
+
+                        audio::pcm_buffer buffer{audio::format({.sample_rate = test::sample_rate,
+                                                                .channel_count = channel_count,
+                                                                .pcm_format = pcm_format,
+                                                                .interleaved = interleaved}),
+                                                 frame_length + 1};
+                        XCTAssertTrue(file->read_into_buffer(buffer, frame_length + 1));
+                        XCTAssertEqual(buffer.frame_length(), frame_length);
+                        XCTAssertEqual(file->file_frame_position(), frame_length);
+
+                        audio::pcm_buffer float_buffer{
+                            audio::format({.sample_rate = test::sample_rate, .channel_count = channel_count}),
+                            frame_length};
+                        float_buffer.copy_from(buffer);
+                        XCTAssertTrue(test::is_filled_file_values(float_buffer, 0));
+
+                        XCTAssertTrue(file->set_file_frame_position(100));
+                        XCTAssertTrue(file->read_into_buffer(buffer, 10));
+                        XCTAssertEqual(buffer.frame_length(), 10);
+                        XCTAssertFalse(file->set_file_frame_position(frame_length + 1));
+                    }
+                }
+            }
+        }
+    }
+}
+
+- (void)test_read_ext_audio_file {
+    auto const url = test::temporary_test_dir_url(test::native_file::dir_name).appending("ext_audio_file.wav");
+    uint32_t const frame_length = 1000;
+
+    {
+        auto const file_format = test::make_file_format(6, 24, false, false);
+        ExtAudioFileRef ext_audio_file = nullptr;
+        XCTAssertTrue(audio::ext_audio_file_utils::create(&ext_audio_file, url.cf_url(), kAudioFileWAVEType,
+                                                          file_format.stream_description()));
+
+        audio::pcm_buffer buffer{audio::format({.sample_rate = test::sample_rate,
+                                                .channel_count = 6,
+                                                .pcm_format = audio::pcm_format::float64}),
+                                 frame_length};
+        test::fill_file_values(buffer, 0);
+        XCTAssertTrue(
+            audio::ext_audio_file_utils::set_client_format(buffer.format().stream_description(), ext_audio_file));
+        XCTAssertEqual(ExtAudioFileWrite(ext_audio_file, frame_length, buffer.audio_buffer_list()), noErr);
+        audio::ext_audio_file_utils::dispose(ext_audio_file);
+    }
+
+    auto const file = audio::native_file::make_opened(url);
+    XCTAssertTrue(file);
+    XCTAssertEqual(file->header().file_type, audio::file_type::wave);
+    XCTAssertTrue(file->header().encoding ==
+                  (audio::native_file_encoding{.sample_type = audio::dsp::sample_type::int24, .is_big_endian = false}));
+    XCTAssertEqual(file->file_length(), frame_length);
+
+    audio::pcm_buffer buffer{audio::format({.sample_rate = test::sample_rate, .channel_count = 6}), frame_length};
+    XCTAssertTrue(file->read_into_buffer(buffer, frame_length));
+    XCTAssertTrue(test::is_filled_file_values(buffer, 0));
+}
+
+- (void)test_file_uses_native_file {
+    auto const url = test::temporary_test_dir_url(test::native_file::dir_name).appending("file.caf");
+    auto const settings = audio::linear_pcm_file_settings(48000.0, 2, 32, false, true, false);
+
+    {
+        auto const file = audio::file::make_created({.file_url = url,
+                                                     .file_type = audio::file_type::core_audio_format,
+                                                     .settings = settings})
+                              .value();
+        XCTAssertTrue(file->is_native());
+
+        audio::pcm_buffer buffer{file->processing_format(), 100};
+        buffer.set_frame_length(100);
+        XCTAssertTrue(file->write_from_buffer(buffer));
+        XCTAssertEqual(file->file_frame_position(), 100);
+
+        // the written frames are not resampled.
+        file->set_processing_format(audio::format({.sample_rate = 44100.0, .channel_count = 2}));
+        XCTAssertTrue(file->is_native());
+        audio::pcm_buffer resampled_buffer{file->processing_format(), 100};
+        XCTAssertEqual(file->write_from_buffer(resampled_buffer).error(), audio::file::write_error_t::invalid_format);
+    }
+
+    auto const file = audio::file::make_opened({.file_url = url}).value();
+    XCTAssertTrue(file->is_native());
+    XCTAssertEqual(file->file_type(), audio::file_type::core_audio_format);
+    XCTAssertEqual(file->file_length(), 100);
+
+    // ExtAudioFile resamples instead.
+    file->set_processing_format(audio::format({.sample_rate = 44100.0, .channel_count = 2}));
+    XCTAssertFalse(file->is_native());
+    XCTAssertTrue(file->is_opened());
+    XCTAssertEqualWithAccuracy(file->processing_length(), 92, 1);
+}
+
+- (void)test_extended {
+    uint8_t bytes[10];
+
+    audio::native_file_utils::to_extended_from_float64(44100.0, bytes);
+    uint8_t const expected[10] = {0x40, 0x0E, 0xAC, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    XCTAssertEqual(memcmp(bytes, expected, 10), 0);
+
+    for (double const value : {8000.0, 48000.0, 382000.0, 11025.5}) {
+        audio::native_file_utils::to_extended_from_float64(value, bytes);
+        XCTAssertEqual(audio::native_file_utils::to_float64_from_extended(bytes), value);
+    }
+}
+
+- (void)test_rf64 {
+    audio::native_file_header header{.file_type = audio::file_type::wave,
+                                     .sample_rate = 96000.0,
+                                     .channel_count = 64,
+                                     .encoding = {.sample_type = audio::dsp::sample_type::float32}};
+
+    auto const riff_bytes = audio::native_file_utils::make_header_bytes(header);
+
+    XCTAssertEqual(memcmp(&riff_bytes[0], "RIFF", 4), 0);
+    XCTAssertEqual(memcmp(&riff_bytes[12], "JUNK", 4), 0);
+
+    // 5.1 GB of data. the ds64 chunk replaces the junk chunk without moving the data.
+    header.frame_length = 20000000;
+
+    auto const rf64_bytes = audio::native_file_utils::make_header_bytes(header);
+
+    XCTAssertEqual(rf64_bytes.size(), riff_bytes.size());
+    XCTAssertEqual(memcmp(&rf64_bytes[0], "RF64", 4), 0);
+    XCTAssertEqual(memcmp(&rf64_bytes[12], "ds64", 4), 0);
+
+    // the data is sparse.
+    auto const url = test::temporary_test_dir_url(test::native_file::dir_name).appending("rf64.wav");
+    std::FILE *const file = std::fopen(url.path().c_str(), "wb");
+    std::fwrite(rf64_bytes.data(), 1, rf64_bytes.size(), file);
+    std::fclose(file);
+
+    off_t const file_byte_count = rf64_bytes.size() + header.frame_length * header.frame_byte_count();
+    XCTAssertEqual(truncate(url.path().c_str(), file_byte_count), 0);
+
+    auto const native_file = audio::native_file::make_opened(url);
+
+    XCTAssertTrue(native_file);
+    XCTAssertEqual(native_file->file_length(), 20000000);
+    XCTAssertEqual(native_file->header().data_offset, rf64_bytes.size());
+    XCTAssertTrue(native_file->set_file_frame_position(19999999));
+
+    audio::pcm_buffer buffer{audio::format({.sample_rate = 96000.0, .channel_count = 64}), 2};
+
+    XCTAssertTrue(native_file->read_into_buffer(buffer, 2));
+    XCTAssertEqual(buffer.frame_length(), 1);
+}
+
+- (void)test_rf64_bw64_and_wave64 {
+    struct head {
+        audio::file_type file_type;
+        char const *id;
+        uint32_t data_offset;
+    };
+
+    // 3 channels are written in the extensible format.
+    head const heads[] = {{audio::file_type::rf64, "RF64", 104},
+                          {audio::file_type::bw64, "BW64", 104},
+                          {audio::file_type::wave64, "riff", 128}};
+    auto const file_format = test::make_file_format(3, 24, false, false);
+    uint32_t const frame_length = 2501;
+
+    for (auto const &head : heads) {
+        auto const url = test::temporary_test_dir_url(test::native_file::dir_name).appending("rf64_bw64_and_wave64");
+
+        test::write_file_values(url, head.file_type, file_format, frame_length, audio::pcm_format::float64);
+
+        uint8_t bytes[4];
+        std::FILE *const file = std::fopen(url.path().c_str(), "rb");
+        XCTAssertEqual(std::fread(bytes, 1, 4, file), 4);
+        XCTAssertEqual(std::fseek(file, 0, SEEK_END), 0);
+        long const file_byte_count = std::ftell(file);
+        std::fclose(file);
+
+        XCTAssertEqual(memcmp(bytes, head.id, 4), 0);
+        // the data chunk of wave64 is padded to 8 bytes.
+        XCTAssertEqual(file_byte_count % (head.file_type == audio::file_type::wave64 ? 8 : 2), 0);
+
+        auto const native_file = audio::native_file::make_opened(url);
+
+        XCTAssertTrue(native_file);
+        XCTAssertEqual(native_file->header().file_type, head.file_type);
+        XCTAssertEqual(native_file->header().data_offset, head.data_offset);
+        XCTAssertEqual(native_file->file_length(), frame_length);
+
+        audio::pcm_buffer buffer{audio::format({.sample_rate = test::sample_rate, .channel_count = 3}), frame_length};
+
+        XCTAssertTrue(native_file->read_into_buffer(buffer, frame_length));
+        XCTAssertTrue(test::is_filled_file_values(buffer, 0));
+
+        if (head.file_type != audio::file_type::bw64) {
+            XCTAssertTrue(test::native_file::is_readable_by_ext_audio_file(url, 3, frame_length));
+        }
+    }
+}
+
+- (void)test_measure_read_matching_format {
+    auto const url = test::temporary_test_dir_url(test::native_file::dir_name).appending("measure.wav");
+    uint32_t const frame_length = 48000 * 60;
+
+    {
+        auto const file =
+            audio::native_file::make_created(url, audio::file_type::wave, test::make_file_format(2, 32, true, false));
+        audio::pcm_buffer buffer{
+            audio::format({.sample_rate = test::sample_rate, .channel_count = 2, .interleaved = true}), 4096};
+        for (uint32_t written = 0; written < frame_length; written += buffer.frame_length()) {
+            XCTAssertTrue(file->write_from_buffer(buffer));
+        }
+    }
+
+    [self measureBlock:^{
+        auto const file = audio::native_file::make_opened(url);
+        audio::pcm_buffer buffer{
+            audio::format({.sample_rate = test::sample_rate, .channel_count = 2, .interleaved = true}), 4096};
+        while (file->read_into_buffer(buffer, 4096) && buffer.frame_length() > 0) {
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,214 @@
+//
+//  yas_audio_pcm_ring_buffer_tests.mm
+//
+
+#import <thread>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_pcm_ring_buffer_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_pcm_ring_buffer_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 100);
+
+    XCTAssertTrue(ring->format() == format);
+    XCTAssertEqual(ring->frame_capacity(), 128);
+    XCTAssertEqual(ring->readable_frame_length(), 0);
+    XCTAssertEqual(ring->writable_frame_length(), 128);
+
+    XCTAssertThrows(audio::pcm_ring_buffer::make_shared(format, 0));
+}
+
+- (void)test_write_and_read {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 8);
+
+    audio::pcm_buffer write_buffer{format, 6};
+    audio::pcm_buffer read_buffer{format, 8};
+
+    test::fill_sequence(write_buffer, 0);
+
+    XCTAssertEqual(ring->write(write_buffer).value(), 6);
+    XCTAssertEqual(ring->readable_frame_length(), 6);
+    XCTAssertEqual(ring->writable_frame_length(), 2);
+
+    XCTAssertEqual(ring->read(read_buffer).value(), 6);
+    XCTAssertEqual(read_buffer.frame_length(), 6);
+    XCTAssertTrue(test::is_sequence(read_buffer, 0));
+
+    XCTAssertEqual(ring->read(read_buffer).value(), 0);
+    XCTAssertEqual(read_buffer.frame_length(), 0);
+}
+
+- (void)test_wraparound {
+    auto const format = test::make_format(audio::pcm_format::float32, 3, true);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 8);
+
+    audio::pcm_buffer write_buffer{format, 6};
+    audio::pcm_buffer read_buffer{format, 6};
+
+    test::fill_sequence(write_buffer, 0);
+    XCTAssertEqual(ring->write(write_buffer).value(), 6);
+    XCTAssertEqual(ring->read(read_buffer).value(), 6);
+
+    test::fill_sequence(write_buffer, 100);
+    XCTAssertEqual(ring->write(write_buffer).value(), 6);
+    XCTAssertEqual(ring->read(read_buffer).value(), 6);
+    XCTAssertTrue(test::is_sequence(read_buffer, 100));
+}
+
+- (void)test_write_when_full {
+    auto const format = test::make_format(audio::pcm_format::float32, 1, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 8);
+
+    audio::pcm_buffer write_buffer{format, 6};
+    audio::pcm_buffer read_buffer{format, 8};
+
+    test::fill_sequence(write_buffer, 0);
+
+    XCTAssertEqual(ring->write(write_buffer).value(), 6);
+    XCTAssertEqual(ring->write(write_buffer).value(), 2);
+    XCTAssertEqual(ring->write(write_buffer).value(), 0);
+    XCTAssertEqual(ring->writable_frame_length(), 0);
+
+    XCTAssertEqual(ring->read(read_buffer).value(), 8);
+
+    float const *const data = read_buffer.data_ptr_at_index<float>(0);
+    XCTAssertEqual(data[5], 5.0f);
+    XCTAssertEqual(data[6], 0.0f);
+    XCTAssertEqual(data[7], 1.0f);
+}
+
+- (void)test_write_from_begin_frame {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 8);
+
+    audio::pcm_buffer write_buffer{format, 12};
+    audio::pcm_buffer read_buffer{format, 6};
+
+    test::fill_sequence(write_buffer, 0);
+
+    XCTAssertEqual(ring->write(write_buffer).value(), 8);
+    XCTAssertEqual(ring->read(read_buffer).value(), 6);
+    XCTAssertTrue(test::is_sequence(read_buffer, 0));
+
+    XCTAssertEqual(ring->write(write_buffer, 8).value(), 4);
+    XCTAssertEqual(ring->read(read_buffer).value(), 6);
+    XCTAssertTrue(test::is_sequence(read_buffer, 6));
+
+    XCTAssertEqual(ring->write(write_buffer, 12).value(), 0);
+    XCTAssertFalse(ring->write(write_buffer, 13));
+}
+
+- (void)test_read_frame_length {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 8);
+
+    audio::pcm_buffer write_buffer{format, 8};
+    audio::pcm_buffer read_buffer{format, 8};
+
+    test::fill_sequence(write_buffer, 0);
+
+    XCTAssertEqual(ring->write(write_buffer).value(), 8);
+
+    XCTAssertEqual(ring->read(read_buffer, 3).value(), 3);
+    XCTAssertEqual(read_buffer.frame_length(), 3);
+    XCTAssertTrue(test::is_sequence(read_buffer, 0));
+    XCTAssertEqual(ring->readable_frame_length(), 5);
+
+    XCTAssertFalse(ring->read(read_buffer, 9));
+    XCTAssertEqual(ring->readable_frame_length(), 5);
+
+    XCTAssertEqual(ring->read(read_buffer, 8).value(), 5);
+    XCTAssertTrue(test::is_sequence(read_buffer, 3));
+}
+
+- (void)test_convert_format {
+    auto const ring_format = test::make_format(audio::pcm_format::float64, 2, true);
+    auto const buffer_format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(ring_format, 16);
+
+    audio::pcm_buffer write_buffer{buffer_format, 10};
+    audio::pcm_buffer read_buffer{buffer_format, 10};
+
+    test::fill_sequence(write_buffer, 0);
+
+    XCTAssertEqual(ring->write(write_buffer).value(), 10);
+    XCTAssertEqual(ring->read(read_buffer).value(), 10);
+    XCTAssertTrue(test::is_sequence(read_buffer, 0));
+}
+
+- (void)test_invalid_channel_count {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 8);
+
+    audio::pcm_buffer buffer{test::make_format(audio::pcm_format::float32, 1, false), 4};
+
+    XCTAssertEqual(ring->write(buffer).error(), audio::pcm_buffer::copy_error_t::invalid_format);
+    XCTAssertEqual(ring->read(buffer).error(), audio::pcm_buffer::copy_error_t::invalid_format);
+}
+
+- (void)test_threads {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 256);
+    uint32_t const total_length = 1000000;
+
+    std::thread producer{[&ring, &format, total_length] {
+        audio::pcm_buffer buffer{format, 100};
+        uint32_t written_length = 0;
+
+        while (written_length < total_length) {
+            buffer.set_frame_length(std::min(1 + written_length % 100, total_length - written_length));
+            test::fill_sequence(buffer, written_length);
+            written_length += ring->write(buffer).value();
+        }
+    }};
+
+    audio::pcm_buffer buffer{format, 64};
+    uint32_t read_length = 0;
+    bool is_ordered = true;
+
+    while (read_length < total_length) {
+        uint32_t const length = ring->read(buffer).value();
+        if (length > 0 && !test::is_sequence(buffer, read_length)) {
+            is_ordered = false;
+        }
+        read_length += length;
+    }
+
+    producer.join();
+
+    XCTAssertTrue(is_ordered);
+    XCTAssertEqual(read_length, total_length);
+    XCTAssertEqual(ring->readable_frame_length(), 0);
+}
+
+- (void)test_measure_write_and_read {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const ring = audio::pcm_ring_buffer::make_shared(format, 4096);
+    auto const write_buffer = std::make_shared<audio::pcm_buffer>(format, 512);
+    auto const read_buffer = std::make_shared<audio::pcm_buffer>(format, 512);
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 10000; ++idx) {
+            ring->write(*write_buffer);
+            ring->read(*read_buffer);
+        }
+    }];
+}
+
+@end
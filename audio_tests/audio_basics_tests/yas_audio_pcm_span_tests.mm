@@ -0,0 +1,182 @@
+//
+//  yas_audio_pcm_span_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::pcm_span {
+static uint32_t constexpr measure_length = 512;
+static uint32_t constexpr measure_channel_count = 8;
+}  // namespace yas::test::pcm_span
+
+@interface yas_audio_pcm_span_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_pcm_span_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_is_compatible {
+    auto const float_interleaved =
+        test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, true);
+    auto const float_non_interleaved =
+        test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, false);
+    auto const int16_non_interleaved =
+        test::make_format(audio::pcm_format::int16, test::pcm_span::measure_channel_count, false);
+    auto const fixed824_interleaved =
+        test::make_format(audio::pcm_format::fixed824, test::pcm_span::measure_channel_count, true);
+
+    XCTAssertTrue(audio::interleaved_pcm_span<float>::is_compatible(float_interleaved));
+    XCTAssertFalse(audio::interleaved_pcm_span<float>::is_compatible(float_non_interleaved));
+    XCTAssertTrue(audio::non_interleaved_pcm_span<float const>::is_compatible(float_non_interleaved));
+    XCTAssertFalse(audio::non_interleaved_pcm_span<double>::is_compatible(float_non_interleaved));
+    XCTAssertTrue(audio::non_interleaved_pcm_span<int16_t>::is_compatible(int16_non_interleaved));
+    XCTAssertTrue(audio::interleaved_pcm_span<int32_t>::is_compatible(fixed824_interleaved));
+}
+
+- (void)test_make_failed {
+    auto const format = test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, false);
+    audio::pcm_buffer buffer{format, 4};
+
+    XCTAssertThrows(audio::non_interleaved_pcm_span<double>{buffer});
+    XCTAssertThrows(audio::interleaved_pcm_span<float>{buffer});
+    XCTAssertNoThrow(audio::non_interleaved_pcm_span<float>{buffer});
+}
+
+- (void)test_access_non_interleaved {
+    auto const format = test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, false);
+    audio::pcm_buffer buffer{format, 16};
+    test::fill_test_values_to_buffer(buffer);
+
+    audio::non_interleaved_pcm_span<float const> const span{std::as_const(buffer)};
+
+    XCTAssertEqual(span.channel_count(), 8);
+    XCTAssertEqual(span.frame_length(), 16);
+    XCTAssertEqual(span.stride(), 1);
+
+    for (uint32_t ch_idx = 0; ch_idx < span.channel_count(); ++ch_idx) {
+        XCTAssertEqual(span.data_at_channel(ch_idx), buffer.data_ptr_at_channel<float>(ch_idx));
+
+        uint32_t frame = 0;
+        for (float const &value : span.channel(ch_idx)) {
+            XCTAssertEqual(value, buffer.data_ptr_at_channel<float>(ch_idx)[frame]);
+            XCTAssertEqual(&value, &span.at(ch_idx, frame));
+            ++frame;
+        }
+        XCTAssertEqual(frame, 16);
+    }
+}
+
+- (void)test_access_interleaved {
+    auto const format = test::make_format(audio::pcm_format::int16, test::pcm_span::measure_channel_count, true);
+    audio::pcm_buffer buffer{format, 16};
+    test::fill_test_values_to_buffer(buffer);
+
+    audio::interleaved_pcm_span<int16_t> const span{buffer};
+
+    XCTAssertEqual(span.channel_count(), 8);
+    XCTAssertEqual(span.frame_length(), 16);
+    XCTAssertEqual(span.stride(), 8);
+
+    for (uint32_t ch_idx = 0; ch_idx < span.channel_count(); ++ch_idx) {
+        int16_t const *const data = buffer.data_ptr_at_channel<int16_t>(ch_idx);
+        auto const channel = span.channel(ch_idx);
+
+        XCTAssertEqual(span.data_at_channel(ch_idx), data);
+        XCTAssertEqual(channel.size(), 16);
+        XCTAssertEqual(channel.stride(), 8);
+
+        uint32_t frame = 0;
+        for (int16_t &value : channel) {
+            XCTAssertEqual(value, data[frame * 8]);
+            XCTAssertEqual(channel[frame], data[frame * 8]);
+            value = 0;
+            ++frame;
+        }
+        XCTAssertEqual(frame, 16);
+    }
+
+    for (uint32_t frame = 0; frame < 16; ++frame) {
+        XCTAssertEqual(span.at(7, frame), 0);
+    }
+}
+
+- (void)test_measure_data_ptr_at_channel {
+    auto const format = test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, false);
+    auto buffer = std::make_shared<audio::pcm_buffer>(format, test::pcm_span::measure_length);
+    test::fill_test_values_to_buffer(*buffer);
+
+    [self measureBlock:^{
+        float sum = 0.0f;
+        for (uint32_t idx = 0; idx < 10000; ++idx) {
+            for (uint32_t ch_idx = 0; ch_idx < test::pcm_span::measure_channel_count; ++ch_idx) {
+                sum += buffer->data_ptr_at_channel<float>(ch_idx)[idx % test::pcm_span::measure_length];
+            }
+        }
+        XCTAssertNotEqual(sum, -1.0f);
+    }];
+}
+
+- (void)test_measure_pcm_span {
+    auto const format = test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, false);
+    auto buffer = std::make_shared<audio::pcm_buffer>(format, test::pcm_span::measure_length);
+    test::fill_test_values_to_buffer(*buffer);
+
+    [self measureBlock:^{
+        float sum = 0.0f;
+        for (uint32_t idx = 0; idx < 10000; ++idx) {
+            audio::non_interleaved_pcm_span<float const> const span{std::as_const(*buffer)};
+            for (uint32_t ch_idx = 0; ch_idx < test::pcm_span::measure_channel_count; ++ch_idx) {
+                sum += span.data_at_channel(ch_idx)[idx % test::pcm_span::measure_length];
+            }
+        }
+        XCTAssertNotEqual(sum, -1.0f);
+    }];
+}
+
+- (void)test_measure_each_data {
+    auto const format = test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, true);
+    auto buffer = std::make_shared<audio::pcm_buffer>(format, test::pcm_span::measure_length);
+    test::fill_test_values_to_buffer(*buffer);
+
+    [self measureBlock:^{
+        float sum = 0.0f;
+        for (uint32_t idx = 0; idx < 100; ++idx) {
+            auto each = audio::make_each_data<float>(std::as_const(*buffer));
+            while (yas_each_data_next(each)) {
+                sum += yas_each_data_value(each);
+            }
+        }
+        XCTAssertNotEqual(sum, -1.0f);
+    }];
+}
+
+- (void)test_measure_pcm_span_channels {
+    auto const format = test::make_format(audio::pcm_format::float32, test::pcm_span::measure_channel_count, true);
+    auto buffer = std::make_shared<audio::pcm_buffer>(format, test::pcm_span::measure_length);
+    test::fill_test_values_to_buffer(*buffer);
+
+    [self measureBlock:^{
+        float sum = 0.0f;
+        for (uint32_t idx = 0; idx < 100; ++idx) {
+            audio::interleaved_pcm_span<float const> const span{std::as_const(*buffer)};
+            for (uint32_t ch_idx = 0; ch_idx < span.channel_count(); ++ch_idx) {
+                for (float const &value : span.channel(ch_idx)) {
+                    sum += value;
+                }
+            }
+        }
+        XCTAssertNotEqual(sum, -1.0f);
+    }];
+}
+
+@end
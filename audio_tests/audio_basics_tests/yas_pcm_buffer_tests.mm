@@ -7,6 +7,26 @@
 using namespace yas;
 using namespace yas::audio;
 
+namespace yas::test::pcm_buffer_analysis {
+static uint32_t constexpr measure_length = 512;
+
+static void measure(XCTestCase *test_case, uint32_t const channel_count, bool const is_silent) {
+    audio::format const format{{.sample_rate = 48000.0,
+                                .channel_count = channel_count,
+                                .pcm_format = pcm_format::float32,
+                                .interleaved = true}};
+    auto const buffer = std::make_shared<audio::pcm_buffer>(format, measure_length);
+
+    [test_case measureBlock:^{
+        bool result = true;
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            result &= is_silent ? buffer->is_silent() : buffer->is_empty();
+        }
+        XCTAssertTrue(result);
+    }];
+}
+}  // namespace yas::test::pcm_buffer_analysis
+
 @interface yas_pcm_buffer_tests : XCTestCase
 
 @end
@@ -327,12 +347,12 @@ using namespace yas::audio;
     test(true);
 }
 
-- (void)test_copy_data_flexibly_different_pcm_format_failed {
+- (void)test_copy_data_flexibly_different_pcm_format_converted {
     double const sample_rate = 48000.0;
     uint32_t const frame_length = 4;
     uint32_t const channels = 2;
     auto const from_pcm_format = audio::pcm_format::float32;
-    auto const to_pcm_format = audio::pcm_format::fixed824;
+    auto const to_pcm_format = audio::pcm_format::int16;
 
     auto from_format = audio::format(
         {.sample_rate = sample_rate, .channel_count = channels, .pcm_format = from_pcm_format, .interleaved = false});
@@ -342,7 +362,126 @@ using namespace yas::audio;
     audio::pcm_buffer from_buffer(from_format, frame_length);
     audio::pcm_buffer to_buffer(to_format, frame_length);
 
-    XCTAssertFalse(to_buffer.copy_from(from_buffer));
+    float *const left = from_buffer.data_ptr_at_channel<float>(0);
+    float *const right = from_buffer.data_ptr_at_channel<float>(1);
+    left[0] = 0.5f;
+    left[1] = -0.5f;
+    left[2] = 2.0f;
+    left[3] = 0.0f;
+    right[0] = 0.25f;
+    right[1] = -1.0f;
+    right[2] = 0.0f;
+    right[3] = 1.0f;
+
+    auto const result = to_buffer.copy_from(from_buffer);
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), frame_length);
+
+    int16_t const *const data = to_buffer.data_ptr_at_index<int16_t>(0);
+    XCTAssertEqual(data[0], 16384);
+    XCTAssertEqual(data[1], 8192);
+    XCTAssertEqual(data[2], -16384);
+    XCTAssertEqual(data[3], -32768);
+    XCTAssertEqual(data[4], 32767);
+    XCTAssertEqual(data[5], 0);
+    XCTAssertEqual(data[6], 0);
+    XCTAssertEqual(data[7], 32767);
+
+    audio::pcm_buffer back_buffer(from_format, frame_length);
+    XCTAssertTrue(back_buffer.copy_from(to_buffer));
+    XCTAssertEqual(back_buffer.data_ptr_at_channel<float>(0)[0], 0.5f);
+    XCTAssertEqual(back_buffer.data_ptr_at_channel<float>(1)[1], -1.0f);
+}
+
+- (void)test_copy_data_flexibly_different_pcm_format_with_dither {
+    uint32_t const frame_length = 256;
+    auto from_format = audio::format({.sample_rate = 48000.0, .channel_count = 1});
+    auto to_format =
+        audio::format({.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16});
+
+    audio::pcm_buffer from_buffer(from_format, frame_length);
+    audio::pcm_buffer to_buffer(to_format, frame_length);
+
+    audio::dsp::tpdf_dither dither;
+
+    XCTAssertTrue(to_buffer.copy_from(from_buffer, {.dither = &dither}));
+
+    int16_t const *const data = to_buffer.data_ptr_at_index<int16_t>(0);
+    bool has_nonzero = false;
+    for (uint32_t idx = 0; idx < frame_length; ++idx) {
+        XCTAssertLessThanOrEqual(std::abs(data[idx]), 1);
+        has_nonzero = has_nonzero || data[idx] != 0;
+    }
+    XCTAssertTrue(has_nonzero);
+}
+
+- (void)test_copy_data_different_channel_count_failed {
+    auto from_format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto to_format =
+        audio::format({.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16});
+
+    audio::pcm_buffer from_buffer(from_format, 4);
+    audio::pcm_buffer to_buffer(to_format, 4);
+
+    auto const result = to_buffer.copy_from(from_buffer);
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::invalid_format);
+}
+
+- (void)test_copy_without_allocation {
+    uint32_t const frame_length = 512;
+    auto const interleaved_format = audio::format(
+        {.sample_rate = 48000.0, .channel_count = 8, .pcm_format = audio::pcm_format::float32, .interleaved = true});
+    auto const deinterleaved_format = audio::format(
+        {.sample_rate = 48000.0, .channel_count = 8, .pcm_format = audio::pcm_format::float32, .interleaved = false});
+    auto const int16_format = audio::format(
+        {.sample_rate = 48000.0, .channel_count = 8, .pcm_format = audio::pcm_format::int16, .interleaved = false});
+
+    audio::pcm_buffer interleaved_buffer(interleaved_format, frame_length);
+    audio::pcm_buffer deinterleaved_buffer(deinterleaved_format, frame_length);
+    audio::pcm_buffer int16_buffer(int16_format, frame_length);
+    std::vector<float> raw_data(frame_length);
+
+    test::fill_test_values_to_buffer(interleaved_buffer);
+
+    // the counter sees the allocations made inside the framework. otherwise the zero below would prove nothing.
+    std::size_t framework_allocation_count = 0;
+
+    {
+        test::allocation_counter counter;
+
+        audio::pcm_buffer const allocated_buffer(deinterleaved_format, frame_length);
+
+        framework_allocation_count = counter.count();
+    }
+
+    XCTAssertGreaterThan(framework_allocation_count, 0);
+
+    std::vector<bool> results;
+    results.reserve(8);
+    std::size_t allocation_count = 0;
+
+    {
+        test::allocation_counter counter;
+
+        results.push_back(bool(deinterleaved_buffer.copy_from(interleaved_buffer)));
+        results.push_back(bool(interleaved_buffer.copy_from(deinterleaved_buffer)));
+        results.push_back(bool(deinterleaved_buffer.copy_from(interleaved_buffer.audio_buffer_list())));
+        results.push_back(bool(deinterleaved_buffer.copy_to(interleaved_buffer.audio_buffer_list())));
+        results.push_back(bool(int16_buffer.copy_from(interleaved_buffer)));
+        results.push_back(bool(deinterleaved_buffer.copy_to(raw_data.data(), 1, 0, 3, 0, frame_length)));
+        results.push_back(bool(deinterleaved_buffer.copy_from(raw_data.data(), 1, 0, 5, 0, frame_length)));
+        results.push_back(bool(audio::copy(interleaved_buffer.audio_buffer_list(),
+                                           deinterleaved_buffer.audio_buffer_list(), sizeof(float))));
+
+        allocation_count = counter.count();
+    }
+
+    XCTAssertEqual(allocation_count, 0);
+    XCTAssertEqual(results.size(), 8);
+    for (bool const result : results) {
+        XCTAssertTrue(result);
+    }
 }
 
 - (void)test_copy_data_flexibly_from_abl_same_format {
@@ -1330,6 +1469,262 @@ using namespace yas::audio;
     XCTAssertFalse(buffer.is_empty());
 }
 
+- (void)test_analysis_non_interleaved {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::float32, .interleaved = false}};
+
+    audio::pcm_buffer buffer{format, 4};
+
+    XCTAssertTrue(buffer.is_silent());
+    XCTAssertTrue(buffer.is_finite());
+    XCTAssertEqual(buffer.peak(0), 0.0f);
+    XCTAssertEqual(buffer.rms(1), 0.0f);
+
+    float *const data = buffer.data_ptr_at_channel<float>(1);
+    data[0] = 0.5f;
+    data[1] = -0.5f;
+    data[2] = 0.5f;
+    data[3] = -0.25f;
+
+    XCTAssertFalse(buffer.is_silent());
+    XCTAssertTrue(buffer.is_silent(0.5f));
+    XCTAssertFalse(buffer.is_silent(0.49f));
+    XCTAssertEqual(buffer.peak(0), 0.0f);
+    XCTAssertEqual(buffer.peak(1), 0.5f);
+    XCTAssertEqualWithAccuracy(buffer.rms(1), std::sqrt(0.203125f), 1.0e-6f);
+    XCTAssertEqualWithAccuracy(buffer.dc_offset(1), 0.0625f, 1.0e-6f);
+
+    data[2] = std::numeric_limits<float>::quiet_NaN();
+    XCTAssertFalse(buffer.is_finite());
+    XCTAssertFalse(buffer.is_silent(1.0f));
+
+    data[2] = -std::numeric_limits<float>::infinity();
+    XCTAssertFalse(buffer.is_finite());
+    XCTAssertFalse(buffer.is_silent(1.0f));
+
+    XCTAssertThrows((void)buffer.peak(2));
+}
+
+- (void)test_is_finite_float64 {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::float64, .interleaved = true}};
+
+    audio::pcm_buffer buffer{format, 4};
+    double *const data = buffer.data_ptr_at_index<double>(0);
+
+    // finite in float64 even though out of the range of float32.
+    data[5] = 1.0e300;
+    XCTAssertTrue(buffer.is_finite());
+
+    data[5] = std::numeric_limits<double>::infinity();
+    XCTAssertFalse(buffer.is_finite());
+
+    data[5] = std::numeric_limits<double>::quiet_NaN();
+    XCTAssertFalse(buffer.is_finite());
+}
+
+- (void)test_analysis_interleaved {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::int16, .interleaved = true}};
+
+    audio::pcm_buffer buffer{format, 600};
+    int16_t *const data = buffer.data_ptr_at_index<int16_t>(0);
+
+    for (uint32_t frame = 0; frame < 600; ++frame) {
+        data[frame * 2] = 16384;
+        data[frame * 2 + 1] = (frame % 2) ? -8192 : 8192;
+    }
+
+    XCTAssertFalse(buffer.is_silent(0.49f));
+    XCTAssertTrue(buffer.is_silent(0.5f));
+    XCTAssertTrue(buffer.is_finite());
+    XCTAssertEqual(buffer.peak(0), 0.5f);
+    XCTAssertEqual(buffer.peak(1), 0.25f);
+    XCTAssertEqualWithAccuracy(buffer.rms(1), 0.25f, 1.0e-6f);
+    XCTAssertEqualWithAccuracy(buffer.dc_offset(0), 0.5f, 1.0e-6f);
+    XCTAssertEqualWithAccuracy(buffer.dc_offset(1), 0.0f, 1.0e-6f);
+}
+
+- (void)test_apply_gain {
+    for (bool const interleaved : {false, true}) {
+        audio::format const format{{.sample_rate = 48000.0,
+                                    .channel_count = 2,
+                                    .pcm_format = pcm_format::float32,
+                                    .interleaved = interleaved}};
+        uint32_t const stride = format.stride();
+
+        audio::pcm_buffer buffer{format, 600};
+        for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+            float *const data = buffer.data_ptr_at_channel<float>(ch_idx);
+            for (uint32_t frame = 0; frame < 600; ++frame) {
+                data[frame * stride] = 1.0f;
+            }
+        }
+
+        buffer.apply_gain(0.5f);
+
+        XCTAssertEqual(buffer.peak(0), 0.5f);
+        XCTAssertEqual(buffer.peak(1), 0.5f);
+
+        buffer.apply_gain(2.0f, {.begin_frame = 100, .length = 10, .channel = 1});
+
+        XCTAssertEqual(buffer.data_ptr_at_channel<float>(1)[99 * stride], 0.5f);
+        XCTAssertEqual(buffer.data_ptr_at_channel<float>(1)[100 * stride], 1.0f);
+        XCTAssertEqual(buffer.data_ptr_at_channel<float>(1)[109 * stride], 1.0f);
+        XCTAssertEqual(buffer.data_ptr_at_channel<float>(1)[110 * stride], 0.5f);
+        XCTAssertEqual(buffer.data_ptr_at_channel<float>(0)[100 * stride], 0.5f);
+
+        XCTAssertThrows(buffer.apply_gain(1.0f, {.begin_frame = 590, .length = 20}));
+        XCTAssertThrows(buffer.apply_gain(1.0f, {.channel = 2}));
+    }
+}
+
+- (void)test_apply_gain_ramp {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::int16, .interleaved = true}};
+
+    audio::pcm_buffer buffer{format, 512};
+    int16_t *const data = buffer.data_ptr_at_index<int16_t>(0);
+    std::fill_n(data, 1024, 16384);
+
+    buffer.apply_gain_ramp(1.0f, 0.0f);
+
+    for (uint32_t frame = 0; frame < 512; ++frame) {
+        int16_t const expected = static_cast<int16_t>(std::lrint(16384.0 * (1.0 - frame / 512.0)));
+        XCTAssertLessThanOrEqual(std::abs(data[frame * 2] - expected), 1);
+        XCTAssertEqual(data[frame * 2], data[frame * 2 + 1]);
+    }
+}
+
+- (void)test_mix_from {
+    audio::format const to_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::int16, .interleaved = true}};
+    audio::format const from_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::float32, .interleaved = false}};
+
+    audio::pcm_buffer to_buffer{to_format, 300};
+    audio::pcm_buffer from_buffer{from_format, 300};
+
+    int16_t *const to_data = to_buffer.data_ptr_at_index<int16_t>(0);
+    for (uint32_t frame = 0; frame < 300; ++frame) {
+        to_data[frame * 2] = 8192;
+        from_buffer.data_ptr_at_channel<float>(0)[frame] = 0.5f;
+        from_buffer.data_ptr_at_channel<float>(1)[frame] = 0.75f;
+    }
+
+    auto result = to_buffer.mix_from(from_buffer, 0.5f);
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 300);
+    XCTAssertEqual(to_data[0], 16384);
+    XCTAssertEqual(to_data[1], 12288);
+    XCTAssertEqual(to_data[598], 16384);
+
+    XCTAssertTrue(to_buffer.mix_from(from_buffer, 4.0f));
+    XCTAssertEqual(to_data[0], INT16_MAX);
+
+    XCTAssertTrue(to_buffer.mix_channel_from(from_buffer, -1.0f, {.from_channel = 1, .to_channel = 0, .length = 1}));
+    XCTAssertEqual(to_data[0], 8191);
+    XCTAssertEqual(to_data[2], INT16_MAX);
+
+    audio::pcm_buffer mono_buffer{
+        audio::format({.sample_rate = 48000.0, .channel_count = 1, .pcm_format = pcm_format::float32}), 300};
+
+    XCTAssertEqual(to_buffer.mix_from(mono_buffer, 1.0f).error(), audio::pcm_buffer::copy_error_t::invalid_format);
+    XCTAssertEqual(to_buffer.mix_from(from_buffer, 1.0f, {.from_begin_frame = 2, .length = 299}).error(),
+                   audio::pcm_buffer::copy_error_t::out_of_range_frame);
+    XCTAssertEqual(to_buffer.mix_channel_from(from_buffer, 1.0f, {.from_channel = 2}).error(),
+                   audio::pcm_buffer::copy_error_t::out_of_range_channel);
+}
+
+- (void)test_crossfade_from {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::float32, .interleaved = false}};
+
+    audio::pcm_buffer to_buffer{format, 8};
+    audio::pcm_buffer from_buffer{format, 8};
+
+    for (uint32_t frame = 0; frame < 8; ++frame) {
+        from_buffer.data_ptr_at_channel<float>(0)[frame] = 1.0f;
+        from_buffer.data_ptr_at_channel<float>(1)[frame] = 1.0f;
+    }
+
+    XCTAssertTrue(to_buffer.crossfade_from(from_buffer));
+
+    for (uint32_t frame = 0; frame < 8; ++frame) {
+        XCTAssertEqualWithAccuracy(to_buffer.data_ptr_at_channel<float>(0)[frame], frame / 8.0f, 1.0e-6f);
+        XCTAssertEqualWithAccuracy(to_buffer.data_ptr_at_channel<float>(1)[frame], frame / 8.0f, 1.0e-6f);
+    }
+
+    to_buffer.clear();
+
+    auto result =
+        to_buffer.crossfade_channel_from(from_buffer, {.from_channel = 0, .to_begin_frame = 4, .to_channel = 1});
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 4);
+    XCTAssertEqual(to_buffer.data_ptr_at_channel<float>(1)[3], 0.0f);
+    XCTAssertEqual(to_buffer.data_ptr_at_channel<float>(1)[4], 0.0f);
+    XCTAssertEqual(to_buffer.data_ptr_at_channel<float>(1)[5], 0.25f);
+    XCTAssertEqual(to_buffer.data_ptr_at_channel<float>(0)[5], 0.0f);
+}
+
+- (void)test_measure_mix_from {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::float32, .interleaved = false}};
+    auto const to_buffer = std::make_shared<audio::pcm_buffer>(format, 512);
+    auto const from_buffer = std::make_shared<audio::pcm_buffer>(format, 512);
+    test::fill_test_values_to_buffer(*from_buffer);
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            to_buffer->mix_from(*from_buffer, 0.5f);
+            to_buffer->apply_gain_ramp(1.0f, 0.5f);
+        }
+    }];
+}
+
+- (void)test_measure_is_empty_1ch {
+    test::pcm_buffer_analysis::measure(self, 1, false);
+}
+
+- (void)test_measure_is_silent_1ch {
+    test::pcm_buffer_analysis::measure(self, 1, true);
+}
+
+- (void)test_measure_is_empty_8ch {
+    test::pcm_buffer_analysis::measure(self, 8, false);
+}
+
+- (void)test_measure_is_silent_8ch {
+    test::pcm_buffer_analysis::measure(self, 8, true);
+}
+
+- (void)test_measure_is_empty_128ch {
+    test::pcm_buffer_analysis::measure(self, 128, false);
+}
+
+- (void)test_measure_is_silent_128ch {
+    test::pcm_buffer_analysis::measure(self, 128, true);
+}
+
+- (void)test_measure_peak_and_rms_128ch {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 128, .pcm_format = pcm_format::float32, .interleaved = true}};
+    auto const buffer = std::make_shared<audio::pcm_buffer>(format, test::pcm_buffer_analysis::measure_length);
+    test::fill_test_values_to_buffer(*buffer);
+
+    [self measureBlock:^{
+        float level = 0.0f;
+        for (uint32_t idx = 0; idx < 10; ++idx) {
+            for (uint32_t ch_idx = 0; ch_idx < 128; ++ch_idx) {
+                level += buffer->peak(ch_idx) + buffer->rms(ch_idx);
+            }
+        }
+        XCTAssertGreaterThan(level, 0.0f);
+    }];
+}
+
 #pragma mark -
 
 - (void)assert_buffer_with_channel_map:(audio::channel_map_t const &)channel_map
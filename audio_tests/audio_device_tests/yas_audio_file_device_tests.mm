@@ -0,0 +1,251 @@
+//
+//  yas_audio_file_device_tests.mm
+//
+
+#import <atomic>
+#import <thread>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::file_device {
+static audio::format const format = audio::format({.sample_rate = test::sample_rate, .channel_count = 2});
+
+static std::string const dir_name = "yas_audio_file_device_test_files";
+
+struct block_sink : audio::offline_sink {
+    std::atomic<uint64_t> frame_length{0};
+    std::atomic<bool> is_finished{false};
+
+    audio::continuation write(audio::pcm_buffer const &buffer, audio::time const &) override {
+        this->frame_length += buffer.frame_length();
+        return audio::continuation::keep;
+    }
+
+    void finish(bool const) override {
+        this->is_finished = true;
+    }
+};
+
+// takes longer to write a block than the render thread has for a slice.
+struct slow_sink : block_sink {
+    audio::continuation write(audio::pcm_buffer const &buffer, audio::time const &time) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return block_sink::write(buffer, time);
+    }
+};
+
+// streams the file to an input tap of a graph and returns the sum of the rendered frames.
+static double render_graph_input(audio::file_ptr const &file) {
+    auto const graph = audio::graph::make_shared();
+    auto const input_tap = audio::graph_input_tap::make_shared();
+    auto const sum = std::make_shared<double>(0.0);
+    std::atomic<bool> is_completed{false};
+
+    input_tap->set_render_handler([sum](audio::node_input_render_args const &args) {
+        auto each = audio::make_each_block<float>(*args.buffer);
+        while (each.next()) {
+            float const *const data = each.data();
+            for (uint32_t idx = 0; idx < each.length(); ++idx) {
+                *sum += data[idx * each.stride()];
+            }
+        }
+    });
+
+    auto const device =
+        audio::file_device::make_shared({.file = file,
+                                         .pacing = audio::file_device::pacing::free_run,
+                                         .completion = [&is_completed] { is_completed = true; }});
+
+    auto const &io = graph->add_io(device);
+    io->raw_io()->set_maximum_frames_per_slice(4096);
+
+    graph->connect(io->input_node, input_tap->node, format);
+    graph->start_render();
+
+    while (!is_completed) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.001]];
+    }
+
+    graph->stop();
+
+    return *sum;
+}
+}  // namespace yas::test::file_device
+
+@interface yas_audio_file_device_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_file_device_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::setup_test_directory(test::file_device::dir_name);
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared {
+    auto const file = test::make_opened_test_file(test::file_device::dir_name, "make_shared.wav",
+                                                  test::make_file_format(2, 16, false), 100);
+    auto const output_format = audio::format({.sample_rate = test::sample_rate, .channel_count = 1});
+
+    auto const device = audio::file_device::make_shared({.file = file, .output_format = output_format});
+
+    XCTAssertEqual(device->input_format(), test::file_device::format);
+    XCTAssertEqual(device->output_format(), output_format);
+    XCTAssertTrue(device->file_args().pacing == audio::file_device::pacing::real_time);
+
+    XCTAssertThrows(audio::file_device::make_shared({.file = audio::file::make_shared()}));
+    XCTAssertThrows(audio::file_device::make_shared(
+        {.file = file, .output_format = audio::format({.sample_rate = 44100.0, .channel_count = 1})}));
+    XCTAssertThrows(audio::file_device::make_shared(
+        {.file = file, .output_sink = std::make_shared<test::file_device::block_sink>()}));
+}
+
+- (void)test_free_run {
+    uint32_t const frame_length = 10000;
+    auto const file = test::make_opened_test_file(test::file_device::dir_name, "free_run.wav",
+                                                  test::make_file_format(2, 16, false), frame_length);
+    auto const device = audio::file_device::make_shared({.file = file,
+                                                          .pacing = audio::file_device::pacing::free_run,
+                                                          .read_ahead_frame_capacity = 2048});
+    auto const io_core = device->make_io_core();
+
+    auto const values = std::make_shared<std::vector<float>>();
+    auto const sample_times = std::make_shared<std::vector<int64_t>>();
+    std::atomic<bool> has_output{false};
+
+    io_core->set_maximum_frames_per_slice(1000);
+    io_core->set_render_handler([values, sample_times, &has_output](audio::io_render_args args) {
+        if (args.output_buffer) {
+            has_output = true;
+        }
+        sample_times->push_back(args.input_time->sample_time());
+        float const *const data = args.input_buffer->data_ptr_at_channel<float>(1);
+        values->insert(values->end(), data, data + args.input_buffer->frame_length());
+    });
+
+    XCTAssertTrue(io_core->start());
+
+    auto const statistics = [&device] { return device->statistics(); };
+    while (statistics().read_frame_count < frame_length) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.001]];
+    }
+
+    io_core->stop();
+
+    XCTAssertFalse(has_output);
+    XCTAssertEqual(values->size(), frame_length);
+    XCTAssertEqual(sample_times->size(), 10);
+    XCTAssertEqual(sample_times->at(9), 9000);
+
+    bool is_read = true;
+    for (uint32_t frame = 0; frame < frame_length; ++frame) {
+        if (values->at(frame) != test::file_value(frame, 1)) {
+            is_read = false;
+        }
+    }
+    XCTAssertTrue(is_read);
+
+    XCTAssertEqual(statistics().slice_count, 10);
+    XCTAssertEqual(statistics().underrun_count, 0);
+}
+
+- (void)test_real_time_with_output_sink {
+    uint32_t const frame_length = 4800;
+    auto const file = test::make_opened_test_file(test::file_device::dir_name, "real_time.wav",
+                                                  test::make_file_format(2, 16, false), frame_length);
+    auto const sink = std::make_shared<test::file_device::block_sink>();
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"completion"];
+
+    auto const device = audio::file_device::make_shared({.file = file,
+                                                          .output_format = test::file_device::format,
+                                                          .output_sink = sink,
+                                                          .completion = [expectation] { [expectation fulfill]; }});
+    auto const io = audio::io::make_shared(device);
+
+    io->set_maximum_frames_per_slice(480);
+    io->set_render_handler([](audio::io_render_args args) {
+        if (args.output_buffer && args.input_buffer) {
+            args.output_buffer->copy_from(*args.input_buffer);
+        }
+    });
+    io->start();
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    io->stop();
+
+    XCTAssertEqual(sink->frame_length, frame_length);
+    XCTAssertTrue(sink->is_finished);
+    XCTAssertEqual(device->statistics().slice_count, 10);
+    XCTAssertEqual(device->statistics().read_frame_count, frame_length);
+
+    device->reset_statistics();
+    XCTAssertEqual(device->statistics().slice_count, 0);
+}
+
+- (void)test_real_time_with_slow_output_sink {
+    uint32_t const frame_length = 48000;
+    auto const file = test::make_opened_test_file(test::file_device::dir_name, "real_time_slow.wav",
+                                                  test::make_file_format(2, 16, false), frame_length);
+    auto const sink = std::make_shared<test::file_device::slow_sink>();
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"completion"];
+
+    auto const device = audio::file_device::make_shared({.file = file,
+                                                          .output_format = test::file_device::format,
+                                                          .output_sink = sink,
+                                                          .completion = [expectation] { [expectation fulfill]; }});
+    auto const io_core = device->make_io_core();
+
+    io_core->set_maximum_frames_per_slice(480);
+    io_core->set_render_handler([](audio::io_render_args args) {
+        args.output_buffer->copy_from(*args.input_buffer);
+    });
+
+    XCTAssertTrue(io_core->start());
+
+    [NSThread sleepForTimeInterval:0.5];
+
+    // the slices of 10 ms keep their deadlines though the sink takes 20 ms for a block.
+    XCTAssertGreaterThanOrEqual(device->statistics().slice_count, 40);
+
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+    io_core->stop();
+
+    XCTAssertEqual(sink->frame_length, frame_length);
+    XCTAssertTrue(sink->is_finished);
+    XCTAssertEqual(device->statistics().dropped_output_frame_count, 0);
+}
+
+- (void)test_graph_input {
+    uint32_t const frame_length = 10000;
+    auto const file = test::make_opened_test_file(test::file_device::dir_name, "graph_input.wav",
+                                                  test::make_file_format(2, 16, false), frame_length);
+
+    double expected = 0.0;
+    for (uint32_t frame = 0; frame < frame_length; ++frame) {
+        expected += test::file_value(frame, 0) + test::file_value(frame, 1);
+    }
+
+    XCTAssertEqual(test::file_device::render_graph_input(file), expected);
+}
+
+- (void)test_measure_graph_input {
+    auto const file = test::make_opened_test_file(test::file_device::dir_name, "measure_graph_input.wav",
+                                                  test::make_file_format(2, 16, false), 48000 * 60);
+
+    [self measureBlock:^{
+        test::file_device::render_graph_input(file);
+    }];
+}
+
+@end
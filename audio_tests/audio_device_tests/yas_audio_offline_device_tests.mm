@@ -2,6 +2,8 @@
 //  yas_audio_offline_device_tests.mm
 //
 
+#import <pthread.h>
+#import <atomic>
 #import "yas_audio_test_utils.h"
 
 using namespace yas;
@@ -28,6 +30,29 @@ using namespace yas;
     XCTAssertFalse(device->input_format().has_value());
 }
 
+- (void)test_make_shared_with_args {
+    auto const format = audio::format({.sample_rate = 44100, .channel_count = 2});
+    auto const render_handler = [](audio::offline_render_args) { return audio::continuation::abort; };
+    auto const scheduler = audio::offline_scheduler::make_shared({.worker_count = 1});
+
+    auto const device = audio::offline_device::make_shared(
+        {.output_format = format, .render_handler = render_handler, .scheduler = scheduler, .scheduling_priority = 2});
+
+    XCTAssertEqual(device->output_format(), format);
+    XCTAssertTrue(device->render_handler() != nullptr);
+    XCTAssertFalse(device->stream_args().has_value());
+    XCTAssertEqual(device->scheduler(), scheduler);
+    XCTAssertEqual(device->scheduling_priority(), 2);
+
+    XCTAssertThrows(audio::offline_device::make_shared({.output_format = format}));
+    XCTAssertThrows(audio::offline_device::make_shared(
+        {.output_format = format, .render_handler = render_handler, .stream = audio::offline_stream_args{}}));
+    XCTAssertThrows(
+        audio::offline_device::make_shared({.output_format = format, .stream = audio::offline_stream_args{}}));
+    XCTAssertThrows(audio::offline_device::make_shared(
+        {.output_format = format, .render_handler = render_handler, .scheduler = audio::offline_scheduler_ptr{}}));
+}
+
 - (void)test_completion_handler {
     auto format = audio::format({.sample_rate = 44100, .channel_count = 2});
 
@@ -41,4 +66,42 @@ using namespace yas;
     XCTAssertFalse(device->completion_handler().has_value());
 }
 
+- (void)test_render_thread_policy {
+    auto format = audio::format({.sample_rate = 44100, .channel_count = 2});
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"completion"];
+
+    auto const device = audio::offline_device::make_shared(
+        format, [](audio::offline_render_args) { return audio::continuation::abort; },
+        [&expectation](bool const) { [expectation fulfill]; });
+
+    auto const io_core = device->make_io_core();
+
+    std::atomic<int> first_policy{-1};
+    std::atomic<int> first_priority{-1};
+
+    io_core->set_render_handler([&first_policy, &first_priority](audio::io_render_args) {
+        int policy = 0;
+        sched_param param{};
+        if (first_policy == -1 && pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+            first_priority = param.sched_priority;
+            first_policy = policy;
+        }
+    });
+    io_core->set_maximum_frames_per_slice(512);
+    io_core->set_render_thread_policy(
+        {.scheduling = audio::render_thread_policy::scheduling_t::round_robin, .prefaults_buffers = true});
+
+    XCTAssertTrue(io_core->start());
+
+    // applied before start() returns.
+    XCTAssertEqual(io_core->render_thread_policy_errors().size(), 0);
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    // the first slice is rendered with the policy.
+    XCTAssertEqual(first_policy, SCHED_RR);
+    XCTAssertEqual(first_priority, sched_get_priority_max(SCHED_RR));
+}
+
 @end
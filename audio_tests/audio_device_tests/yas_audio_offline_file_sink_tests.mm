@@ -0,0 +1,157 @@
+//
+//  yas_audio_offline_file_sink_tests.mm
+//
+
+#import <atomic>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::offline_file_sink {
+static audio::format const format = audio::format({.sample_rate = test::sample_rate, .channel_count = 2});
+
+static std::string const dir_name = "yas_audio_offline_file_sink_test_files";
+
+// writes the blocks into the file on the render thread. the way to bounce to a file without the file sink.
+struct direct_sink : audio::offline_sink {
+    audio::file_ptr const file;
+
+    explicit direct_sink(audio::file_ptr const &file) : file(file) {
+    }
+
+    audio::continuation write(audio::pcm_buffer const &buffer, audio::time const &) override {
+        return this->file->write_from_buffer(buffer) ? audio::continuation::keep : audio::continuation::abort;
+    }
+};
+
+// renders a sine wave into the sink and returns when completed.
+static void bounce(audio::offline_sink_ptr const &sink, uint64_t const frame_length) {
+    std::atomic<bool> is_completed{false};
+
+    auto const device = audio::offline_device::make_shared(
+        {.output_format = format,
+         .stream = audio::offline_stream_args{.sink = sink, .frame_length = frame_length},
+         .completion_handler = [&is_completed](bool const) { is_completed = true; }});
+
+    auto const io = audio::io::make_shared(device);
+    io->set_maximum_frames_per_slice(4096);
+    io->set_render_handler([](audio::io_render_args args) {
+        double const phase_per_frame = 440.0 * 2.0 * M_PI / test::sample_rate;
+        auto each = audio::make_each_block<float>(*args.output_buffer);
+        while (each.next()) {
+            float *const data = each.data();
+            for (uint32_t idx = 0; idx < each.length(); ++idx) {
+                data[idx * each.stride()] = static_cast<float>(std::sin(
+                    phase_per_frame * static_cast<double>(args.output_time->sample_time() + each.frame() + idx)));
+            }
+        }
+    });
+    io->start();
+
+    while (!is_completed) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.001]];
+    }
+}
+}  // namespace yas::test::offline_file_sink
+
+@interface yas_audio_offline_file_sink_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_offline_file_sink_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::setup_test_directory(test::offline_file_sink::dir_name);
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared {
+    auto const file = test::make_created_test_file(test::offline_file_sink::dir_name, "make_shared.wav",
+                                                   audio::wave_file_settings(test::sample_rate, 2, 16));
+    auto const sink = audio::offline_file_sink::make_shared({.file = file});
+
+    XCTAssertEqual(sink->file(), file);
+    XCTAssertFalse(sink->is_finished());
+    XCTAssertFalse(sink->write_error().has_value());
+
+    XCTAssertThrows(audio::offline_file_sink::make_shared({.file = nullptr}));
+    XCTAssertThrows(audio::offline_file_sink::make_shared({.file = audio::file::make_shared()}));
+}
+
+- (void)test_write_file {
+    uint64_t const frame_length = 100000;
+
+    auto const file = test::make_created_test_file(test::offline_file_sink::dir_name, "write_file.wav",
+                                                   audio::wave_file_settings(test::sample_rate, 2, 16));
+    // the ring is smaller than a block so that the render thread waits for the writer thread.
+    auto const sink =
+        audio::offline_file_sink::make_shared({.file = file, .ring_frame_capacity = 1024, .write_frame_length = 512});
+
+    test::offline_file_sink::bounce(sink, frame_length);
+
+    XCTAssertTrue(sink->is_finished());
+    XCTAssertFalse(sink->write_error().has_value());
+
+    auto const statistics = sink->statistics();
+    XCTAssertEqual(statistics.rendered_frames, frame_length);
+    XCTAssertEqual(statistics.written_frames, frame_length);
+    XCTAssertGreaterThan(statistics.frames_per_second, 0.0);
+
+    file->close();
+
+    auto const opened = audio::file::make_opened({.file_url = file->url()}).value();
+    XCTAssertEqual(opened->file_length(), frame_length);
+
+    audio::pcm_buffer buffer{opened->processing_format(), static_cast<uint32_t>(frame_length)};
+    XCTAssertTrue(opened->read_into_buffer(buffer));
+
+    double const phase_per_frame = 440.0 * 2.0 * M_PI / test::sample_rate;
+    bool is_written = true;
+    for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+        float const *const data = buffer.data_ptr_at_channel<float>(ch_idx);
+        for (uint32_t frame = 0; frame < frame_length; ++frame) {
+            if (std::abs(data[frame] - std::sin(phase_per_frame * frame)) > 0.001) {
+                is_written = false;
+            }
+        }
+    }
+    XCTAssertTrue(is_written);
+}
+
+- (void)test_write_error_with_invalid_format {
+    auto const file_url =
+        test::temporary_test_dir_url(test::offline_file_sink::dir_name).appending("invalid_format.wav");
+    auto const file = audio::file::make_created({.file_url = file_url,
+                                                 .file_type = audio::file_type::wave,
+                                                 .settings = audio::wave_file_settings(44100.0, 1, 16)})
+                          .value();
+    auto const sink = audio::offline_file_sink::make_shared({.file = file});
+
+    test::offline_file_sink::bounce(sink, 10000);
+
+    XCTAssertTrue(sink->write_error() == audio::file::write_error_t::invalid_format);
+    XCTAssertEqual(sink->statistics().written_frames, 0);
+}
+
+- (void)test_measure_direct_write {
+    [self measureBlock:^{
+        auto const file = test::make_created_test_file(test::offline_file_sink::dir_name, "measure_direct.wav",
+                                                       audio::wave_file_settings(test::sample_rate, 2, 16));
+        test::offline_file_sink::bounce(std::make_shared<test::offline_file_sink::direct_sink>(file), 48000 * 60);
+    }];
+}
+
+- (void)test_measure_file_sink {
+    [self measureBlock:^{
+        auto const file = test::make_created_test_file(test::offline_file_sink::dir_name, "measure_file_sink.wav",
+                                                       audio::wave_file_settings(test::sample_rate, 2, 16));
+        test::offline_file_sink::bounce(audio::offline_file_sink::make_shared({.file = file}), 48000 * 60);
+    }];
+}
+
+@end
@@ -0,0 +1,276 @@
+//
+//  yas_audio_offline_scheduler_tests.mm
+//
+
+#import <atomic>
+#import <thread>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::offline_scheduler {
+struct direct_executor : audio::executor {
+    void perform(std::function<void(void)> &&handler) override {
+        handler();
+    }
+};
+
+static audio::executor_ptr make_direct_executor() {
+    return std::make_shared<direct_executor>();
+}
+
+// renders sine waves to offline devices of the scheduler and returns the rendered seconds.
+static double render_sessions(audio::offline_scheduler_ptr const &scheduler, uint32_t const session_count,
+                              uint32_t const slice_count) {
+    uint32_t const frame_length = 4096;
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const completed_count = std::make_shared<std::atomic<uint32_t>>(0);
+
+    std::vector<audio::io_ptr> ios;
+
+    for (uint32_t idx = 0; idx < session_count; ++idx) {
+        auto const device = audio::offline_device::make_shared(
+            {.output_format = format,
+             .render_handler =
+                 [count = uint32_t(0), slice_count](audio::offline_render_args) mutable {
+                     return ++count < slice_count ? audio::continuation::keep : audio::continuation::abort;
+                 },
+             .completion_handler = [completed_count](bool const) { ++(*completed_count); },
+             .scheduler = scheduler});
+
+        auto const io = audio::io::make_shared(device);
+        io->set_maximum_frames_per_slice(frame_length);
+        io->set_render_handler([phase = 0.0](audio::io_render_args args) mutable {
+            double const phase_per_frame = 440.0 * 2.0 * M_PI / 48000.0;
+            auto each = audio::make_each_block<float>(*args.output_buffer);
+            while (each.next()) {
+                float *const data = each.data();
+                for (uint32_t idx = 0; idx < each.length(); ++idx) {
+                    data[idx * each.stride()] =
+                        static_cast<float>(std::sin(phase + phase_per_frame * (each.frame() + idx)));
+                }
+            }
+            phase += phase_per_frame * args.output_buffer->frame_length();
+        });
+        io->start();
+
+        ios.push_back(io);
+    }
+
+    while (completed_count->load() < session_count) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.001]];
+    }
+
+    return static_cast<double>(session_count * slice_count * frame_length) / 48000.0;
+}
+}  // namespace yas::test::offline_scheduler
+
+@interface yas_audio_offline_scheduler_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_offline_scheduler_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared {
+    auto const scheduler = audio::offline_scheduler::make_shared({.worker_count = 3});
+
+    XCTAssertEqual(scheduler->worker_count(), 3);
+    XCTAssertEqual(scheduler->job_count(), 0);
+
+    XCTAssertGreaterThan(audio::offline_scheduler::make_shared({})->worker_count(), 0);
+}
+
+- (void)test_priority_and_fair_slicing {
+    auto const scheduler =
+        audio::offline_scheduler::make_shared({.worker_count = 1,
+                                               .slices_per_turn = 1,
+                                               .completion_executor = test::offline_scheduler::make_direct_executor()});
+
+    std::mutex mutex;
+    std::vector<uint32_t> rendered;
+    std::atomic<uint32_t> completed_count{0};
+    std::atomic<bool> is_blocking{true};
+
+    // keeps the worker busy until all of the jobs are added.
+    scheduler->add_job({.render_slice =
+                            [&is_blocking] {
+                                while (is_blocking) {
+                                    std::this_thread::yield();
+                                }
+                                return audio::continuation::abort;
+                            },
+                        .completion = [&completed_count](bool const) { ++completed_count; }});
+
+    auto const make_job = [&mutex, &rendered, &completed_count](uint32_t const tag, int32_t const priority) {
+        return audio::offline_scheduler::job_args{.render_slice =
+                                                      [&mutex, &rendered, tag, count = uint32_t(0)]() mutable {
+                                                          std::lock_guard<std::mutex> lock(mutex);
+                                                          rendered.push_back(tag);
+                                                          return ++count < 3 ? audio::continuation::keep :
+                                                                               audio::continuation::abort;
+                                                      },
+                                                  .completion = [&completed_count](bool const) { ++completed_count; },
+                                                  .priority = priority};
+    };
+
+    scheduler->add_job(make_job(1, 0));
+    scheduler->add_job(make_job(2, 0));
+    scheduler->add_job(make_job(3, 1));
+
+    is_blocking = false;
+
+    while (completed_count < 4) {
+        std::this_thread::yield();
+    }
+
+    XCTAssertEqual(rendered, (std::vector<uint32_t>{3, 3, 3, 1, 2, 1, 2, 1, 2}));
+    XCTAssertEqual(scheduler->job_count(), 0);
+}
+
+- (void)test_cancel_job {
+    auto const scheduler = audio::offline_scheduler::make_shared(
+        {.worker_count = 2, .completion_executor = test::offline_scheduler::make_direct_executor()});
+
+    std::atomic<bool> is_completed{false};
+    std::atomic<bool> is_cancelled{false};
+
+    auto const job_id = scheduler->add_job({.render_slice = [] { return audio::continuation::keep; },
+                                            .completion =
+                                                [&is_completed, &is_cancelled](bool const cancelled) {
+                                                    is_cancelled = cancelled;
+                                                    is_completed = true;
+                                                }});
+
+    XCTAssertEqual(scheduler->job_count(), 1);
+
+    scheduler->cancel_job(job_id);
+
+    while (!is_completed) {
+        std::this_thread::yield();
+    }
+
+    XCTAssertTrue(is_cancelled);
+    XCTAssertEqual(scheduler->job_count(), 0);
+}
+
+- (void)test_cancel_offline_device_job {
+    auto const scheduler = audio::offline_scheduler::make_shared(
+        {.worker_count = 1, .completion_executor = test::offline_scheduler::make_direct_executor()});
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    std::atomic<bool> is_completed{false};
+    std::atomic<bool> is_cancelled{false};
+
+    auto const device = audio::offline_device::make_shared(
+        {.output_format = format,
+         .render_handler = [](audio::offline_render_args) { return audio::continuation::keep; },
+         .completion_handler =
+             [&is_completed, &is_cancelled](bool const cancelled) {
+                 is_cancelled = cancelled;
+                 is_completed = true;
+             },
+         .scheduler = scheduler});
+
+    auto const io_core = device->make_io_core();
+    io_core->set_render_handler([](audio::io_render_args) {});
+    io_core->set_maximum_frames_per_slice(512);
+
+    XCTAssertTrue(io_core->start());
+    XCTAssertEqual(scheduler->job_count(), 1);
+
+    // the first job of the scheduler.
+    scheduler->cancel_job(1);
+
+    while (!is_completed) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.001]];
+    }
+
+    XCTAssertTrue(is_cancelled);
+
+    // returns without waiting for a slice that the cancelled job never renders.
+    io_core->stop();
+
+    XCTAssertEqual(scheduler->job_count(), 0);
+}
+
+- (void)test_stop_low_priority_job_while_higher_running {
+    auto const scheduler =
+        audio::offline_scheduler::make_shared({.worker_count = 1,
+                                               .slices_per_turn = 1,
+                                               .completion_executor = test::offline_scheduler::make_direct_executor()});
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    std::atomic<bool> is_high_running{true};
+    std::atomic<bool> is_high_started{false};
+
+    scheduler->add_job({.render_slice =
+                            [&is_high_running, &is_high_started] {
+                                is_high_started = true;
+                                return is_high_running ? audio::continuation::keep : audio::continuation::abort;
+                            },
+                        .priority = 1});
+
+    // ends the higher job to fail instead of blocking if the lower job is starved.
+    std::thread timeout_thread{[&is_high_running] {
+        std::this_thread::sleep_for(std::chrono::seconds(5));
+        is_high_running = false;
+    }};
+
+    while (!is_high_started) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> is_completed{false};
+
+    auto const device = audio::offline_device::make_shared(
+        {.output_format = format,
+         .render_handler = [](audio::offline_render_args) { return audio::continuation::keep; },
+         .completion_handler = [&is_completed](bool const) { is_completed = true; },
+         .scheduler = scheduler});
+
+    auto const io_core = device->make_io_core();
+    io_core->set_render_handler([](audio::io_render_args) {});
+    io_core->set_maximum_frames_per_slice(512);
+
+    XCTAssertTrue(io_core->start());
+
+    io_core->stop();
+
+    XCTAssertTrue(is_high_running);
+    XCTAssertTrue(is_completed);
+
+    is_high_running = false;
+    timeout_thread.join();
+}
+
+- (void)test_offline_device {
+    auto const scheduler = audio::offline_scheduler::make_shared({.worker_count = 2});
+
+    XCTAssertEqual(test::offline_scheduler::render_sessions(scheduler, 16, 4), 16 * 4 * 4096 / 48000.0);
+}
+
+- (void)test_measure_single_worker {
+    auto const scheduler = audio::offline_scheduler::make_shared({.worker_count = 1});
+
+    [self measureBlock:^{
+        test::offline_scheduler::render_sessions(scheduler, 64, 32);
+    }];
+}
+
+- (void)test_measure_all_cores {
+    auto const scheduler = audio::offline_scheduler::make_shared({});
+
+    [self measureBlock:^{
+        test::offline_scheduler::render_sessions(scheduler, 64, 32);
+    }];
+}
+
+@end
@@ -0,0 +1,251 @@
+//
+//  yas_audio_shared_memory_device_tests.mm
+//
+
+#include <TargetConditionals.h>
+
+#if (TARGET_OS_MAC && !TARGET_OS_IPHONE)
+
+#import <sys/wait.h>
+#import <unistd.h>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::shared_memory_device {
+static std::string const ring_name = "yas_audio_test_ring";
+}  // namespace yas::test::shared_memory_device
+
+@interface yas_audio_shared_memory_device_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_shared_memory_device_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_ring {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+
+    XCTAssertFalse(audio::shared_memory_ring::make_created({.name = "", .format = format, .frame_capacity = 64}));
+    XCTAssertFalse(audio::shared_memory_ring::make_created(
+        {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 0}));
+    XCTAssertFalse(audio::shared_memory_ring::make_opened({.name = test::shared_memory_device::ring_name}));
+
+    auto const created = audio::shared_memory_ring::make_created(
+        {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 100});
+    XCTAssertTrue(created);
+
+    auto const opened = audio::shared_memory_ring::make_opened({.name = test::shared_memory_device::ring_name});
+    XCTAssertTrue(opened);
+
+    XCTAssertTrue(opened.value()->format() == format);
+    XCTAssertEqual(opened.value()->frame_capacity(), 128);
+}
+
+- (void)test_make_ring_existing {
+    auto const format = test::make_format(audio::pcm_format::float32, 1, false);
+
+    auto const created = audio::shared_memory_ring::make_created(
+        {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 64});
+    XCTAssertTrue(created);
+
+    auto const existing = audio::shared_memory_ring::make_created(
+        {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 64});
+    XCTAssertEqual(existing.error(), audio::shared_memory_ring::create_error_t::create_failed);
+
+    auto const replaced = audio::shared_memory_ring::make_created({.name = test::shared_memory_device::ring_name,
+                                                                    .format = format,
+                                                                    .frame_capacity = 64,
+                                                                    .replaces_existing = true});
+    XCTAssertTrue(replaced);
+}
+
+- (void)test_write_and_read {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const writer = audio::shared_memory_ring::make_created(
+                            {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 128})
+                            .value();
+    auto const reader =
+        audio::shared_memory_ring::make_opened({.name = test::shared_memory_device::ring_name}).value();
+
+    audio::pcm_buffer write_buffer{format, 100};
+    audio::pcm_buffer read_buffer{format, 60};
+
+    test::fill_sequence(write_buffer, 0);
+    XCTAssertEqual(writer->write(write_buffer, audio::time{1000, 48000.0}).value(), 100);
+    XCTAssertEqual(reader->readable_frame_length(), 100);
+
+    XCTAssertEqual(reader->read(read_buffer).value(), 60);
+    XCTAssertTrue(test::is_sequence(read_buffer, 0));
+    XCTAssertEqual(reader->read_time()->sample_time(), 1000);
+
+    test::fill_sequence(write_buffer, 100);
+    XCTAssertEqual(writer->write(write_buffer, audio::time{5000, 48000.0}).value(), 88);
+
+    XCTAssertEqual(reader->read(read_buffer).value(), 60);
+    XCTAssertEqual(reader->read_time()->sample_time(), 1060);
+    XCTAssertEqual(read_buffer.data_ptr_at_channel<float>(0)[39], 99.0f);
+    XCTAssertEqual(read_buffer.data_ptr_at_channel<float>(0)[40], 100.0f);
+
+    XCTAssertEqual(reader->read(read_buffer).value(), 60);
+    XCTAssertEqual(reader->read_time()->sample_time(), 5020);
+    XCTAssertTrue(test::is_sequence(read_buffer, 120));
+}
+
+- (void)test_interrupt_wait {
+    auto const format = test::make_format(audio::pcm_format::float32, 1, false);
+    auto const writer = audio::shared_memory_ring::make_created(
+                            {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 64})
+                            .value();
+    auto const reader =
+        audio::shared_memory_ring::make_opened({.name = test::shared_memory_device::ring_name}).value();
+
+    reader->interrupt_wait();
+    XCTAssertFalse(reader->wait_readable(1));
+
+    audio::pcm_buffer buffer{format, 16};
+    XCTAssertEqual(writer->write(buffer).value(), 16);
+    XCTAssertTrue(reader->wait_readable(16));
+}
+
+- (void)test_two_processes {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, true);
+    auto const writer = audio::shared_memory_ring::make_created(
+                            {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 1024})
+                            .value();
+    uint32_t const total_length = 1000000;
+
+    pid_t const pid = fork();
+
+    if (pid == 0) {
+        auto const reader = audio::shared_memory_ring::make_opened({.name = test::shared_memory_device::ring_name});
+        if (!reader) {
+            _exit(1);
+        }
+
+        auto const &ring = reader.value();
+        audio::pcm_buffer buffer{test::make_format(audio::pcm_format::float64, 2, false), 256};
+        uint32_t read_length = 0;
+
+        while (read_length < total_length) {
+            if (!ring->wait_readable(std::min(buffer.frame_capacity(), total_length - read_length))) {
+                _exit(2);
+            }
+
+            uint32_t const length = ring->read(buffer).value();
+
+            for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+                double const *const data = buffer.data_ptr_at_channel<double>(ch_idx);
+                for (uint32_t frame = 0; frame < length; ++frame) {
+                    if (data[frame] != static_cast<double>(read_length + frame)) {
+                        _exit(3);
+                    }
+                }
+            }
+
+            if (ring->read_time()->sample_time() != read_length) {
+                _exit(4);
+            }
+
+            read_length += length;
+        }
+
+        _exit(0);
+    }
+
+    XCTAssertGreaterThan(pid, 0);
+
+    audio::pcm_buffer buffer{format, 300};
+    uint32_t written_length = 0;
+
+    while (written_length < total_length) {
+        buffer.set_frame_length(std::min(1 + written_length % 300, total_length - written_length));
+        test::fill_sequence(buffer, written_length);
+        written_length += writer->write(buffer, audio::time{written_length, 48000.0}).value();
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    XCTAssertTrue(WIFEXITED(status));
+    XCTAssertEqual(WEXITSTATUS(status), 0);
+}
+
+- (void)test_device {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const writer = audio::shared_memory_ring::make_created(
+                            {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 4096})
+                            .value();
+    auto const reader =
+        audio::shared_memory_ring::make_opened({.name = test::shared_memory_device::ring_name}).value();
+
+    auto const device = audio::shared_memory_device::make_shared(reader);
+
+    XCTAssertEqual(device->input_format(), format);
+    XCTAssertFalse(device->output_format().has_value());
+
+    auto const io_core = device->make_io_core();
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"render"];
+    expectation.expectedFulfillmentCount = 4;
+    expectation.assertForOverFulfill = NO;
+
+    io_core->set_maximum_frames_per_slice(256);
+    io_core->set_render_handler([expectation](audio::io_render_args args) {
+        if (!args.output_buffer && args.input_buffer && args.input_buffer->frame_length() == 256 &&
+            args.input_time.has_value()) {
+            [expectation fulfill];
+        }
+    });
+
+    XCTAssertTrue(io_core->start());
+
+    audio::pcm_buffer buffer{format, 256};
+    for (uint32_t idx = 0; idx < 4; ++idx) {
+        XCTAssertEqual(writer->write(buffer).value(), 256);
+    }
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    io_core->stop();
+}
+
+- (void)test_device_renders_before_slice_is_full {
+    auto const format = test::make_format(audio::pcm_format::float32, 2, false);
+    auto const writer = audio::shared_memory_ring::make_created(
+                            {.name = test::shared_memory_device::ring_name, .format = format, .frame_capacity = 8192})
+                            .value();
+    auto const reader =
+        audio::shared_memory_ring::make_opened({.name = test::shared_memory_device::ring_name}).value();
+
+    auto const io_core = audio::shared_memory_device::make_shared(reader)->make_io_core();
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"render"];
+
+    io_core->set_maximum_frames_per_slice(4096);
+    io_core->set_render_handler([expectation](audio::io_render_args args) {
+        if (args.input_buffer->frame_length() == 128) {
+            [expectation fulfill];
+        }
+    });
+
+    XCTAssertTrue(io_core->start());
+
+    audio::pcm_buffer buffer{format, 128};
+    XCTAssertEqual(writer->write(buffer).value(), 128);
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    io_core->stop();
+}
+
+@end
+
+#endif
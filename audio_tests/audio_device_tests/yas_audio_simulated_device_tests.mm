@@ -0,0 +1,191 @@
+//
+//  yas_audio_simulated_device_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::simulated_device {
+static std::vector<uint32_t> render_frame_lengths(audio::simulated_device_ptr const &device, std::size_t const count) {
+    auto const frame_lengths = std::make_shared<std::vector<uint32_t>>();
+    auto const io_core = device->make_io_core();
+
+    std::atomic<bool> is_completed{false};
+
+    io_core->set_maximum_frames_per_slice(256);
+    io_core->set_render_handler([frame_lengths, count, &is_completed](audio::io_render_args args) {
+        if (frame_lengths->size() < count) {
+            frame_lengths->push_back(args.output_buffer->frame_length());
+        } else {
+            is_completed = true;
+        }
+    });
+
+    if (io_core->start()) {
+        while (!is_completed) {
+            [NSThread sleepForTimeInterval:0.001];
+        }
+        io_core->stop();
+    }
+
+    return *frame_lengths;
+}
+}  // namespace yas::test::simulated_device
+
+@interface yas_audio_simulated_device_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_simulated_device_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    auto const device = audio::simulated_device::make_shared({.output_format = format});
+
+    XCTAssertFalse(device->input_format().has_value());
+    XCTAssertEqual(device->output_format(), format);
+    XCTAssertTrue(device->interruptor().has_value());
+    XCTAssertFalse(device->is_interrupting());
+
+    XCTAssertThrows(audio::simulated_device::make_shared({}));
+    XCTAssertThrows(audio::simulated_device::make_shared({.output_format = format, .late_probability = 2.0}));
+}
+
+- (void)test_variable_frame_lengths {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    auto const device =
+        audio::simulated_device::make_shared({.output_format = format, .seed = 1, .minimum_frames_per_slice = 64});
+    auto const frame_lengths = test::simulated_device::render_frame_lengths(device, 20);
+
+    XCTAssertEqual(frame_lengths.size(), 20);
+
+    for (uint32_t const frame_length : frame_lengths) {
+        XCTAssertGreaterThanOrEqual(frame_length, 64);
+        XCTAssertLessThanOrEqual(frame_length, 256);
+    }
+
+    XCTAssertGreaterThan(std::set<uint32_t>(frame_lengths.begin(), frame_lengths.end()).size(), 1);
+
+    auto const same_device =
+        audio::simulated_device::make_shared({.output_format = format, .seed = 1, .minimum_frames_per_slice = 64});
+
+    XCTAssertEqual(test::simulated_device::render_frame_lengths(same_device, 20), frame_lengths);
+}
+
+- (void)test_late_slices {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    auto const device = audio::simulated_device::make_shared(
+        {.output_format = format, .late_probability = 1.0, .maximum_late_duration = 0.01});
+
+    test::simulated_device::render_frame_lengths(device, 10);
+
+    auto const statistics = device->statistics();
+    XCTAssertGreaterThanOrEqual(statistics.slice_count, 10);
+    XCTAssertEqual(statistics.late_slice_count, statistics.slice_count);
+    XCTAssertEqual(statistics.recovery_count, 0);
+
+    device->reset_statistics();
+    XCTAssertEqual(device->statistics().slice_count, 0);
+}
+
+- (void)test_change_formats {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const changed_format = audio::format({.sample_rate = 44100.0, .channel_count = 1});
+
+    auto const device = audio::simulated_device::make_shared({.output_format = format});
+    auto const io = audio::io::make_shared(device);
+
+    std::vector<audio::io::device_method> methods;
+    auto canceller = io->observe_device([&methods](auto const &pair) { methods.push_back(pair.first); }).end();
+
+    std::atomic<double> sample_rate{0.0};
+
+    io->set_maximum_frames_per_slice(256);
+    io->set_render_handler(
+        [&sample_rate](audio::io_render_args args) { sample_rate = args.output_buffer->format().sample_rate(); });
+    io->start();
+
+    device->change_formats(std::nullopt, changed_format);
+
+    XCTAssertEqual(device->output_format(), changed_format);
+    XCTAssertEqual(methods.size(), 1);
+    XCTAssertEqual(methods.at(0), audio::io::device_method::updated);
+    XCTAssertTrue(io->is_running());
+
+    while (sample_rate != 44100.0) {
+        [NSThread sleepForTimeInterval:0.001];
+    }
+
+    io->stop();
+
+    auto const statistics = device->statistics();
+    XCTAssertEqual(statistics.recovery_count, 1);
+    XCTAssertGreaterThan(statistics.max_recovery_duration, 0.0);
+    XCTAssertGreaterThan(statistics.glitched_frame_count, 0);
+
+    XCTAssertThrows(device->change_formats(std::nullopt, std::nullopt));
+}
+
+- (void)test_interruption {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    auto const device = audio::simulated_device::make_shared({.output_format = format});
+    auto const io = audio::io::make_shared(device);
+
+    std::atomic<uint32_t> render_count{0};
+
+    io->set_maximum_frames_per_slice(256);
+    io->set_render_handler([&render_count](audio::io_render_args) { ++render_count; });
+    io->start();
+
+    device->begin_interruption();
+
+    XCTAssertTrue(io->is_interrupting());
+
+    uint32_t const interrupted_count = render_count;
+    [NSThread sleepForTimeInterval:0.02];
+    XCTAssertEqual(render_count, interrupted_count);
+
+    device->end_interruption();
+
+    XCTAssertFalse(io->is_interrupting());
+
+    while (render_count == interrupted_count) {
+        [NSThread sleepForTimeInterval:0.001];
+    }
+
+    io->stop();
+
+    XCTAssertEqual(device->statistics().recovery_count, 1);
+    XCTAssertGreaterThanOrEqual(device->statistics().max_recovery_duration, 0.0);
+}
+
+- (void)test_lose {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    auto const device = audio::simulated_device::make_shared({.output_format = format});
+    auto const io = audio::io::make_shared(device);
+
+    std::vector<audio::io::device_method> methods;
+    auto canceller = io->observe_device([&methods](auto const &pair) { methods.push_back(pair.first); }).end();
+
+    device->lose();
+
+    XCTAssertFalse(io->device().has_value());
+    XCTAssertEqual(methods.size(), 1);
+    XCTAssertEqual(methods.at(0), audio::io::device_method::changed);
+}
+
+@end
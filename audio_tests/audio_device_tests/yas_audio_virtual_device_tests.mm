@@ -0,0 +1,106 @@
+//
+//  yas_audio_virtual_device_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_virtual_device_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_virtual_device_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_format {
+    auto const input_format = audio::format({.sample_rate = 48000.0, .channel_count = 1});
+    auto const output_format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    auto const device = audio::virtual_device::make_shared(input_format, output_format);
+
+    XCTAssertEqual(device->input_format(), input_format);
+    XCTAssertEqual(device->output_format(), output_format);
+
+    XCTAssertThrows(audio::virtual_device::make_shared(std::nullopt, std::nullopt));
+    XCTAssertThrows(
+        audio::virtual_device::make_shared(audio::format({.sample_rate = 44100.0, .channel_count = 1}), output_format));
+}
+
+- (void)test_render {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const device = audio::virtual_device::make_shared(format, format);
+    auto const io_core = device->make_io_core();
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"render"];
+    expectation.expectedFulfillmentCount = 10;
+    expectation.assertForOverFulfill = NO;
+
+    auto const sample_times = std::make_shared<std::vector<int64_t>>();
+
+    io_core->set_maximum_frames_per_slice(480);
+    io_core->set_render_handler([expectation, sample_times](audio::io_render_args args) {
+        if (args.output_buffer && args.input_buffer && args.output_time.has_value() && args.input_time.has_value()) {
+            sample_times->push_back(args.output_time->sample_time());
+            [expectation fulfill];
+        }
+    });
+
+    XCTAssertTrue(io_core->start());
+    XCTAssertFalse(io_core->start());
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    io_core->stop();
+
+    XCTAssertGreaterThanOrEqual(sample_times->size(), 10);
+    XCTAssertEqual(sample_times->at(0), 0);
+
+    auto const statistics = device->statistics();
+    XCTAssertEqual(statistics.slice_count, sample_times->size());
+    XCTAssertGreaterThanOrEqual(statistics.max_jitter, statistics.mean_jitter);
+
+    device->reset_statistics();
+    XCTAssertEqual(device->statistics().slice_count, 0);
+}
+
+- (void)test_deadline_miss {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const device = audio::virtual_device::make_shared(std::nullopt, format);
+    auto const io_core = device->make_io_core();
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"render"];
+    expectation.expectedFulfillmentCount = 2;
+    expectation.assertForOverFulfill = NO;
+
+    auto const sample_times = std::make_shared<std::vector<int64_t>>();
+
+    io_core->set_maximum_frames_per_slice(480);
+    io_core->set_render_handler([expectation, sample_times](audio::io_render_args args) {
+        sample_times->push_back(args.output_time->sample_time());
+
+        if (sample_times->size() == 1) {
+            [NSThread sleepForTimeInterval:0.035];
+        }
+
+        [expectation fulfill];
+    });
+
+    XCTAssertTrue(io_core->start());
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    io_core->stop();
+
+    XCTAssertGreaterThanOrEqual(device->statistics().deadline_miss_count, 3);
+    XCTAssertGreaterThanOrEqual(sample_times->at(1) - sample_times->at(0), 480 * 4);
+}
+
+@end
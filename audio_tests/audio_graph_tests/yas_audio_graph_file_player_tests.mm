@@ -0,0 +1,87 @@
+//
+//  yas_audio_graph_file_player_tests.mm
+//
+
+#import <thread>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::graph_file_player {
+static std::string const dir_name = "yas_audio_graph_file_player_test_files";
+}  // namespace yas::test::graph_file_player
+
+@interface yas_audio_graph_file_player_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_graph_file_player_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::setup_test_directory(test::graph_file_player::dir_name);
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_bus_count {
+    auto const url = test::write_test_file(test::graph_file_player::dir_name, "player.wav", audio::file_type::wave,
+                                           test::make_file_format(2, 32, true), 100);
+    auto const pool = audio::file_stream_pool::make_shared({});
+    auto const stream =
+        audio::file_stream::make_shared({.file = audio::file::make_opened({.file_url = url}).value(), .pool = pool});
+    auto const player = audio::graph_file_player::make_shared(stream);
+
+    XCTAssertEqual(player->node->input_bus_count(), 0);
+    XCTAssertEqual(player->node->output_bus_count(), 1);
+    XCTAssertEqual(player->stream(), stream);
+}
+
+- (void)test_render {
+    uint32_t const frame_length = 256;
+    auto const url = test::write_test_file(test::graph_file_player::dir_name, "player.wav", audio::file_type::wave,
+                                           test::make_file_format(2, 32, true), frame_length * 2);
+    auto const pool = audio::file_stream_pool::make_shared({});
+    auto const stream =
+        audio::file_stream::make_shared({.file = audio::file::make_opened({.file_url = url}).value(), .pool = pool});
+    auto const &format = stream->format();
+
+    for (uint32_t count = 0; count < 1000 && !stream->is_ended(); ++count) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    stream->play();
+
+    auto const graph = audio::graph::make_shared();
+    auto const player = audio::graph_file_player::make_shared(stream);
+
+    audio::pcm_buffer rendered_buffer{format, frame_length * 2};
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"completion"];
+
+    auto const device = audio::offline_device::make_shared(
+        format,
+        [&rendered_buffer, count = uint32_t(0)](audio::offline_render_args args) mutable {
+            uint32_t const length = args.output_buffer->frame_length();
+            rendered_buffer.copy_from(*args.output_buffer, {.to_begin_frame = count * length, .length = length});
+            return ++count < 2 ? audio::continuation::keep : audio::continuation::abort;
+        },
+        [&expectation](bool const) { [expectation fulfill]; });
+
+    auto const &offline_io = graph->add_io(device);
+    offline_io->raw_io()->set_maximum_frames_per_slice(frame_length);
+
+    graph->connect(player->node, offline_io->output_node, format);
+
+    XCTAssertTrue(graph->start_render());
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    XCTAssertTrue(test::is_filled_file_values(rendered_buffer, 0));
+    XCTAssertEqual(stream->statistics().underrun_count, 0);
+}
+
+@end
@@ -0,0 +1,189 @@
+//
+//  yas_audio_graph_mixer_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::graph_mixer {
+static audio::node_render_f make_fill_handler(float const value, std::vector<uint32_t> *called_buses = nullptr) {
+    return [value, called_buses](audio::node_render_args const &args) {
+        if (called_buses) {
+            called_buses->push_back(args.bus_idx);
+        }
+
+        auto each = audio::make_each_data<float>(*args.buffer);
+        while (yas_each_data_next(each)) {
+            yas_each_data_value(each) = value;
+        }
+    };
+}
+}  // namespace yas::test::graph_mixer
+
+@interface yas_audio_graph_mixer_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_graph_mixer_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_parameters {
+    auto const mixer = audio::graph_mixer::make_shared();
+
+    XCTAssertEqual(mixer->input_volume(0), 1.0f);
+    XCTAssertEqual(mixer->input_pan(0), 0.0f);
+    XCTAssertTrue(mixer->input_enabled(0));
+    XCTAssertEqual(mixer->output_volume(0), 1.0f);
+    XCTAssertEqual(mixer->output_pan(0), 0.0f);
+
+    mixer->set_input_volume(0.5f, 3);
+    mixer->set_input_pan(-0.25f, 3);
+    mixer->set_input_enabled(false, 3);
+    mixer->set_output_volume(0.75f, 0);
+    mixer->set_output_pan(0.5f, 0);
+
+    XCTAssertEqual(mixer->input_volume(3), 0.5f);
+    XCTAssertEqual(mixer->input_pan(3), -0.25f);
+    XCTAssertFalse(mixer->input_enabled(3));
+    XCTAssertEqual(mixer->input_volume(0), 1.0f);
+    XCTAssertEqual(mixer->output_volume(0), 0.75f);
+    XCTAssertEqual(mixer->output_pan(0), 0.5f);
+
+    XCTAssertThrows(mixer->set_output_volume(1.0f, 1));
+    XCTAssertThrows(mixer->output_volume(1));
+}
+
+- (void)test_render {
+    auto const graph = audio::graph::make_shared();
+    auto const mixer = audio::graph_mixer::make_shared();
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    test::node_object src_obj_0(0, 1);
+    test::node_object src_obj_1(0, 1);
+    test::node_object src_obj_2(0, 1);
+
+    graph->connect(src_obj_0.node, mixer->node, 0, 0, format);
+    graph->connect(src_obj_1.node, mixer->node, 0, 1, format);
+    graph->connect(src_obj_2.node, mixer->node, 0, 2, format);
+
+    mixer->set_input_volume(0.5f, 0);
+    mixer->set_input_pan(1.0f, 1);
+    mixer->set_input_enabled(false, 2);
+
+    audio::renderable_graph_node::cast(mixer->node)->prepare_rendering();
+
+    std::vector<uint32_t> called_buses;
+
+    audio::rendering_node const src_node_0{test::graph_mixer::make_fill_handler(1.0f, &called_buses), {}};
+    audio::rendering_node const src_node_1{test::graph_mixer::make_fill_handler(0.25f, &called_buses), {}};
+    audio::rendering_node const src_node_2{test::graph_mixer::make_fill_handler(2.0f, &called_buses), {}};
+
+    audio::rendering_connection_map const connections{{0, {0, &src_node_0, format}},
+                                                      {1, {1, &src_node_1, format}},
+                                                      {2, {2, &src_node_2, format}}};
+
+    audio::pcm_buffer buffer{format, 8};
+    audio::time const time{0, 48000.0};
+
+    mixer->node->render_handler()({.buffer = &buffer, .bus_idx = 0, .time = time, .source_connections = connections});
+
+    XCTAssertEqual(called_buses.size(), 2);
+    XCTAssertEqual(called_buses.at(0), 0);
+    XCTAssertEqual(called_buses.at(1), 1);
+
+    float const *left = buffer.data_ptr_at_channel<float>(0);
+    float const *right = buffer.data_ptr_at_channel<float>(1);
+
+    for (uint32_t frame = 0; frame < 8; ++frame) {
+        XCTAssertEqualWithAccuracy(left[frame], 0.5f, 0.0001f);
+        XCTAssertEqualWithAccuracy(right[frame], 0.75f, 0.0001f);
+    }
+}
+
+- (void)test_render_smoothed_volume {
+    auto const graph = audio::graph::make_shared();
+    auto const mixer = audio::graph_mixer::make_shared();
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    test::node_object src_obj(0, 1);
+    graph->connect(src_obj.node, mixer->node, format);
+
+    audio::renderable_graph_node::cast(mixer->node)->prepare_rendering();
+
+    audio::rendering_node const src_node{test::graph_mixer::make_fill_handler(1.0f), {}};
+    audio::rendering_connection_map const connections{{0, {0, &src_node, format}}};
+
+    audio::pcm_buffer buffer{format, 4};
+    audio::time const time{0, 48000.0};
+    auto const handler = mixer->node->render_handler();
+
+    handler({.buffer = &buffer, .bus_idx = 0, .time = time, .source_connections = connections});
+
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[0], 1.0f);
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[3], 1.0f);
+
+    mixer->set_input_volume(0.0f, 0);
+
+    handler({.buffer = &buffer, .bus_idx = 0, .time = time, .source_connections = connections});
+
+    float const *data = buffer.data_ptr_at_index<float>(0);
+    XCTAssertEqualWithAccuracy(data[0], 1.0f, 0.0001f);
+    XCTAssertEqualWithAccuracy(data[1], 0.75f, 0.0001f);
+    XCTAssertEqualWithAccuracy(data[2], 0.5f, 0.0001f);
+    XCTAssertEqualWithAccuracy(data[3], 0.25f, 0.0001f);
+
+    handler({.buffer = &buffer, .bus_idx = 0, .time = time, .source_connections = connections});
+
+    XCTAssertEqual(data[0], 0.0f);
+    XCTAssertEqual(data[3], 0.0f);
+}
+
+- (void)test_render_64_inputs_performance {
+    uint32_t const input_count = 64;
+    uint32_t const frame_length = 512;
+
+    auto const graph = audio::graph::make_shared();
+    auto const mixer = audio::graph_mixer::make_shared();
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    std::vector<audio::graph_node_ptr> src_graph_nodes;
+    std::vector<std::unique_ptr<audio::rendering_node>> src_nodes;
+    audio::rendering_connection_map connections;
+
+    for (uint32_t idx = 0; idx < input_count; ++idx) {
+        auto const &src_graph_node =
+            src_graph_nodes.emplace_back(audio::graph_node::make_shared({.input_bus_count = 0, .output_bus_count = 1}));
+        graph->connect(src_graph_node, mixer->node, 0, idx, format);
+        mixer->set_input_pan(static_cast<float>(idx) / input_count * 2.0f - 1.0f, idx);
+
+        src_nodes.emplace_back(std::make_unique<audio::rendering_node>(
+            test::graph_mixer::make_fill_handler(1.0f / input_count), audio::rendering_connection_map{}));
+        connections.emplace(idx, audio::rendering_connection{0, src_nodes.back().get(), format});
+    }
+
+    audio::renderable_graph_node::cast(mixer->node)->prepare_rendering();
+
+    auto const handler = mixer->node->render_handler();
+    audio::pcm_buffer buffer{format, frame_length};
+    audio::time const time{0, 48000.0};
+
+    auto *const buffer_ptr = &buffer;
+    auto const *const connections_ptr = &connections;
+    auto const *const time_ptr = &time;
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            handler({.buffer = buffer_ptr, .bus_idx = 0, .time = *time_ptr, .source_connections = *connections_ptr});
+        }
+    }];
+}
+
+@end
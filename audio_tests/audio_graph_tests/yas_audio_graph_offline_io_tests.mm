@@ -7,6 +7,58 @@
 
 using namespace yas;
 
+namespace yas::test::graph_offline_io {
+struct block_sink : audio::offline_sink {
+    std::vector<std::pair<int64_t, uint32_t>> blocks;
+    uint64_t frame_length = 0;
+    bool is_recording = true;
+
+    audio::continuation write(audio::pcm_buffer const &buffer, audio::time const &time) override {
+        if (this->is_recording) {
+            this->blocks.emplace_back(time.sample_time(), buffer.frame_length());
+        }
+        this->frame_length += buffer.frame_length();
+        return audio::continuation::keep;
+    }
+};
+
+// bounces a sine wave from a tap node through a graph and returns when completed.
+static void bounce(XCTestCase *test_case, std::shared_ptr<block_sink> const &sink, uint32_t const block_frames,
+                   uint64_t const frame_length, std::vector<int64_t> const &split_sample_times = {}) {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const graph = audio::graph::make_shared();
+    auto const tap = audio::graph_tap::make_shared();
+
+    tap->set_render_handler([](audio::node_render_args const &args) {
+        double const phase_per_frame = 440.0 * 2.0 * M_PI / 48000.0;
+        auto each = audio::make_each_block<float>(*args.buffer);
+        while (each.next()) {
+            float *const data = each.data();
+            for (uint32_t idx = 0; idx < each.length(); ++idx) {
+                data[idx * each.stride()] = static_cast<float>(
+                    std::sin(phase_per_frame * static_cast<double>(args.time.sample_time() + each.frame() + idx)));
+            }
+        }
+    });
+
+    XCTestExpectation *expectation = [test_case expectationWithDescription:@"completion"];
+
+    auto const device = audio::offline_device::make_shared(
+        {.output_format = format,
+         .stream = audio::offline_stream_args{
+             .sink = sink, .frame_length = frame_length, .split_sample_times = split_sample_times},
+         .completion_handler = [&expectation](bool const) { [expectation fulfill]; }});
+
+    auto const &offline_io = graph->add_io(device);
+    offline_io->raw_io()->set_maximum_frames_per_slice(block_frames);
+
+    graph->connect(tap->node, offline_io->output_node, format);
+    graph->start_render();
+
+    [test_case waitForExpectations:@[expectation] timeout:60.0];
+}
+}  // namespace yas::test::graph_offline_io
+
 @interface yas_audio_graph_offline_io_tests : XCTestCase
 
 @end
@@ -181,4 +233,32 @@ using namespace yas;
     XCTAssertFalse(graph->io().value()->raw_io()->is_running());
 }
 
+- (void)test_offline_stream_with_graph {
+    auto const sink = std::make_shared<test::graph_offline_io::block_sink>();
+
+    test::graph_offline_io::bounce(self, sink, 4096, 10000, {5000, 100, 4200});
+
+    std::vector<std::pair<int64_t, uint32_t>> const expected{{0, 100},    {100, 4096},  {4196, 4},
+                                                             {4200, 800}, {5000, 4096}, {9096, 904}};
+
+    XCTAssertEqual(sink->blocks, expected);
+    XCTAssertEqual(sink->frame_length, 10000);
+}
+
+- (void)test_measure_offline_stream_4096 {
+    [self measureBlock:^{
+        auto const sink = std::make_shared<test::graph_offline_io::block_sink>();
+        sink->is_recording = false;
+        test::graph_offline_io::bounce(self, sink, 4096, 48000 * 60);
+    }];
+}
+
+- (void)test_measure_offline_stream_65536 {
+    [self measureBlock:^{
+        auto const sink = std::make_shared<test::graph_offline_io::block_sink>();
+        sink->is_recording = false;
+        test::graph_offline_io::bounce(self, sink, 65536, 48000 * 60);
+    }];
+}
+
 @end
@@ -0,0 +1,117 @@
+//
+//  yas_audio_graph_resampler_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_graph_resampler_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_graph_resampler_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_quality {
+    auto const resampler = audio::graph_resampler::make_shared(audio::dsp::resampler_quality::low);
+
+    XCTAssertEqual(resampler->quality(), audio::dsp::resampler_quality::low);
+
+    resampler->set_quality(audio::dsp::resampler_quality::high);
+
+    XCTAssertEqual(resampler->quality(), audio::dsp::resampler_quality::high);
+}
+
+- (void)test_render {
+    auto const graph = audio::graph::make_shared();
+    auto const resampler = audio::graph_resampler::make_shared();
+    audio::format const input_format{{.sample_rate = 44100.0, .channel_count = 2}};
+    audio::format const output_format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    test::node_object src_obj(0, 1);
+    test::node_object dst_obj(1, 0);
+
+    graph->connect(src_obj.node, resampler->node, input_format);
+    graph->connect(resampler->node, dst_obj.node, output_format);
+
+    audio::renderable_graph_node::cast(resampler->node)->prepare_rendering();
+
+    std::vector<uint32_t> src_frame_lengths;
+    std::vector<int64_t> src_sample_times;
+    std::vector<double> src_sample_rates;
+
+    auto const src_handler = [&src_frame_lengths, &src_sample_times,
+                              &src_sample_rates](audio::node_render_args const &args) {
+        src_frame_lengths.push_back(args.buffer->frame_length());
+        src_sample_times.push_back(args.time.sample_time());
+        src_sample_rates.push_back(args.buffer->format().sample_rate());
+
+        auto each = audio::make_each_data<float>(*args.buffer);
+        while (yas_each_data_next(each)) {
+            yas_each_data_value(each) = 1.0f;
+        }
+    };
+
+    audio::rendering_node const src_node{src_handler, {}};
+    audio::rendering_connection_map const connections{{0, {0, &src_node, input_format}}};
+
+    audio::pcm_buffer buffer{output_format, 512};
+    auto const handler = resampler->node->render_handler();
+
+    handler({.buffer = &buffer, .bus_idx = 0, .time = audio::time{0, 48000.0}, .source_connections = connections});
+    handler({.buffer = &buffer, .bus_idx = 0, .time = audio::time{512, 48000.0}, .source_connections = connections});
+
+    XCTAssertEqual(src_frame_lengths.size(), 2);
+    XCTAssertEqual(src_sample_times.at(0), 0);
+    XCTAssertEqual(src_sample_times.at(1), src_frame_lengths.at(0));
+    XCTAssertLessThanOrEqual(src_frame_lengths.at(1), 472);
+    XCTAssertEqual(src_sample_rates.at(0), 44100.0);
+
+    for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+        float const *data = buffer.data_ptr_at_channel<float>(ch_idx);
+        XCTAssertEqualWithAccuracy(data[0], 1.0f, 0.001f);
+        XCTAssertEqualWithAccuracy(data[511], 1.0f, 0.001f);
+    }
+}
+
+- (void)test_render_unsupported_format {
+    auto const graph = audio::graph::make_shared();
+    auto const resampler = audio::graph_resampler::make_shared();
+    audio::format const input_format{{.sample_rate = 44100.0, .channel_count = 1}};
+    audio::format const output_format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    test::node_object src_obj(0, 1);
+    test::node_object dst_obj(1, 0);
+
+    graph->connect(src_obj.node, resampler->node, input_format);
+    graph->connect(resampler->node, dst_obj.node, output_format);
+
+    audio::renderable_graph_node::cast(resampler->node)->prepare_rendering();
+
+    bool is_src_called = false;
+    audio::rendering_node const src_node{[&is_src_called](auto const &) { is_src_called = true; }, {}};
+    audio::rendering_connection_map const connections{{0, {0, &src_node, input_format}}};
+
+    audio::pcm_buffer buffer{output_format, 4};
+    auto each = audio::make_each_data<float>(buffer);
+    while (yas_each_data_next(each)) {
+        yas_each_data_value(each) = 1.0f;
+    }
+
+    resampler->node->render_handler()(
+        {.buffer = &buffer, .bus_idx = 0, .time = audio::time{0, 48000.0}, .source_connections = connections});
+
+    XCTAssertFalse(is_src_called);
+    XCTAssertEqual(buffer.data_ptr_at_channel<float>(0)[0], 0.0f);
+    XCTAssertEqual(buffer.data_ptr_at_channel<float>(1)[3], 0.0f);
+}
+
+@end
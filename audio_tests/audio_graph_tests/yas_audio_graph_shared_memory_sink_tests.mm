@@ -0,0 +1,99 @@
+//
+//  yas_audio_graph_shared_memory_sink_tests.mm
+//
+
+#include <TargetConditionals.h>
+
+#if (TARGET_OS_MAC && !TARGET_OS_IPHONE)
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_graph_shared_memory_sink_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_graph_shared_memory_sink_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_bus_count {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const ring =
+        audio::shared_memory_ring::make_created({.name = "yas_audio_test_sink", .format = format, .frame_capacity = 64})
+            .value();
+    auto const sink = audio::graph_shared_memory_sink::make_shared(ring);
+
+    XCTAssertEqual(sink->node->input_bus_count(), 1);
+    XCTAssertEqual(sink->node->output_bus_count(), 1);
+    XCTAssertEqual(sink->ring(), ring);
+}
+
+- (void)test_render {
+    uint32_t const frame_length = 256;
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const writer = audio::shared_memory_ring::make_created(
+                            {.name = "yas_audio_test_sink", .format = format, .frame_capacity = frame_length * 4})
+                            .value();
+    auto const reader = audio::shared_memory_ring::make_opened({.name = "yas_audio_test_sink"}).value();
+
+    auto const graph = audio::graph::make_shared();
+    auto const sink = audio::graph_shared_memory_sink::make_shared(writer);
+    auto const tap = audio::graph_tap::make_shared();
+
+    tap->set_render_handler([](audio::node_render_args const &args) {
+        auto each = audio::make_each_block<float>(*args.buffer);
+        while (each.next()) {
+            float *const data = each.data();
+            for (uint32_t idx = 0; idx < each.length(); ++idx) {
+                data[idx * each.stride()] = static_cast<float>(args.time.sample_time() + each.frame() + idx);
+            }
+        }
+    });
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"completion"];
+
+    auto const device = audio::offline_device::make_shared(
+        format,
+        [count = uint32_t(0)](audio::offline_render_args args) mutable {
+            return ++count < 2 ? audio::continuation::keep : audio::continuation::abort;
+        },
+        [&expectation](bool const) { [expectation fulfill]; });
+
+    auto const &offline_io = graph->add_io(device);
+    offline_io->raw_io()->set_maximum_frames_per_slice(frame_length);
+
+    graph->connect(tap->node, sink->node, format);
+    graph->connect(sink->node, offline_io->output_node, format);
+
+    XCTAssertTrue(graph->start_render());
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    audio::pcm_buffer buffer{format, frame_length * 2};
+
+    XCTAssertEqual(reader->read(buffer).value(), frame_length * 2);
+    XCTAssertEqual(reader->read_time()->sample_time(), 0);
+
+    bool is_rendered = true;
+    for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+        float const *const data = buffer.data_ptr_at_channel<float>(ch_idx);
+        for (uint32_t frame = 0; frame < buffer.frame_length(); ++frame) {
+            if (data[frame] != static_cast<float>(frame)) {
+                is_rendered = false;
+            }
+        }
+    }
+    XCTAssertTrue(is_rendered);
+}
+
+@end
+
+#endif
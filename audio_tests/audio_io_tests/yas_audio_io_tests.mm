@@ -112,4 +112,40 @@ using namespace yas::audio;
     XCTAssertEqual(called_methods.at(7), method::stop);
 }
 
+- (void)test_render_thread_policy {
+    auto const device = std::make_shared<test::test_io_device>();
+
+    auto const core = std::make_shared<test::test_io_core>();
+    device->make_io_core_handler = [core]() { return core; };
+
+    std::vector<audio::render_thread_policy> called_policies;
+
+    core->set_render_thread_policy_handler = [&called_policies](audio::render_thread_policy const &policy) {
+        called_policies.emplace_back(policy);
+    };
+    core->render_thread_policy_errors_value = {audio::render_thread_policy::error_t::scheduling_failed};
+
+    auto const io = audio::io::make_shared(device);
+
+    XCTAssertEqual(called_policies.size(), 1);
+    XCTAssertTrue(called_policies.at(0) == audio::render_thread_policy{});
+
+    audio::render_thread_policy const policy{.scheduling = audio::render_thread_policy::scheduling_t::fifo,
+                                             .prefaults_buffers = true};
+
+    io->set_render_thread_policy(policy);
+
+    XCTAssertTrue(io->render_thread_policy() == policy);
+    XCTAssertEqual(called_policies.size(), 2);
+    XCTAssertTrue(called_policies.at(1) == policy);
+
+    XCTAssertEqual(io->render_thread_policy_errors().size(), 1);
+    XCTAssertEqual(io->render_thread_policy_errors().at(0), audio::render_thread_policy::error_t::scheduling_failed);
+
+    device->notifier->notify(audio::io_device::method::updated);
+
+    XCTAssertEqual(called_policies.size(), 3);
+    XCTAssertTrue(called_policies.at(2) == policy);
+}
+
 @end
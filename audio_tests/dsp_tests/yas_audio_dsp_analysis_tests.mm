@@ -0,0 +1,70 @@
+//
+//  yas_audio_dsp_analysis_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_dsp_analysis_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_dsp_analysis_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_analysis {
+    for (uint32_t const length : {0, 1, 3, 4, 7, 100, 1027}) {
+        std::vector<float> data(length);
+        double sum = 0.0;
+        double sum_of_squares = 0.0;
+        float peak = 0.0f;
+
+        for (uint32_t idx = 0; idx < length; ++idx) {
+            data[idx] = 0.8f * std::sin(static_cast<float>(idx) * 0.37f) + 0.1f;
+            sum += data[idx];
+            sum_of_squares += data[idx] * data[idx];
+            peak = std::max(peak, std::fabs(data[idx]));
+        }
+
+        XCTAssertEqual(audio::dsp::peak(data.data(), length), peak);
+        XCTAssertEqualWithAccuracy(audio::dsp::sum(data.data(), length), sum, 1.0e-3);
+        XCTAssertEqualWithAccuracy(audio::dsp::sum_of_squares(data.data(), length), sum_of_squares, 1.0e-3);
+        XCTAssertTrue(audio::dsp::is_finite(data.data(), length));
+    }
+}
+
+- (void)test_is_finite {
+    float const invalid_values[3] = {std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                                     std::numeric_limits<float>::quiet_NaN()};
+
+    for (float const invalid_value : invalid_values) {
+        for (uint32_t const idx : {0, 5, 6}) {
+            std::vector<float> data(7, 1.0f);
+            data[idx] = invalid_value;
+            XCTAssertFalse(audio::dsp::is_finite(data.data(), 7));
+        }
+    }
+}
+
+- (void)test_measure_peak {
+    uint32_t const length = 4096;
+    auto const data = std::make_shared<std::vector<float>>(length, 0.5f);
+
+    [self measureBlock:^{
+        float peak = 0.0f;
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            peak = std::max(peak, audio::dsp::peak(data->data(), length));
+        }
+        XCTAssertEqual(peak, 0.5f);
+    }];
+}
+
+@end
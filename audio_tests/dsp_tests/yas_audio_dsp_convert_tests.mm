@@ -0,0 +1,256 @@
+//
+//  yas_audio_dsp_convert_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::dsp_convert {
+static std::vector<audio::dsp::sample_type> const sample_types{
+    audio::dsp::sample_type::float32, audio::dsp::sample_type::float64, audio::dsp::sample_type::int16,
+    audio::dsp::sample_type::int24,   audio::dsp::sample_type::int32,   audio::dsp::sample_type::fixed824};
+
+static float tolerance(audio::dsp::sample_type const type) {
+    switch (type) {
+        case audio::dsp::sample_type::int16:
+            return 1.0f / 32768.0f;
+        case audio::dsp::sample_type::int24:
+            return 1.0f / 8388608.0f;
+        case audio::dsp::sample_type::float32:
+        case audio::dsp::sample_type::float64:
+        case audio::dsp::sample_type::int32:
+        case audio::dsp::sample_type::fixed824:
+            return 1.0e-7f;
+    }
+}
+
+static std::vector<float> make_source(uint32_t const length) {
+    std::vector<float> source(length);
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        source[idx] = 0.9f * std::sin(static_cast<float>(idx) * 0.01f);
+    }
+    return source;
+}
+}  // namespace yas::test::dsp_convert
+
+@interface yas_audio_dsp_convert_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_dsp_convert_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_to_dsp_sample_type {
+    XCTAssertTrue(audio::dsp::to_dsp_sample_type(audio::pcm_format::float32) == audio::dsp::sample_type::float32);
+    XCTAssertTrue(audio::dsp::to_dsp_sample_type(audio::pcm_format::float64) == audio::dsp::sample_type::float64);
+    XCTAssertTrue(audio::dsp::to_dsp_sample_type(audio::pcm_format::int16) == audio::dsp::sample_type::int16);
+    XCTAssertTrue(audio::dsp::to_dsp_sample_type(audio::pcm_format::fixed824) == audio::dsp::sample_type::fixed824);
+    XCTAssertFalse(audio::dsp::to_dsp_sample_type(audio::pcm_format::other));
+
+    XCTAssertEqual(audio::dsp::sample_byte_count(audio::dsp::sample_type::int24), 3);
+    XCTAssertEqual(audio::dsp::sample_byte_count(audio::dsp::sample_type::int32), 4);
+}
+
+- (void)test_convert_every_pair {
+    uint32_t const length = 1003;
+    auto const source = test::dsp_convert::make_source(length);
+
+    for (auto const &src_type : test::dsp_convert::sample_types) {
+        for (auto const &dst_type : test::dsp_convert::sample_types) {
+            for (uint32_t const stride : {1, 3}) {
+                std::vector<uint8_t> src_data(length * stride * sizeof(double));
+                std::vector<uint8_t> dst_data(length * stride * sizeof(double));
+                std::vector<float> result(length);
+
+                audio::dsp::convert_from_float32(source.data(), src_data.data(), src_type, stride, length);
+                audio::dsp::convert(src_data.data(), src_type, stride, dst_data.data(), dst_type, 1, length);
+                audio::dsp::convert_to_float32(dst_data.data(), dst_type, 1, result.data(), length);
+
+                float const tolerance = std::max(test::dsp_convert::tolerance(src_type),
+                                                 test::dsp_convert::tolerance(dst_type));
+                float max_error = 0.0f;
+                for (uint32_t idx = 0; idx < length; ++idx) {
+                    max_error = std::max(max_error, std::fabs(result[idx] - source[idx]));
+                }
+
+                XCTAssertLessThanOrEqual(max_error, tolerance);
+            }
+        }
+    }
+}
+
+- (void)test_int24_packing {
+    float const source[3] = {1.0f, -1.0f, 0.5f};
+    uint8_t packed[9] = {0};
+
+    audio::dsp::convert_from_float32(source, packed, audio::dsp::sample_type::int24, 1, 3);
+
+    uint8_t const expected[9] = {0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40};
+    XCTAssertEqual(std::memcmp(packed, expected, 9), 0);
+
+    float result[3];
+    audio::dsp::convert_to_float32(packed, audio::dsp::sample_type::int24, 1, result, 3);
+
+    XCTAssertEqualWithAccuracy(result[0], 1.0f, 1.0f / 8388608.0f);
+    XCTAssertEqual(result[1], -1.0f);
+    XCTAssertEqual(result[2], 0.5f);
+}
+
+- (void)test_clamp {
+    float const source[5] = {2.0f, -2.0f, 1.0f, -1.0f, 0.0f};
+    int16_t int16_data[5];
+    int32_t int32_data[5];
+
+    audio::dsp::convert_from_float32(source, int16_data, audio::dsp::sample_type::int16, 1, 5);
+    audio::dsp::convert_from_float32(source, int32_data, audio::dsp::sample_type::int32, 1, 5);
+
+    XCTAssertEqual(int16_data[0], INT16_MAX);
+    XCTAssertEqual(int16_data[1], INT16_MIN);
+    XCTAssertEqual(int16_data[2], INT16_MAX);
+    XCTAssertEqual(int16_data[3], INT16_MIN);
+    XCTAssertEqual(int16_data[4], 0);
+
+    XCTAssertGreaterThan(int32_data[0], INT32_MAX - 256);
+    XCTAssertEqual(int32_data[1], INT32_MIN);
+    XCTAssertEqual(int32_data[3], INT32_MIN);
+    XCTAssertEqual(int32_data[4], 0);
+}
+
+- (void)test_convert_precision_via_float64 {
+    int32_t const int32_source[3] = {2147483000, INT32_MIN, 123456789};
+    double float64_data[3];
+
+    audio::dsp::convert(int32_source, audio::dsp::sample_type::int32, 1, float64_data, audio::dsp::sample_type::float64,
+                        1, 3);
+
+    XCTAssertEqual(float64_data[0], 2147483000.0 / 2147483648.0);
+    XCTAssertEqual(float64_data[1], -1.0);
+    XCTAssertEqual(float64_data[2], 123456789.0 / 2147483648.0);
+
+    int32_t int32_result[3];
+
+    audio::dsp::convert(float64_data, audio::dsp::sample_type::float64, 1, int32_result, audio::dsp::sample_type::int32,
+                        1, 3);
+
+    XCTAssertEqual(std::memcmp(int32_result, int32_source, sizeof(int32_source)), 0);
+
+    // strided.
+    int32_t const fixed824_source[6] = {INT32_MAX, 0, -16777217, 0, 1, 0};
+    int32_t fixed824_result[6] = {0};
+
+    audio::dsp::convert(fixed824_source, audio::dsp::sample_type::fixed824, 2, float64_data,
+                        audio::dsp::sample_type::float64, 1, 3);
+
+    XCTAssertEqual(float64_data[0], 2147483647.0 / 16777216.0);
+    XCTAssertEqual(float64_data[1], -16777217.0 / 16777216.0);
+    XCTAssertEqual(float64_data[2], 1.0 / 16777216.0);
+
+    audio::dsp::convert(float64_data, audio::dsp::sample_type::float64, 1, fixed824_result,
+                        audio::dsp::sample_type::fixed824, 2, 3);
+
+    XCTAssertEqual(std::memcmp(fixed824_result, fixed824_source, sizeof(fixed824_source)), 0);
+
+    double const clamped_source[2] = {2.0, -2.0};
+    audio::dsp::convert(clamped_source, audio::dsp::sample_type::float64, 1, int32_result,
+                        audio::dsp::sample_type::int32, 1, 2);
+
+    XCTAssertEqual(int32_result[0], INT32_MAX);
+    XCTAssertEqual(int32_result[1], INT32_MIN);
+}
+
+- (void)test_tpdf_dither {
+    uint32_t const length = 10000;
+    std::vector<float> silence(length, 0.0f);
+    std::vector<int16_t> plain(length);
+    std::vector<int16_t> dithered(length);
+
+    audio::dsp::tpdf_dither dither;
+
+    audio::dsp::convert_from_float32(silence.data(), plain.data(), audio::dsp::sample_type::int16, 1, length);
+    audio::dsp::convert_from_float32(silence.data(), dithered.data(), audio::dsp::sample_type::int16, 1, length,
+                                     &dither);
+
+    uint32_t nonzero_count = 0;
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        XCTAssertEqual(plain[idx], 0);
+        XCTAssertLessThanOrEqual(std::abs(dithered[idx]), 1);
+        if (dithered[idx] != 0) {
+            ++nonzero_count;
+        }
+    }
+
+    XCTAssertGreaterThan(nonzero_count, length / 8);
+    XCTAssertLessThan(nonzero_count, length / 2);
+
+    std::vector<float> float_result(length, 1.0f);
+    audio::dsp::convert_from_float32(silence.data(), float_result.data(), audio::dsp::sample_type::float32, 1, length,
+                                     &dither);
+    XCTAssertEqual(float_result[0], 0.0f);
+}
+
+- (void)test_measure_conversion_matrix {
+    uint32_t const length = 4096;
+    auto const source = test::dsp_convert::make_source(length);
+
+    auto const type_count = test::dsp_convert::sample_types.size();
+    auto buffers = std::make_shared<std::vector<std::vector<uint8_t>>>(
+        type_count * 2, std::vector<uint8_t>(length * 2 * sizeof(double)));
+
+    for (std::size_t idx = 0; idx < type_count; ++idx) {
+        auto const &type = test::dsp_convert::sample_types.at(idx);
+        audio::dsp::convert_from_float32(source.data(), buffers->at(idx).data(), type, 1, length);
+        audio::dsp::convert_from_float32(source.data(), buffers->at(type_count + idx).data(), type, 2, length);
+    }
+
+    auto output = std::make_shared<std::vector<uint8_t>>(length * 2 * sizeof(double));
+
+    [self measureBlock:^{
+        for (std::size_t src_idx = 0; src_idx < type_count; ++src_idx) {
+            for (std::size_t dst_idx = 0; dst_idx < type_count; ++dst_idx) {
+                auto const &src_type = test::dsp_convert::sample_types.at(src_idx);
+                auto const &dst_type = test::dsp_convert::sample_types.at(dst_idx);
+
+                // non-interleaved, interleaved source, interleaved destination
+                audio::dsp::convert(buffers->at(src_idx).data(), src_type, 1, output->data(), dst_type, 1, length);
+                audio::dsp::convert(buffers->at(type_count + src_idx).data(), src_type, 2, output->data(), dst_type,
+                                    1, length);
+                audio::dsp::convert(buffers->at(src_idx).data(), src_type, 1, output->data(), dst_type, 2, length);
+            }
+        }
+    }];
+}
+
+- (void)test_measure_float32_to_int16 {
+    uint32_t const length = 4096;
+    auto const source = std::make_shared<std::vector<float>>(test::dsp_convert::make_source(length));
+    auto output = std::make_shared<std::vector<int16_t>>(length);
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            audio::dsp::convert_from_float32(source->data(), output->data(), audio::dsp::sample_type::int16, 1,
+                                             length);
+        }
+    }];
+}
+
+- (void)test_measure_int16_to_float32 {
+    uint32_t const length = 4096;
+    auto const source = std::make_shared<std::vector<int16_t>>(length, 1000);
+    auto output = std::make_shared<std::vector<float>>(length);
+
+    [self measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            audio::dsp::convert_to_float32(source->data(), audio::dsp::sample_type::int16, 1, output->data(), length);
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,140 @@
+//
+//  yas_audio_dsp_interleave_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::dsp_interleave {
+static uint32_t constexpr measure_length = 512;
+
+struct buffers {
+    std::vector<uint8_t> interleaved;
+    std::vector<std::vector<uint8_t>> planes;
+    std::vector<void *> plane_ptrs;
+
+    buffers(uint32_t const channel_count, uint32_t const length, uint32_t const sample_byte_count)
+        : interleaved(channel_count * length * sample_byte_count),
+          planes(channel_count, std::vector<uint8_t>(length * sample_byte_count)),
+          plane_ptrs(channel_count) {
+        for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+            this->plane_ptrs[ch_idx] = this->planes[ch_idx].data();
+        }
+    }
+};
+
+static void measure(XCTestCase *test_case, uint32_t const channel_count, bool const is_strided_copy) {
+    auto const buffers = std::make_shared<test::dsp_interleave::buffers>(channel_count, measure_length, sizeof(float));
+
+    [test_case measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            if (is_strided_copy) {
+                for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                    audio::copy(&buffers->interleaved[ch_idx * sizeof(float)], channel_count,
+                                buffers->plane_ptrs[ch_idx], 1, measure_length, sizeof(float));
+                }
+            } else {
+                audio::dsp::deinterleave(buffers->interleaved.data(), buffers->plane_ptrs.data(), channel_count,
+                                         measure_length, sizeof(float));
+            }
+        }
+    }];
+}
+}  // namespace yas::test::dsp_interleave
+
+@interface yas_audio_dsp_interleave_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_dsp_interleave_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_round_trip {
+    for (uint32_t const sample_byte_count : {2, 3, 4, 8}) {
+        for (uint32_t const channel_count : {1, 2, 3, 4, 5, 8, 16, 64}) {
+            for (uint32_t const length : {1, 3, 17, 100}) {
+                test::dsp_interleave::buffers buffers{channel_count, length, sample_byte_count};
+                for (std::size_t idx = 0; idx < buffers.interleaved.size(); ++idx) {
+                    buffers.interleaved[idx] = static_cast<uint8_t>(idx * 7 + 3);
+                }
+                auto const source = buffers.interleaved;
+
+                audio::dsp::deinterleave(buffers.interleaved.data(), buffers.plane_ptrs.data(), channel_count, length,
+                                         sample_byte_count);
+
+                bool is_deinterleaved = true;
+                for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                    for (uint32_t frame = 0; frame < length; ++frame) {
+                        if (std::memcmp(&buffers.planes[ch_idx][frame * sample_byte_count],
+                                        &source[(frame * channel_count + ch_idx) * sample_byte_count],
+                                        sample_byte_count) != 0) {
+                            is_deinterleaved = false;
+                        }
+                    }
+                }
+                XCTAssertTrue(is_deinterleaved);
+
+                std::fill(buffers.interleaved.begin(), buffers.interleaved.end(), 0);
+
+                audio::dsp::interleave(buffers.plane_ptrs.data(), buffers.interleaved.data(), channel_count, length,
+                                       sample_byte_count);
+
+                XCTAssertTrue(buffers.interleaved == source);
+            }
+        }
+    }
+}
+
+- (void)test_copy_abl_interleaved_to_deinterleaved {
+    uint32_t const frame_length = 37;
+    auto const interleaved_format = audio::format(
+        {.sample_rate = 48000.0, .channel_count = 8, .pcm_format = audio::pcm_format::float32, .interleaved = true});
+    auto const deinterleaved_format = audio::format(
+        {.sample_rate = 48000.0, .channel_count = 8, .pcm_format = audio::pcm_format::float32, .interleaved = false});
+
+    audio::pcm_buffer interleaved_buffer{interleaved_format, frame_length};
+    audio::pcm_buffer deinterleaved_buffer{deinterleaved_format, frame_length};
+    audio::pcm_buffer result_buffer{interleaved_format, frame_length};
+
+    test::fill_test_values_to_buffer(interleaved_buffer);
+
+    XCTAssertTrue(deinterleaved_buffer.copy_from(interleaved_buffer));
+    XCTAssertTrue(test::is_equal_buffer_flexibly(interleaved_buffer, deinterleaved_buffer));
+
+    XCTAssertTrue(result_buffer.copy_from(deinterleaved_buffer));
+    XCTAssertTrue(test::is_equal_buffer_flexibly(interleaved_buffer, result_buffer));
+}
+
+- (void)test_measure_deinterleave_2ch {
+    test::dsp_interleave::measure(self, 2, false);
+}
+
+- (void)test_measure_deinterleave_2ch_strided_copy {
+    test::dsp_interleave::measure(self, 2, true);
+}
+
+- (void)test_measure_deinterleave_8ch {
+    test::dsp_interleave::measure(self, 8, false);
+}
+
+- (void)test_measure_deinterleave_8ch_strided_copy {
+    test::dsp_interleave::measure(self, 8, true);
+}
+
+- (void)test_measure_deinterleave_64ch {
+    test::dsp_interleave::measure(self, 64, false);
+}
+
+- (void)test_measure_deinterleave_64ch_strided_copy {
+    test::dsp_interleave::measure(self, 64, true);
+}
+
+@end
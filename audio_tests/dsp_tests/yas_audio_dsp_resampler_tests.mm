@@ -0,0 +1,182 @@
+//
+//  yas_audio_dsp_resampler_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::dsp_resampler {
+static double constexpr frequency = 1000.0;
+
+static float sine(int64_t const frame, double const sample_rate) {
+    return static_cast<float>(std::sin(2.0 * M_PI * frequency * static_cast<double>(frame) / sample_rate));
+}
+
+static float max_error_from_reference(double const input_rate, double const output_rate,
+                                      audio::dsp::resampler_quality const quality) {
+    uint32_t const slice_length = 256;
+    uint32_t const input_capacity = 1024;
+
+    audio::dsp::resampler resampler{input_rate, output_rate, 1, input_capacity, quality};
+
+    std::vector<float> input(input_capacity);
+    std::vector<float> output(slice_length);
+    float const *input_data = input.data();
+    float *output_data = output.data();
+
+    int64_t input_frame = 0;
+    int64_t output_frame = 0;
+    float max_error = 0.0f;
+
+    for (uint32_t slice = 0; slice < 100; ++slice) {
+        uint32_t const required = resampler.required_input_frames(slice_length);
+        for (uint32_t idx = 0; idx < required; ++idx) {
+            input[idx] = sine(input_frame + idx, input_rate);
+        }
+        input_frame += required;
+
+        resampler.push(&input_data, required);
+        uint32_t const pulled = resampler.pull(&output_data, slice_length);
+
+        for (uint32_t idx = 0; idx < pulled; ++idx) {
+            if (output_frame + idx >= resampler.tap_count()) {
+                float const error = std::fabs(output[idx] - sine(output_frame + idx, output_rate));
+                max_error = std::max(max_error, error);
+            }
+        }
+        output_frame += pulled;
+    }
+
+    return max_error;
+}
+
+static void measure_resampler(XCTestCase *test_case, double const input_rate, double const output_rate) {
+    uint32_t const channel_count = 2;
+    uint32_t const slice_length = 512;
+    uint32_t const input_capacity = 2048;
+
+    auto resampler = std::make_shared<audio::dsp::resampler>(input_rate, output_rate, channel_count, input_capacity,
+                                                             audio::dsp::resampler_quality::high);
+
+    auto input = std::make_shared<std::vector<std::vector<float>>>(channel_count, std::vector<float>(input_capacity));
+    auto output = std::make_shared<std::vector<std::vector<float>>>(channel_count, std::vector<float>(slice_length));
+
+    for (auto &data : *input) {
+        for (uint32_t idx = 0; idx < input_capacity; ++idx) {
+            data[idx] = sine(idx, input_rate);
+        }
+    }
+
+    std::vector<float const *> input_data{input->at(0).data(), input->at(1).data()};
+    std::vector<float *> output_data{output->at(0).data(), output->at(1).data()};
+
+    [test_case measureBlock:^{
+        for (uint32_t idx = 0; idx < 1000; ++idx) {
+            resampler->push(input_data.data(), resampler->required_input_frames(slice_length));
+            resampler->pull(output_data.data(), slice_length);
+        }
+    }];
+}
+}  // namespace yas::test::dsp_resampler
+
+@interface yas_audio_dsp_resampler_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_dsp_resampler_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_is_supported {
+    XCTAssertTrue(audio::dsp::resampler::is_supported(44100.0, 48000.0));
+    XCTAssertTrue(audio::dsp::resampler::is_supported(48000.0, 96000.0));
+    XCTAssertTrue(audio::dsp::resampler::is_supported(48000.0, 48000.0));
+
+    XCTAssertFalse(audio::dsp::resampler::is_supported(0.0, 48000.0));
+    XCTAssertFalse(audio::dsp::resampler::is_supported(44100.5, 48000.0));
+    XCTAssertFalse(audio::dsp::resampler::is_supported(48000.0, 47999.0));
+
+    XCTAssertThrows(audio::dsp::resampler(44100.5, 48000.0, 1, 512));
+}
+
+- (void)test_frame_counts {
+    audio::dsp::resampler resampler{48000.0, 96000.0, 2, 1024};
+
+    XCTAssertEqual(resampler.channel_count(), 2);
+    XCTAssertEqual(resampler.available_output_frames(), 0);
+
+    uint32_t const required = resampler.required_input_frames(256);
+    XCTAssertGreaterThan(required, 128);
+
+    std::vector<float> input(required, 0.0f);
+    float const *input_data[2] = {input.data(), input.data()};
+
+    XCTAssertEqual(resampler.push(input_data, required), required);
+    XCTAssertGreaterThanOrEqual(resampler.available_output_frames(), 256);
+    XCTAssertEqual(resampler.required_input_frames(256), 0);
+
+    std::vector<float> output(256);
+    float *output_data[2] = {output.data(), output.data()};
+
+    XCTAssertEqual(resampler.pull(output_data, 256), 256);
+    XCTAssertEqual(resampler.required_input_frames(256), 128);
+
+    resampler.reset();
+
+    XCTAssertEqual(resampler.required_input_frames(256), required);
+}
+
+- (void)test_reference_44100_to_48000 {
+    auto const low =
+        test::dsp_resampler::max_error_from_reference(44100.0, 48000.0, audio::dsp::resampler_quality::low);
+    auto const high =
+        test::dsp_resampler::max_error_from_reference(44100.0, 48000.0, audio::dsp::resampler_quality::high);
+
+    XCTAssertLessThan(low, 1.0e-3f);
+    XCTAssertLessThan(high, 1.0e-5f);
+}
+
+- (void)test_reference_48000_to_44100 {
+    auto const medium =
+        test::dsp_resampler::max_error_from_reference(48000.0, 44100.0, audio::dsp::resampler_quality::medium);
+    auto const high =
+        test::dsp_resampler::max_error_from_reference(48000.0, 44100.0, audio::dsp::resampler_quality::high);
+
+    XCTAssertLessThan(medium, 1.0e-3f);
+    XCTAssertLessThan(high, 1.0e-5f);
+}
+
+- (void)test_reference_48000_to_96000 {
+    auto const up =
+        test::dsp_resampler::max_error_from_reference(48000.0, 96000.0, audio::dsp::resampler_quality::high);
+    auto const down =
+        test::dsp_resampler::max_error_from_reference(96000.0, 48000.0, audio::dsp::resampler_quality::high);
+
+    XCTAssertLessThan(up, 1.0e-5f);
+    XCTAssertLessThan(down, 1.0e-5f);
+}
+
+- (void)test_44100_to_48000_performance {
+    test::dsp_resampler::measure_resampler(self, 44100.0, 48000.0);
+}
+
+- (void)test_48000_to_44100_performance {
+    test::dsp_resampler::measure_resampler(self, 48000.0, 44100.0);
+}
+
+- (void)test_48000_to_96000_performance {
+    test::dsp_resampler::measure_resampler(self, 48000.0, 96000.0);
+}
+
+- (void)test_96000_to_48000_performance {
+    test::dsp_resampler::measure_resampler(self, 96000.0, 48000.0);
+}
+
+@end
@@ -0,0 +1,154 @@
+//
+//  yas_audio_rendering_converter_tests.mm
+//
+
+#import <XCTest/XCTest.h>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_rendering_converter_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_rendering_converter_tests
+
+- (void)test_is_convertible {
+    audio::format const float32_format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const int16_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16, .interleaved = true}};
+    audio::format const resampled_format{{.sample_rate = 44100.0, .channel_count = 1}};
+    audio::format const unsupported_rate_format{{.sample_rate = 47999.5, .channel_count = 2}};
+
+    XCTAssertTrue(audio::rendering_converter::is_convertible(float32_format, int16_format));
+    XCTAssertTrue(audio::rendering_converter::is_convertible(int16_format, resampled_format));
+    XCTAssertFalse(audio::rendering_converter::is_convertible(float32_format, unsupported_rate_format));
+
+    XCTAssertThrows(audio::rendering_converter(float32_format, unsupported_rate_format, 512));
+}
+
+- (void)test_push_sample_type_and_interleaving {
+    audio::format const source_format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const destination_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16, .interleaved = true}};
+
+    audio::rendering_converter converter{source_format, destination_format, 4};
+
+    audio::pcm_buffer source{source_format, 4};
+    float *left = source.data_ptr_at_channel<float>(0);
+    float *right = source.data_ptr_at_channel<float>(1);
+    left[0] = 1.0f;
+    left[1] = -1.0f;
+    left[2] = 0.5f;
+    left[3] = 2.0f;
+    right[0] = -0.5f;
+    right[1] = 0.0f;
+    right[2] = 0.25f;
+    right[3] = -2.0f;
+
+    audio::pcm_buffer destination{destination_format, 4};
+
+    XCTAssertTrue(converter.push(source, &destination));
+    XCTAssertEqual(destination.frame_length(), 4);
+
+    int16_t const *data = destination.data_ptr_at_index<int16_t>(0);
+    XCTAssertEqual(data[0], 32767);
+    XCTAssertEqual(data[1], -16384);
+    XCTAssertEqual(data[2], -32768);
+    XCTAssertEqual(data[3], 0);
+    XCTAssertEqual(data[4], 16384);
+    XCTAssertEqual(data[5], 8192);
+    XCTAssertEqual(data[6], 32767);
+    XCTAssertEqual(data[7], -32768);
+}
+
+- (void)test_push_channel_mapping {
+    audio::format const mono_format{{.sample_rate = 48000.0, .channel_count = 1}};
+    audio::format const stereo_format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    audio::rendering_converter upmix_converter{mono_format, stereo_format, 2};
+    audio::rendering_converter downmix_converter{stereo_format, mono_format, 2};
+
+    audio::pcm_buffer mono_buffer{mono_format, 2};
+    mono_buffer.data_ptr_at_channel<float>(0)[0] = 0.5f;
+    mono_buffer.data_ptr_at_channel<float>(0)[1] = -0.25f;
+
+    audio::pcm_buffer stereo_buffer{stereo_format, 2};
+
+    XCTAssertTrue(upmix_converter.push(mono_buffer, &stereo_buffer));
+    XCTAssertEqual(stereo_buffer.data_ptr_at_channel<float>(0)[0], 0.5f);
+    XCTAssertEqual(stereo_buffer.data_ptr_at_channel<float>(1)[0], 0.5f);
+    XCTAssertEqual(stereo_buffer.data_ptr_at_channel<float>(0)[1], -0.25f);
+    XCTAssertEqual(stereo_buffer.data_ptr_at_channel<float>(1)[1], -0.25f);
+
+    stereo_buffer.data_ptr_at_channel<float>(0)[0] = 1.0f;
+    stereo_buffer.data_ptr_at_channel<float>(1)[0] = 0.0f;
+
+    XCTAssertTrue(downmix_converter.push(stereo_buffer, &mono_buffer));
+    XCTAssertEqual(mono_buffer.data_ptr_at_channel<float>(0)[0], 0.5f);
+    XCTAssertEqual(mono_buffer.data_ptr_at_channel<float>(0)[1], -0.25f);
+}
+
+- (void)test_pull_with_resampling {
+    audio::format const source_format{
+        {.sample_rate = 44100.0, .channel_count = 2, .pcm_format = audio::pcm_format::float64}};
+    audio::format const destination_format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    audio::rendering_converter converter{source_format, destination_format, 512};
+
+    std::vector<uint32_t> source_lengths;
+
+    audio::rendering_node const source_node{[&source_lengths](audio::node_render_args const &args) {
+                                                source_lengths.push_back(args.buffer->frame_length());
+
+                                                auto each = audio::make_each_data<double>(*args.buffer);
+                                                while (yas_each_data_next(each)) {
+                                                    yas_each_data_value(each) = 0.5;
+                                                }
+                                            },
+                                            {}};
+    audio::rendering_connection const connection{0, &source_node, source_format};
+
+    audio::pcm_buffer destination{destination_format, 512};
+
+    XCTAssertTrue(converter.pull(&destination, audio::time{0, 48000.0}, connection));
+    XCTAssertTrue(converter.pull(&destination, audio::time{512, 48000.0}, connection));
+
+    XCTAssertEqual(source_lengths.size(), 2);
+    XCTAssertLessThanOrEqual(source_lengths.at(1), 472);
+
+    XCTAssertEqualWithAccuracy(destination.data_ptr_at_channel<float>(0)[0], 0.5f, 0.001f);
+    XCTAssertEqualWithAccuracy(destination.data_ptr_at_channel<float>(1)[511], 0.5f, 0.001f);
+
+    audio::pcm_buffer mismatched{source_format, 512};
+    XCTAssertFalse(converter.pull(&mismatched, audio::time{1024, 48000.0}, connection));
+}
+
+- (void)test_connection_render_with_converter {
+    audio::format const connection_format{{.sample_rate = 48000.0, .channel_count = 1}};
+    audio::format const buffer_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::float64, .interleaved = true}};
+
+    audio::rendering_node const source_node{[](audio::node_render_args const &args) {
+                                                args.buffer->data_ptr_at_index<float>(0)[0] = 0.75f;
+                                            },
+                                            {}};
+
+    audio::rendering_connection const plain_connection{0, &source_node, connection_format};
+    audio::rendering_connection const converting_connection{
+        0, &source_node, connection_format,
+        std::make_shared<audio::rendering_converter>(connection_format, buffer_format, 4)};
+
+    audio::pcm_buffer buffer{buffer_format, 4};
+    audio::time const time{0, 48000.0};
+
+    XCTAssertFalse(plain_connection.render(&buffer, time));
+    XCTAssertTrue(converting_connection.render(&buffer, time));
+
+    double const *data = buffer.data_ptr_at_index<double>(0);
+    XCTAssertEqual(data[0], 0.75);
+    XCTAssertEqual(data[1], 0.75);
+    XCTAssertEqual(data[2], 0.0);
+}
+
+@end
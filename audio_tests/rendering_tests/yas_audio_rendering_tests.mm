@@ -145,6 +145,64 @@ using namespace yas;
     }
 }
 
+- (void)test_rendering_graph_with_converters {
+    auto graph = audio::graph::make_shared();
+
+    audio::format const output_format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const device_output_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16, .interleaved = true}};
+    audio::format const input_format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const device_input_format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    auto const source_tap = audio::graph_tap::make_shared();
+    test::node_object output_obj(1, 0);
+    test::node_object input_source_obj(0, 1);
+    auto const input_tap = audio::graph_input_tap::make_shared();
+
+    source_tap->set_render_handler([](audio::node_render_args const &args) {
+        auto each = audio::make_each_data<float>(*args.buffer);
+        while (yas_each_data_next(each)) {
+            yas_each_data_value(each) = 0.5f;
+        }
+    });
+
+    std::vector<uint32_t> input_channel_counts;
+    std::vector<float> input_values;
+
+    input_tap->set_render_handler([&input_channel_counts, &input_values](audio::node_input_render_args const &args) {
+        input_channel_counts.push_back(args.buffer->format().channel_count());
+        input_values.push_back(args.buffer->data_ptr_at_channel<float>(1)[0]);
+    });
+
+    graph->connect(source_tap->node, output_obj.node, output_format);
+    graph->connect(input_source_obj.node, input_tap->node, input_format);
+
+    audio::rendering_graph rendering_graph{
+        output_obj.node, input_source_obj.node,
+        {.output_format = device_output_format, .input_format = device_input_format, .frame_capacity = 8}};
+
+    XCTAssertTrue(rendering_graph.output_node()->source_connection.converter != nullptr);
+    XCTAssertTrue(rendering_graph.input_node()->converter != nullptr);
+
+    audio::time const time{0, 48000.0};
+
+    audio::pcm_buffer output_buffer{device_output_format, 8};
+    XCTAssertTrue(rendering_graph.output_node()->render(&output_buffer, time));
+
+    int16_t const *output_data = output_buffer.data_ptr_at_index<int16_t>(0);
+    XCTAssertEqual(output_data[0], 16384);
+    XCTAssertEqual(output_data[1], 16384);
+    XCTAssertEqual(output_data[15], 16384);
+
+    audio::pcm_buffer input_buffer{device_input_format, 8};
+    input_buffer.data_ptr_at_index<float>(0)[0] = 0.25f;
+    XCTAssertTrue(rendering_graph.input_node()->render(&input_buffer, time));
+
+    XCTAssertEqual(input_channel_counts.size(), 1);
+    XCTAssertEqual(input_channel_counts.at(0), 2);
+    XCTAssertEqual(input_values.at(0), 0.25f);
+}
+
 - (void)test_rendering_graph_empty {
     test::node_object output_obj{1, 0};
     test::node_object input_obj{0, 1};
@@ -14,6 +14,9 @@ struct test_io_core : audio::io_core {
 
     std::optional<std::function<bool(void)>> start_handler = std::nullopt;
     std::optional<std::function<void(void)>> stop_handler = std::nullopt;
+    std::optional<std::function<void(audio::render_thread_policy const &)>> set_render_thread_policy_handler =
+        std::nullopt;
+    std::vector<audio::render_thread_policy::error_t> render_thread_policy_errors_value;
 
     void set_render_handler(std::optional<audio::io_render_f> handler) override {
         if (auto const &set_handler = this->set_render_handler_handler) {
@@ -40,6 +43,16 @@ struct test_io_core : audio::io_core {
             return handler.value()();
         }
     }
+
+    void set_render_thread_policy(audio::render_thread_policy const &policy) override {
+        if (auto const &handler = this->set_render_thread_policy_handler) {
+            handler.value()(policy);
+        }
+    }
+
+    std::vector<audio::render_thread_policy::error_t> render_thread_policy_errors() const override {
+        return this->render_thread_policy_errors_value;
+    }
 };
 
 using test_io_core_ptr = std::shared_ptr<test_io_core>;
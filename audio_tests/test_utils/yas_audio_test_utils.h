@@ -8,6 +8,7 @@
 #pragma once
 
 #import <audio/audio.h>
+#import <limits>
 
 namespace yas::test {
 uint32_t test_value(uint32_t const frame, uint32_t const ch_idx, uint32_t const buf_idx);
@@ -20,6 +21,61 @@ bool is_equal(double const val1, double const val2, double const accuracy = 0);
 bool is_equal_data(void const *const inData1, void const *const inData2, const size_t inSize);
 bool is_equal(AudioTimeStamp const *const ts1, AudioTimeStamp const *const ts2);
 
+// the sample rate of make_format and make_file_format.
+double constexpr sample_rate = 48000.0;
+
+audio::format make_format(audio::pcm_format const pcm_format, uint32_t const channel_count, bool const interleaved);
+// fills the float32 buffer with the values counted up from the begin value along the frames.
+void fill_sequence(audio::pcm_buffer &buffer, uint32_t const begin_value);
+bool is_sequence(audio::pcm_buffer const &buffer, uint32_t const begin_value);
+
+// the directory of the name in the temporary directory.
+yas::url temporary_test_dir_url(std::string const &dir_name);
+// removes the files left in the directory and creates it if not exists.
+void setup_test_directory(std::string const &dir_name);
+void remove_test_files(std::string const &dir_name);
+
+// exact in 16 bit. not zero to be told from the silence.
+float file_value(uint32_t const frame, uint32_t const ch_idx);
+// fills the float32 or float64 buffer with the values from the begin frame.
+void fill_file_values(audio::pcm_buffer &buffer, uint32_t const begin_frame);
+// compares the first length frames of the float32 or float64 buffer with the values from the begin frame.
+bool is_filled_file_values(audio::pcm_buffer const &buffer, uint32_t const begin_frame,
+                           uint32_t const length = std::numeric_limits<uint32_t>::max());
+// writes the values from the frame 0 to a new file with native_file through the buffers of the pcm format.
+void write_file_values(yas::url const &url, audio::file_type const file_type, audio::format const &file_format,
+                       uint32_t const frame_length, audio::pcm_format const pcm_format = audio::pcm_format::float32);
+
+// the linear pcm format of a file at the sample rate.
+audio::format make_file_format(uint32_t const channel_count, uint32_t const bit_depth, bool const is_float,
+                               bool const is_big_endian = false);
+// writes the values to a new file in the test directory and returns the url.
+yas::url write_test_file(std::string const &dir_name, std::string const &file_name, audio::file_type const file_type,
+                         audio::format const &file_format, uint32_t const frame_length);
+// a new wave file in the test directory.
+audio::file_ptr make_created_test_file(std::string const &dir_name, std::string const &file_name,
+                                       CFDictionaryRef const &settings);
+// writes the values to a new wave file in the test directory and returns it opened for reading.
+audio::file_ptr make_opened_test_file(std::string const &dir_name, std::string const &file_name,
+                                      audio::format const &file_format, uint32_t const frame_length);
+
+// counts the global operator new calls of all the forms on the current thread while alive.
+struct allocation_counter final {
+    allocation_counter();
+    ~allocation_counter();
+
+    [[nodiscard]] std::size_t count() const;
+
+   private:
+    std::size_t _count = 0;
+    std::size_t *_previous;
+
+    allocation_counter(allocation_counter const &) = delete;
+    allocation_counter(allocation_counter &&) = delete;
+    allocation_counter &operator=(allocation_counter const &) = delete;
+    allocation_counter &operator=(allocation_counter &&) = delete;
+};
+
 struct node_object {
     node_object(uint32_t const input_bus_count = 2, uint32_t const output_bus_count = 1);
 
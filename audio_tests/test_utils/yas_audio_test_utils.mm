@@ -4,9 +4,124 @@
 
 #include "yas_audio_test_utils.h"
 
+#include <cpp_utils/yas_file_manager.h>
+#include <cpp_utils/yas_system_path_utils.h>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
 using namespace yas;
 using namespace yas::audio;
 
+namespace yas::test::allocation {
+static thread_local std::size_t *current_count = nullptr;
+
+static void *allocate(std::size_t const size, std::size_t const alignment) noexcept {
+    if (std::size_t *const count = current_count) {
+        ++*count;
+    }
+
+    std::size_t const byte_count = size > 0 ? size : 1;
+
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(byte_count);
+    }
+
+    void *ptr = nullptr;
+    return posix_memalign(&ptr, alignment, byte_count) == 0 ? ptr : nullptr;
+}
+
+static void *allocate_or_throw(std::size_t const size, std::size_t const alignment) {
+    if (void *const ptr = allocate(size, alignment)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+}
+
+// the aligned and nothrow forms are replaced too. an allocation through any of them is counted.
+
+void *operator new(std::size_t size) {
+    return test::allocation::allocate_or_throw(size, 0);
+}
+
+void *operator new[](std::size_t size) {
+    return test::allocation::allocate_or_throw(size, 0);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    return test::allocation::allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return test::allocation::allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new(std::size_t size, std::nothrow_t const &) noexcept {
+    return test::allocation::allocate(size, 0);
+}
+
+void *operator new[](std::size_t size, std::nothrow_t const &) noexcept {
+    return test::allocation::allocate(size, 0);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const &) noexcept {
+    return test::allocation::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const &) noexcept {
+    return test::allocation::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::nothrow_t const &) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::nothrow_t const &) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, std::nothrow_t const &) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, std::nothrow_t const &) noexcept {
+    std::free(ptr);
+}
+
 namespace yas::test::internal {
 template <typename T>
 bool is_filled_buffer(pcm_buffer const &buffer) {
@@ -32,6 +147,31 @@ T const *data_ptr_from_buffer(pcm_buffer const &buffer, uint32_t const channel,
     }
     return yas_each_data_ptr(each_data);
 }
+
+template <typename T>
+void fill_file_values(pcm_buffer &buffer, uint32_t const begin_frame) {
+    auto each = audio::make_each_block<T>(buffer);
+    while (each.next()) {
+        T *const data = each.data();
+        for (uint32_t idx = 0; idx < each.length(); ++idx) {
+            data[idx * each.stride()] = file_value(begin_frame + each.frame() + idx, each.channel());
+        }
+    }
+}
+
+template <typename T>
+bool is_filled_file_values(pcm_buffer const &buffer, uint32_t const begin_frame, uint32_t const length) {
+    auto each = audio::make_each_block<T>(buffer);
+    while (each.next()) {
+        T const *const data = each.data();
+        for (uint32_t idx = 0; idx < each.length() && each.frame() + idx < length; ++idx) {
+            if (data[idx * each.stride()] != file_value(begin_frame + each.frame() + idx, each.channel())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
 }
 
 uint32_t test::test_value(uint32_t const frame, uint32_t const ch_idx, uint32_t const buf_idx) {
@@ -170,7 +310,159 @@ uint8_t const *test::data_ptr_from_buffer(pcm_buffer const &buffer, uint32_t con
     }
 }
 
+audio::format test::make_format(audio::pcm_format const pcm_format, uint32_t const channel_count,
+                                bool const interleaved) {
+    return audio::format({.sample_rate = sample_rate,
+                          .channel_count = channel_count,
+                          .pcm_format = pcm_format,
+                          .interleaved = interleaved});
+}
+
+void test::fill_sequence(pcm_buffer &buffer, uint32_t const begin_value) {
+    auto each = audio::make_each_block<float>(buffer);
+    while (each.next()) {
+        float *const data = each.data();
+        for (uint32_t idx = 0; idx < each.length(); ++idx) {
+            data[idx * each.stride()] = static_cast<float>(begin_value + each.frame() + idx);
+        }
+    }
+}
+
+bool test::is_sequence(pcm_buffer const &buffer, uint32_t const begin_value) {
+    auto each = audio::make_each_block<float>(buffer);
+    while (each.next()) {
+        float const *const data = each.data();
+        for (uint32_t idx = 0; idx < each.length(); ++idx) {
+            if (data[idx * each.stride()] != static_cast<float>(begin_value + each.frame() + idx)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+yas::url test::temporary_test_dir_url(std::string const &dir_name) {
+    return system_path_utils::directory_url(system_path_utils::dir::temporary).appending(dir_name);
+}
+
+void test::setup_test_directory(std::string const &dir_name) {
+    remove_test_files(dir_name);
+
+    if (auto result = file_manager::create_directory_if_not_exists(temporary_test_dir_url(dir_name).path());
+        result.is_error()) {
+        throw std::runtime_error("create_directory_if_not_exists failed");
+    }
+}
+
+void test::remove_test_files(std::string const &dir_name) {
+    if (auto result = file_manager::remove_contents_in_directory(temporary_test_dir_url(dir_name).path());
+        result.is_error()) {
+        throw std::runtime_error("remove_contents_in_directory failed");
+    }
+}
+
+float test::file_value(uint32_t const frame, uint32_t const ch_idx) {
+    int32_t const value = static_cast<int32_t>((frame * 7 + ch_idx * 13) % 200) - 100;
+    return static_cast<float>(value < 0 ? value : value + 1) / 128.0f;
+}
+
+void test::fill_file_values(pcm_buffer &buffer, uint32_t const begin_frame) {
+    switch (buffer.format().pcm_format()) {
+        case audio::pcm_format::float32:
+            internal::fill_file_values<float>(buffer, begin_frame);
+            break;
+        case audio::pcm_format::float64:
+            internal::fill_file_values<double>(buffer, begin_frame);
+            break;
+
+        default:
+            throw "invalid pcm format.";
+    }
+}
+
+bool test::is_filled_file_values(pcm_buffer const &buffer, uint32_t const begin_frame, uint32_t const length) {
+    switch (buffer.format().pcm_format()) {
+        case audio::pcm_format::float32:
+            return internal::is_filled_file_values<float>(buffer, begin_frame, length);
+        case audio::pcm_format::float64:
+            return internal::is_filled_file_values<double>(buffer, begin_frame, length);
+
+        default:
+            throw "invalid pcm format.";
+    }
+}
+
+void test::write_file_values(yas::url const &url, audio::file_type const file_type, audio::format const &file_format,
+                             uint32_t const frame_length, audio::pcm_format const pcm_format) {
+    auto const file = audio::native_file::make_created(url, file_type, file_format);
+    if (!file) {
+        throw std::runtime_error("make_created failed");
+    }
+
+    audio::pcm_buffer buffer{audio::format({.sample_rate = file_format.sample_rate(),
+                                            .channel_count = file_format.channel_count(),
+                                            .pcm_format = pcm_format}),
+                             4096};
+    uint32_t written_length = 0;
+
+    while (written_length < frame_length) {
+        buffer.set_frame_length(std::min(buffer.frame_capacity(), frame_length - written_length));
+        fill_file_values(buffer, written_length);
+        if (!file->write_from_buffer(buffer)) {
+            throw std::runtime_error("write_from_buffer failed");
+        }
+        written_length += buffer.frame_length();
+    }
+}
+
+audio::format test::make_file_format(uint32_t const channel_count, uint32_t const bit_depth, bool const is_float,
+                                     bool const is_big_endian) {
+    return audio::format{
+        audio::linear_pcm_file_settings(sample_rate, channel_count, bit_depth, is_big_endian, is_float, false)};
+}
+
+yas::url test::write_test_file(std::string const &dir_name, std::string const &file_name,
+                               audio::file_type const file_type, audio::format const &file_format,
+                               uint32_t const frame_length) {
+    auto const url = temporary_test_dir_url(dir_name).appending(file_name);
+    write_file_values(url, file_type, file_format, frame_length);
+    return url;
+}
+
+audio::file_ptr test::make_created_test_file(std::string const &dir_name, std::string const &file_name,
+                                             CFDictionaryRef const &settings) {
+    auto result = audio::file::make_created({.file_url = temporary_test_dir_url(dir_name).appending(file_name),
+                                             .file_type = audio::file_type::wave,
+                                             .settings = settings});
+    if (result.is_error()) {
+        throw std::runtime_error("make_created failed");
+    }
+    return result.value();
+}
+
+audio::file_ptr test::make_opened_test_file(std::string const &dir_name, std::string const &file_name,
+                                            audio::format const &file_format, uint32_t const frame_length) {
+    auto const url = write_test_file(dir_name, file_name, audio::file_type::wave, file_format, frame_length);
+    auto result = audio::file::make_opened({.file_url = url});
+    if (result.is_error()) {
+        throw std::runtime_error("make_opened failed");
+    }
+    return result.value();
+}
+
 test::node_object::node_object(uint32_t const input_bus_count, uint32_t const output_bus_count)
     : node(audio::graph_node::make_shared(
           audio::graph_node_args{.input_bus_count = input_bus_count, .output_bus_count = output_bus_count})) {
 }
+
+test::allocation_counter::allocation_counter() : _previous(allocation::current_count) {
+    allocation::current_count = &this->_count;
+}
+
+test::allocation_counter::~allocation_counter() {
+    allocation::current_count = this->_previous;
+}
+
+std::size_t test::allocation_counter::count() const {
+    return this->_count;
+}